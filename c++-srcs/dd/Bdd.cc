@@ -447,8 +447,8 @@ Bdd::eval(
     }
     auto node = edge.node();
     auto inv = edge.inv();
-    auto level = node->level();
-    if ( inputs[level] ) {
+    auto varid = get()->level_to_varid(node->level());
+    if ( inputs[varid] ) {
       edge = node->edge1();
     }
     else {
@@ -0,0 +1,242 @@
+
+/// @file Bdd2Sop.cc
+/// @brief Bdd2Sop の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/Bdd2Sop.h"
+#include "ym/BddMgr.h"
+#include "ym/BddLit.h"
+
+
+BEGIN_NAMESPACE_YM
+
+BEGIN_NONAMESPACE
+
+// キューブのリスト
+using CubeList = std::vector<std::vector<Literal>>;
+
+//////////////////////////////////////////////////////////////////////
+// Minato-Morreale の ISOP アルゴリズムを実行するクラス
+//////////////////////////////////////////////////////////////////////
+class IsopOp
+{
+public:
+
+  /// @brief コンストラクタ
+  IsopOp(
+    const Bdd& f,
+    const std::vector<BddVar>& var_list
+  ) : mMgr{f}
+  {
+    // BDD の変数番号から積和形の変数番号への対応表を作る．
+    for ( SizeType i = 0; i < var_list.size(); ++ i ) {
+      mIndexMap.emplace(var_list[i].id(), i);
+    }
+    // BDD の変数番号からレベルへの対応表を作る．
+    auto order = mMgr.variable_order();
+    for ( SizeType level = 0; level < order.size(); ++ level ) {
+      mLevelMap.emplace(order[level].id(), level);
+    }
+  }
+
+  /// @brief デストラクタ
+  ~IsopOp() = default;
+
+
+public:
+
+  /// @brief lower <= ans <= upper となる非冗長積和形を求める．
+  /// @return 結果の積和形を表す BDD を返す．
+  Bdd
+  isop(
+    const Bdd& lower,
+    const Bdd& upper,
+    CubeList& cube_list
+  )
+  {
+    if ( lower.is_zero() ) {
+      cube_list.clear();
+      return mMgr.zero();
+    }
+    if ( upper.is_one() ) {
+      cube_list = CubeList{{}};
+      return mMgr.one();
+    }
+
+    Key key{lower, upper};
+    auto p = mTable.find(key);
+    if ( p != mTable.end() ) {
+      cube_list = p->second.mCubeList;
+      return p->second.mCover;
+    }
+
+    // lower と upper の根の変数のうちレベルの小さい方で展開する．
+    auto var = top_var(lower, upper);
+    auto vid = var.id();
+    if ( mIndexMap.count(vid) == 0 ) {
+      throw std::invalid_argument{"function depends on a variable not in var_list"};
+    }
+    auto l0 = lower.cofactor(var, true);
+    auto l1 = lower.cofactor(var, false);
+    auto u0 = upper.cofactor(var, true);
+    auto u1 = upper.cofactor(var, false);
+
+    // var が 0 の時にのみ必要な部分
+    CubeList cube0_list;
+    auto c0 = isop(l0 & ~u1, u0, cube0_list);
+    // var が 1 の時にのみ必要な部分
+    CubeList cube1_list;
+    auto c1 = isop(l1 & ~u0, u1, cube1_list);
+    // var に依存しない部分
+    auto ld = (l0 & ~c0) | (l1 & ~c1);
+    auto ud = u0 & u1;
+    auto cd = isop(ld, ud, cube_list);
+
+    auto lit1 = Literal{mIndexMap.at(vid), false};
+    auto lit0 = ~lit1;
+    cube_list.reserve(cube_list.size() + cube0_list.size() + cube1_list.size());
+    for ( auto& cube: cube0_list ) {
+      cube.push_back(lit0);
+      cube_list.push_back(std::move(cube));
+    }
+    for ( auto& cube: cube1_list ) {
+      cube.push_back(lit1);
+      cube_list.push_back(std::move(cube));
+    }
+    auto lit = var.positive_literal();
+    auto cover = (~lit & c0) | (lit & c1) | cd;
+
+    mTable.emplace(key, Result{cube_list, cover});
+    return cover;
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  // 計算結果を記録するためのキー
+  struct Key
+  {
+    Bdd mLower;
+    Bdd mUpper;
+
+    bool
+    operator==(
+      const Key& right
+    ) const
+    {
+      return mLower == right.mLower && mUpper == right.mUpper;
+    }
+  };
+
+  // Key のハッシュ関数
+  struct KeyHash
+  {
+    SizeType
+    operator()(
+      const Key& key
+    ) const
+    {
+      return key.mLower.hash() * 1048583 + key.mUpper.hash();
+    }
+  };
+
+  // 計算結果
+  struct Result
+  {
+    CubeList mCubeList;
+    Bdd mCover;
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 2つの BDD の根の変数のうちレベルの小さい方を返す．
+  BddVar
+  top_var(
+    const Bdd& f,
+    const Bdd& g
+  )
+  {
+    auto var_f = f.root_var();
+    auto var_g = g.root_var();
+    if ( var_f.is_invalid() ) {
+      return var_g;
+    }
+    if ( var_g.is_invalid() ) {
+      return var_f;
+    }
+    if ( mLevelMap.at(var_f.id()) <= mLevelMap.at(var_g.id()) ) {
+      return var_f;
+    }
+    return var_g;
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // BDD マネージャ
+  BddMgr mMgr;
+
+  // BDD の変数番号をキーにして積和形の変数番号を保持する辞書
+  std::unordered_map<SizeType, SizeType> mIndexMap;
+
+  // BDD の変数番号をキーにしてレベルを保持する辞書
+  std::unordered_map<SizeType, SizeType> mLevelMap;
+
+  // 計算結果を記録する辞書
+  std::unordered_map<Key, Result, KeyHash> mTable;
+
+};
+
+END_NONAMESPACE
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス Bdd2Sop
+//////////////////////////////////////////////////////////////////////
+
+// @brief Minato-Morreale のアルゴリズムで非冗長積和形を求める．
+std::vector<SopCube>
+Bdd2Sop::isop(
+  const Bdd& f,
+  const std::vector<BddVar>& var_list
+)
+{
+  BddMgr mgr{f};
+  return isop(f, mgr.zero(), var_list);
+}
+
+// @brief Minato-Morreale のアルゴリズムで非冗長積和形を求める．
+std::vector<SopCube>
+Bdd2Sop::isop(
+  const Bdd& f,
+  const Bdd& dc,
+  const std::vector<BddVar>& var_list
+)
+{
+  IsopOp op{f, var_list};
+  CubeList cube_list;
+  // オンセットは f & ~dc 以上，f | dc 以下となる．
+  op.isop(f & ~dc, f | dc, cube_list);
+  auto ni = var_list.size();
+  std::vector<SopCube> ans_list;
+  ans_list.reserve(cube_list.size());
+  for ( auto& lits: cube_list ) {
+    ans_list.push_back(SopCube{ni, lits});
+  }
+  return ans_list;
+}
+
+END_NAMESPACE_YM
@@ -0,0 +1,116 @@
+
+/// @file BddAndExistOp.cc
+/// @brief BddAndExistOp の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/Bdd.h"
+#include "ym/BddVarSet.h"
+#include "BddAndExistOp.h"
+
+
+BEGIN_NAMESPACE_YM_DD
+
+// @brief 論理積と存在量化を同時に行う．
+Bdd
+Bdd::and_exist(
+  const Bdd& right,
+  const BddVarSet& var_set
+) const
+{
+  auto edge = _and_exist(right, var_set);
+  return _bdd(edge);
+}
+
+// @brief and_exist の下請け関数
+DdEdge
+Bdd::_and_exist(
+  const Bdd& right,
+  const BddVarSet& var_set
+) const
+{
+  _check_valid_mgr(right);
+  auto cube = var_set.bdd();
+  _check_valid_mgr(cube);
+  BddAndExistOp op(get());
+  auto edge = op.and_exist_step(root(), right.root(), cube.root());
+  return edge;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス BddAndExistOp
+//////////////////////////////////////////////////////////////////////
+
+// @brief 論理積と存在量化を行う．
+DdEdge
+BddAndExistOp::and_exist_step(
+  DdEdge left,
+  DdEdge right,
+  DdEdge cedge
+)
+{
+  // 自明な場合
+  if ( left.is_zero() || right.is_zero() || left == ~right ) {
+    return DdEdge::zero();
+  }
+  if ( left.is_one() ) {
+    return mExistOp.exist_step(right, cedge);
+  }
+  if ( right.is_one() || left == right ) {
+    return mExistOp.exist_step(left, cedge);
+  }
+  if ( cedge.is_one() ) {
+    return mIteOp.and_step(left, right);
+  }
+
+  // 可換なので正規化する．
+  if ( left.body() > right.body() ) {
+    std::swap(left, right);
+  }
+
+  auto l_level = left.node()->level();
+  auto r_level = right.node()->level();
+  auto top = std::min(l_level, r_level);
+
+  // top より上にある変数は無関係なので読み飛ばす．
+  while ( !cedge.is_one() && cedge.node()->level() < top ) {
+    cedge = cedge.node()->edge1();
+  }
+  if ( cedge.is_one() ) {
+    return mIteOp.and_step(left, right);
+  }
+
+  DdEdge result;
+  if ( find_result(BddOp3Code::AndExist, left, right, cedge, result) ) {
+    return result;
+  }
+
+  DdEdge left0, left1;
+  DdEdge right0, right1;
+  decomp(left, right, left0, left1, right0, right1);
+  auto cnode = cedge.node();
+  if ( cnode->level() == top ) {
+    auto cedge1 = cnode->edge1();
+    auto ans0 = and_exist_step(left0, right0, cedge1);
+    if ( ans0.is_one() ) {
+      // 残りを計算するまでもない．
+      result = DdEdge::one();
+    }
+    else {
+      auto ans1 = and_exist_step(left1, right1, cedge1);
+      result = mIteOp.or_step(ans0, ans1);
+    }
+  }
+  else {
+    auto ans0 = and_exist_step(left0, right0, cedge);
+    auto ans1 = and_exist_step(left1, right1, cedge);
+    result = new_node(top, ans0, ans1);
+  }
+  put_result(BddOp3Code::AndExist, left, right, cedge, result);
+  return result;
+}
+
+END_NAMESPACE_YM_DD
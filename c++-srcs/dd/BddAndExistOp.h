@@ -0,0 +1,74 @@
+#ifndef BDDANDEXISTOP_H
+#define BDDANDEXISTOP_H
+
+/// @file BddAndExistOp.h
+/// @brief BddAndExistOp のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "BddOpBase.h"
+#include "BddIteOp.h"
+#include "BddExistOp.h"
+#include "DdEdge.h"
+
+
+BEGIN_NAMESPACE_YM_DD
+
+//////////////////////////////////////////////////////////////////////
+/// @class BddAndExistOp BddAndExistOp.h "BddAndExistOp.h"
+/// @brief 論理積と存在量化を同時に行うクラス
+///
+/// ∃V.(f ∧ g) を論理積の結果を作らずに計算する．
+/// いわゆる relational product で，像計算の中心となる演算．
+//////////////////////////////////////////////////////////////////////
+class BddAndExistOp :
+  public BddOpBase
+{
+public:
+
+  /// @brief コンストラクタ
+  BddAndExistOp(
+    BddMgrImpl* mgr ///< [in] マネージャ
+  ) : BddOpBase{mgr},
+      mIteOp{mgr},
+      mExistOp{mgr}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~BddAndExistOp() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 論理積と存在量化を行う．
+  DdEdge
+  and_exist_step(
+    DdEdge left,  ///< [in] 第1オペランド
+    DdEdge right, ///< [in] 第2オペランド
+    DdEdge cedge  ///< [in] 変数集合を表す枝
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // AND/OR 演算用のオブジェクト
+  BddIteOp mIteOp;
+
+  // 存在量化用のオブジェクト
+  BddExistOp mExistOp;
+
+};
+
+END_NAMESPACE_YM_DD
+
+#endif // BDDANDEXISTOP_H
@@ -71,9 +71,9 @@ BddCofactorOp::op_step(
   bool oinv = edge.inv();
   edge.make_positive();
 
-  Apply2Key key{edge, cedge};
-  if ( mTable.count(key) > 0 ) {
-    return mTable.at(key) ^ oinv;
+  DdEdge result;
+  if ( find_result(BddOpCode::Cofactor, edge, cedge, result) ) {
+    return result ^ oinv;
   }
 
   auto node = edge.node();
@@ -84,7 +84,6 @@ BddCofactorOp::op_step(
   auto cnode = cedge.node();
   auto clevel = cnode->level();
   auto cinv = cedge.inv();
-  DdEdge result;
   if ( level == clevel ) {
     auto cedge0 = cnode->edge0() ^ cinv;
     auto cedge1 = cnode->edge1() ^ cinv;
@@ -106,18 +105,19 @@ BddCofactorOp::op_step(
   else { // level > clevel
     auto cedge0 = cnode->edge0() ^ cinv;
     auto cedge1 = cnode->edge1() ^ cinv;
+    DdEdge cedge_next;
     if ( cedge0.is_zero() ) {
-      cedge = cedge1;
+      cedge_next = cedge1;
     }
     else if ( cedge1.is_zero() ) {
-      cedge = cedge0;
+      cedge_next = cedge0;
     }
     else {
       ASSERT_NOT_REACHED;
     }
-    result = op_step(edge, cedge);
+    result = op_step(edge, cedge_next);
   }
-  mTable.emplace(key, result);
+  put_result(BddOpCode::Cofactor, edge, cedge, result);
   return result ^ oinv;
 }
 
@@ -11,7 +11,6 @@
 #include "ym/logic.h"
 #include "BddOpBase.h"
 #include "DdEdge.h"
-#include "Apply2Key.h"
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -48,15 +47,6 @@ public:
     DdEdge cedge  ///< [in] 制約の枝
   );
 
-
-private:
-  //////////////////////////////////////////////////////////////////////
-  // データメンバ
-  //////////////////////////////////////////////////////////////////////
-
-  // 演算結果テーブル
-  std::unordered_map<Apply2Key, DdEdge> mTable;
-
 };
 
 END_NAMESPACE_YM_DD
@@ -38,10 +38,7 @@ BddMgr::copy(
     auto vid = var.id();
     (void) variable(vid);
   }
-  // var_list のレベルを求める．
-  auto level_list = BddVar::conv_to_levellist(var_list);
-  std::sort(level_list.begin(), level_list.end());
-  BddCopyOp op(get(), var_list, level_list);
+  BddCopyOp op(get(), var_list);
   auto edge = op.copy_step(src, 0);
   return _bdd(edge);
 }
@@ -51,6 +48,22 @@ BddMgr::copy(
 // クラス BddCopyOp
 //////////////////////////////////////////////////////////////////////
 
+// @brief コンストラクタ
+BddCopyOp::BddCopyOp(
+  BddMgrImpl* mgr,
+  const std::vector<BddVar>& var_list
+) : BddOpBase{mgr},
+    mVarList{var_list}
+{
+  // 変数のレベルはセーフポイントで変わる可能性があるので
+  // BddOpBase のコンストラクタの後で求める．
+  mLevelList.reserve(var_list.size());
+  for ( auto& var: var_list ) {
+    mLevelList.push_back(mgr->varid_to_level(var.id()));
+  }
+  std::sort(mLevelList.begin(), mLevelList.end());
+}
+
 // @brief コピーする．
 DdEdge
 BddCopyOp::copy_step(
@@ -75,7 +88,7 @@ BddCopyOp::copy_step(
   auto r0 = copy_step(bdd0, pos + 1);
   auto r1 = copy_step(bdd1, pos + 1);
   auto level = mLevelList[pos];
-  auto result = mMgr->new_node(level, r0, r1);
+  auto result = new_node(level, r0, r1);
   mTable.emplace(bdd, result);
   return result;
 }
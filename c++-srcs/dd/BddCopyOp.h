@@ -11,6 +11,7 @@
 #include "ym/logic.h"
 #include "ym/Bdd.h"
 #include "ym/BddVar.h"
+#include "BddOpBase.h"
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -23,20 +24,16 @@ class BddMgrImpl;
 ///
 /// 対象と自分のマネージャが異なるので変数順も異なる可能性がある．
 //////////////////////////////////////////////////////////////////////
-class BddCopyOp
+class BddCopyOp :
+  public BddOpBase
 {
 public:
 
   /// @brief コンストラクタ
   BddCopyOp(
-    BddMgrImpl* mgr,                        ///< [in] マネージャ
-    const std::vector<BddVar>& var_list,    ///< [in] 変数リスト
-    const std::vector<SizeType>& level_list ///< [in] レベルのリスト
-  ) : mMgr{mgr},
-      mVarList{var_list},
-      mLevelList{level_list}
-  {
-  }
+    BddMgrImpl* mgr,                    ///< [in] マネージャ
+    const std::vector<BddVar>& var_list ///< [in] 変数リスト
+  );
 
   /// @brief デストラクタ
   ~BddCopyOp() = default;
@@ -60,9 +57,6 @@ private:
   // データメンバ
   //////////////////////////////////////////////////////////////////////
 
-  // Bddマネージャ
-  BddMgrImpl* mMgr;
-
   // 変数リスト
   std::vector<BddVar> mVarList;
 
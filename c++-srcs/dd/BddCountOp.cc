@@ -0,0 +1,259 @@
+
+/// @file BddCountOp.cc
+/// @brief BddCountOp の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/Bdd.h"
+#include "DdEdge.h"
+#include "DdNode.h"
+#include "BddCountOp.h"
+#include <cmath>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+BEGIN_NONAMESPACE
+
+// nvars がサポートより小さくないか調べる．
+void
+check_nvars(
+  const BddCountOp& op,
+  SizeType nvars
+)
+{
+  if ( op.support_size() > nvars ) {
+    throw std::invalid_argument{"nvars is smaller than the support size"};
+  }
+}
+
+// log2(2^a + 2^b) を求める．
+inline
+double
+log2_sum(
+  double a,
+  double b
+)
+{
+  if ( a < b ) {
+    std::swap(a, b);
+  }
+  if ( std::isinf(b) ) {
+    return a;
+  }
+  return a + std::log2(1.0 + std::exp2(b - a));
+}
+
+END_NONAMESPACE
+
+// @brief 真となる入力割当の数を数える．
+double
+Bdd::minterm_count(
+  SizeType nvars
+) const
+{
+  _check_valid();
+
+  BddCountOp op(root());
+  check_nvars(op, nvars);
+  return op.count_double(nvars);
+}
+
+// @brief 真となる入力割当の数の2を底とする対数を求める．
+double
+Bdd::log2_minterm_count(
+  SizeType nvars
+) const
+{
+  _check_valid();
+
+  BddCountOp op(root());
+  check_nvars(op, nvars);
+  return op.log2_count(nvars);
+}
+
+// @brief 真となる入力割当の数を10進表記の文字列で返す．
+std::string
+Bdd::minterm_count_str(
+  SizeType nvars
+) const
+{
+  _check_valid();
+
+  BddCountOp op(root());
+  check_nvars(op, nvars);
+  return op.count_exact(nvars).to_string();
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス BddCountOp
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+BddCountOp::BddCountOp(
+  DdEdge root
+) : mRoot{root},
+    mCollector{{root}}
+{
+  std::unordered_set<SizeType> level_set;
+  for ( auto node: mCollector.node_list() ) {
+    auto level = node->level();
+    level_set.emplace(level);
+    mBottom = std::max(mBottom, level + 1);
+  }
+  mSupportSize = level_set.size();
+}
+
+// @brief double で数える．
+double
+BddCountOp::count_double(
+  SizeType nvars
+)
+{
+  // 各ノードの密度(1となる割合)を求める．
+  // 否定枝の密度は 1 - (正の枝の密度) となる．
+  auto& node_list = mCollector.node_list();
+  std::vector<double> density(node_list.size());
+  auto get_density = [&](DdEdge edge) -> double {
+    if ( edge.is_zero() ) {
+      return 0.0;
+    }
+    if ( edge.is_one() ) {
+      return 1.0;
+    }
+    auto d = density[node_id(edge)];
+    return edge.inv() ? 1.0 - d : d;
+  };
+  for ( SizeType i = 0; i < node_list.size(); ++ i ) {
+    auto node = node_list[i];
+    auto d0 = get_density(node->edge0());
+    auto d1 = get_density(node->edge1());
+    density[i] = (d0 + d1) * 0.5;
+  }
+  auto d = get_density(mRoot);
+  return std::ldexp(d, static_cast<int>(nvars));
+}
+
+// @brief 数の2を底とする対数を求める．
+double
+BddCountOp::log2_count(
+  SizeType nvars
+)
+{
+  if ( mRoot.is_zero() ) {
+    return -std::numeric_limits<double>::infinity();
+  }
+  if ( mRoot.is_one() ) {
+    return static_cast<double>(nvars);
+  }
+  auto log_density = log2_density_list();
+  auto p = log_density[node_id(mRoot)];
+  auto lp = mRoot.inv() ? p.second : p.first;
+  if ( std::isinf(lp) ) {
+    return lp;
+  }
+  return lp + static_cast<double>(nvars);
+}
+
+// @brief 各ノードの密度の対数を求める．
+std::vector<std::pair<double, double>>
+BddCountOp::log2_density_list()
+{
+  // 各ノードについて自身と否定の密度の対数を求める．
+  // 密度は非常に小さくなりうるので対数で表す．
+  auto& node_list = mCollector.node_list();
+  const double NEG_INF = -std::numeric_limits<double>::infinity();
+  std::vector<std::pair<double, double>> log_density(node_list.size());
+  auto get_log_density = [&](DdEdge edge) -> std::pair<double, double> {
+    if ( edge.is_zero() ) {
+      return {NEG_INF, 0.0};
+    }
+    if ( edge.is_one() ) {
+      return {0.0, NEG_INF};
+    }
+    auto p = log_density[node_id(edge)];
+    if ( edge.inv() ) {
+      std::swap(p.first, p.second);
+    }
+    return p;
+  };
+  for ( SizeType i = 0; i < node_list.size(); ++ i ) {
+    auto node = node_list[i];
+    auto p0 = get_log_density(node->edge0());
+    auto p1 = get_log_density(node->edge1());
+    auto lp = log2_sum(p0.first, p1.first) - 1.0;
+    auto ln = log2_sum(p0.second, p1.second) - 1.0;
+    log_density[i] = {lp, ln};
+  }
+  return log_density;
+}
+
+// @brief 厳密に数える．
+DdBigUint
+BddCountOp::count_exact(
+  SizeType nvars
+)
+{
+  // 各ノードについて [level, mBottom) のレベルの変数に対する
+  // 最小項の数を求める．
+  // 否定枝の値は 2^(mBottom - level) - (正の枝の値) となる．
+  auto& node_list = mCollector.node_list();
+  std::vector<DdBigUint> count_array(node_list.size());
+  auto get_count = [&](DdEdge edge) -> DdBigUint {
+    if ( edge.is_zero() ) {
+      return DdBigUint{0};
+    }
+    if ( edge.is_one() ) {
+      return DdBigUint{1};
+    }
+    auto& c = count_array[node_id(edge)];
+    if ( edge.inv() ) {
+      auto level = edge.node()->level();
+      auto ans = DdBigUint::pow2(mBottom - level);
+      ans -= c;
+      return ans;
+    }
+    return c;
+  };
+  for ( SizeType i = 0; i < node_list.size(); ++ i ) {
+    auto node = node_list[i];
+    auto level = node->level();
+    auto edge0 = node->edge0();
+    auto edge1 = node->edge1();
+    auto c0 = get_count(edge0);
+    c0 <<= edge_level(edge0) - level - 1;
+    auto c1 = get_count(edge1);
+    c1 <<= edge_level(edge1) - level - 1;
+    c0 += c1;
+    count_array[i] = std::move(c0);
+  }
+  auto ans = get_count(mRoot);
+  // この時点で ans は [0, mBottom) のレベルの変数に対する数
+  ans <<= edge_level(mRoot);
+  if ( nvars >= mBottom ) {
+    ans <<= nvars - mBottom;
+  }
+  else {
+    // [0, mBottom) のうちサポートでない変数の分だけ
+    // 2のべき乗の倍数になっているので割り切れる．
+    ans >>= mBottom - nvars;
+  }
+  return ans;
+}
+
+// @brief 枝のレベルを返す．
+SizeType
+BddCountOp::edge_level(
+  DdEdge edge
+) const
+{
+  if ( edge.is_const() ) {
+    return mBottom;
+  }
+  return edge.node()->level();
+}
+
+END_NAMESPACE_YM_DD
@@ -0,0 +1,155 @@
+#ifndef BDDCOUNTOP_H
+#define BDDCOUNTOP_H
+
+/// @file BddCountOp.h
+/// @brief BddCountOp のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "DdEdge.h"
+#include "DdBigUint.h"
+#include "NodeCollector.h"
+
+
+BEGIN_NAMESPACE_YM_DD
+
+//////////////////////////////////////////////////////////////////////
+/// @class BddCountOp BddCountOp.h "BddCountOp.h"
+/// @brief BDD の真となる入力割当(最小項)の数を数える．
+///
+/// NodeCollector で子供が先に来る順にノードを並べて
+/// 各ノードの値を順に求める．再帰を用いないので深いBDDでも
+/// スタックはあふれない．
+/// 否定枝の値は正の枝の値から求められるので
+/// ノードごとに正の枝の値のみを記録する．
+///
+/// 次の3種類の数え方がある．
+/// - count_double(): 密度(真となる割合)を double で求める．
+/// - log2_count():   密度の2を底とする対数を求める．
+/// - count_exact():  多倍長整数で厳密に求める．
+//////////////////////////////////////////////////////////////////////
+class BddCountOp
+{
+public:
+
+  /// @brief コンストラクタ
+  BddCountOp(
+    DdEdge root ///< [in] 根の枝
+  );
+
+  /// @brief デストラクタ
+  ~BddCountOp() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief サポート変数の数を返す．
+  SizeType
+  support_size() const
+  {
+    return mSupportSize;
+  }
+
+  /// @brief double で数える．
+  ///
+  /// 2^nvars が double で表せない場合には無限大となる．
+  double
+  count_double(
+    SizeType nvars ///< [in] 変数の数
+  );
+
+  /// @brief 数の2を底とする対数を求める．
+  ///
+  /// 数が 0 の場合には -inf を返す．
+  double
+  log2_count(
+    SizeType nvars ///< [in] 変数の数
+  );
+
+  /// @brief 厳密に数える．
+  DdBigUint
+  count_exact(
+    SizeType nvars ///< [in] 変数の数
+  );
+
+  /// @brief 各ノードの密度の対数を求める．
+  /// @return (自身の密度の対数, 否定の密度の対数) のリストを返す．
+  ///
+  /// 結果は node_list() と同じ順に並んでいる．
+  std::vector<std::pair<double, double>>
+  log2_density_list();
+
+  /// @brief ノードのリストを返す．
+  ///
+  /// 子供のノードは親のノードより前にある．
+  const std::vector<const DdNode*>&
+  node_list() const
+  {
+    return mCollector.node_list();
+  }
+
+  /// @brief ノード番号を返す．
+  ///
+  /// node_list() 中の位置を返す．
+  SizeType
+  node_id(
+    DdEdge edge ///< [in] 枝(定数ではないこと)
+  ) const
+  {
+    return mCollector.edge2int(edge) / 2 - 1;
+  }
+
+  /// @brief 枝を整数値に変換する．
+  ///
+  /// 定数0は 0, 定数1は 1, それ以外は
+  /// (node_id() + 1) * 2 + (反転属性) となる．
+  SizeType
+  edge2int(
+    DdEdge edge ///< [in] 枝
+  ) const
+  {
+    return mCollector.edge2int(edge);
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 枝のレベルを返す．
+  ///
+  /// 定数の場合は mBottom を返す．
+  SizeType
+  edge_level(
+    DdEdge edge ///< [in] 枝
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 根の枝
+  DdEdge mRoot;
+
+  // ノードを集めたもの
+  NodeCollector mCollector;
+
+  // ノードの最大レベル + 1
+  SizeType mBottom{0};
+
+  // サポート変数の数
+  SizeType mSupportSize{0};
+
+};
+
+END_NAMESPACE_YM_DD
+
+#endif // BDDCOUNTOP_H
@@ -0,0 +1,143 @@
+
+/// @file BddExistOp.cc
+/// @brief BddExistOp の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/Bdd.h"
+#include "ym/BddVarSet.h"
+#include "BddExistOp.h"
+
+
+BEGIN_NAMESPACE_YM_DD
+
+// @brief 存在量化を行う．
+Bdd
+Bdd::exist(
+  const BddVarSet& var_set
+) const
+{
+  auto edge = _exist(var_set);
+  return _bdd(edge);
+}
+
+// @brief 存在量化を行って代入する．
+Bdd&
+Bdd::exist_int(
+  const BddVarSet& var_set
+)
+{
+  auto edge = _exist(var_set);
+  _change_root(edge);
+  return *this;
+}
+
+// @brief 全称量化を行う．
+Bdd
+Bdd::forall(
+  const BddVarSet& var_set
+) const
+{
+  auto edge = _forall(var_set);
+  return _bdd(edge);
+}
+
+// @brief 全称量化を行って代入する．
+Bdd&
+Bdd::forall_int(
+  const BddVarSet& var_set
+)
+{
+  auto edge = _forall(var_set);
+  _change_root(edge);
+  return *this;
+}
+
+// @brief 存在量化の下請け関数
+DdEdge
+Bdd::_exist(
+  const BddVarSet& var_set
+) const
+{
+  auto cube = var_set.bdd();
+  _check_valid_mgr(cube);
+  BddExistOp op(get());
+  auto edge = op.exist_step(root(), cube.root());
+  return edge;
+}
+
+// @brief 全称量化の下請け関数
+DdEdge
+Bdd::_forall(
+  const BddVarSet& var_set
+) const
+{
+  auto cube = var_set.bdd();
+  _check_valid_mgr(cube);
+  BddExistOp op(get());
+  auto edge = op.forall_step(root(), cube.root());
+  return edge;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス BddExistOp
+//////////////////////////////////////////////////////////////////////
+
+// @brief 存在量化を行う．
+DdEdge
+BddExistOp::exist_step(
+  DdEdge edge,
+  DdEdge cedge
+)
+{
+  // 終端ならそのまま返す．
+  if ( edge.is_const() ) {
+    return edge;
+  }
+
+  auto node = edge.node();
+  auto level = node->level();
+
+  // edge の根より上にある変数は無関係なので読み飛ばす．
+  while ( !cedge.is_one() && cedge.node()->level() < level ) {
+    cedge = cedge.node()->edge1();
+  }
+  // 変数集合が空ならそのまま返す．
+  if ( cedge.is_one() ) {
+    return edge;
+  }
+
+  DdEdge result;
+  if ( find_result(BddOpCode::Exist, edge, cedge, result) ) {
+    return result;
+  }
+
+  auto inv = edge.inv();
+  auto edge0 = node->edge0() ^ inv;
+  auto edge1 = node->edge1() ^ inv;
+  auto cnode = cedge.node();
+  if ( cnode->level() == level ) {
+    auto cedge1 = cnode->edge1();
+    auto ans0 = exist_step(edge0, cedge1);
+    if ( ans0.is_one() ) {
+      // 残りを計算するまでもない．
+      result = DdEdge::one();
+    }
+    else {
+      auto ans1 = exist_step(edge1, cedge1);
+      result = mIteOp.or_step(ans0, ans1);
+    }
+  }
+  else {
+    auto ans0 = exist_step(edge0, cedge);
+    auto ans1 = exist_step(edge1, cedge);
+    result = new_node(level, ans0, ans1);
+  }
+  put_result(BddOpCode::Exist, edge, cedge, result);
+  return result;
+}
+
+END_NAMESPACE_YM_DD
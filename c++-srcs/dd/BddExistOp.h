@@ -0,0 +1,79 @@
+#ifndef BDDEXISTOP_H
+#define BDDEXISTOP_H
+
+/// @file BddExistOp.h
+/// @brief BddExistOp のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "BddOpBase.h"
+#include "BddIteOp.h"
+#include "DdEdge.h"
+
+
+BEGIN_NAMESPACE_YM_DD
+
+//////////////////////////////////////////////////////////////////////
+/// @class BddExistOp BddExistOp.h "BddExistOp.h"
+/// @brief 存在量化を行うクラス
+///
+/// 量化する変数の集合は正リテラルのキューブ(BddVarSet の根の枝)で表す．
+/// 全称量化は双対性を用いて存在量化で計算する．
+//////////////////////////////////////////////////////////////////////
+class BddExistOp :
+  public BddOpBase
+{
+public:
+
+  /// @brief コンストラクタ
+  BddExistOp(
+    BddMgrImpl* mgr ///< [in] マネージャ
+  ) : BddOpBase{mgr},
+      mIteOp{mgr}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~BddExistOp() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 存在量化を行う．
+  DdEdge
+  exist_step(
+    DdEdge edge, ///< [in] 対象の枝
+    DdEdge cedge ///< [in] 変数集合を表す枝
+  );
+
+  /// @brief 全称量化を行う．
+  DdEdge
+  forall_step(
+    DdEdge edge, ///< [in] 対象の枝
+    DdEdge cedge ///< [in] 変数集合を表す枝
+  )
+  {
+    // ∀x.f = ¬∃x.¬f
+    return ~exist_step(~edge, cedge);
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // OR 演算用のオブジェクト
+  BddIteOp mIteOp;
+
+};
+
+END_NAMESPACE_YM_DD
+
+#endif // BDDEXISTOP_H
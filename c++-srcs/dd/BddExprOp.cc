@@ -40,8 +40,8 @@ BddMgr::from_expr(
     }
   }
 
-  auto level_list = BddVar::conv_to_levellist(tmp_var_list);
-  BddExprOp op(get(), level_list);
+  auto edge_list = BddVar::conv_to_edgelist(tmp_var_list);
+  BddExprOp op(get(), edge_list);
   auto edge = op.op_step(expr);
   return _bdd(edge);
 }
@@ -67,12 +67,7 @@ BddExprOp::op_step(
     auto lit = expr.literal();
     auto varid = lit.varid();
     auto inv = lit.is_negative();
-    auto level = mLevelList[varid];
-    auto ans = new_node(level, DdEdge::zero(), DdEdge::one());
-    if ( inv ) {
-      ans = ~ans;
-    }
-    return ans;
+    return mVarList[varid] ^ inv;
   }
   if ( expr.is_and() ) {
     auto ans_edge = DdEdge::one();
@@ -25,9 +25,9 @@ public:
   /// @brief コンストラクタ
   BddExprOp(
     BddMgrImpl* mgr,                        ///< [in] マネージャ
-    const std::vector<SizeType>& index_list ///< [in] インデックスリスト
+    const std::vector<DdEdge>& var_list ///< [in] 変数(を表す枝)のリスト
   ) : BddIteOp{mgr},
-      mLevelList{index_list}
+      mVarList{var_list}
   {
   }
 
@@ -52,8 +52,9 @@ private:
   // データメンバ
   //////////////////////////////////////////////////////////////////////
 
-  // インデックスリスト
-  std::vector<SizeType> mLevelList;
+  // 変数(を表す枝)のリスト
+  // 変数順が変わってもノードは変わらないのでレベルではなく枝を持つ．
+  std::vector<DdEdge> mVarList;
 
 };
 
@@ -0,0 +1,268 @@
+
+/// @file BddImage.cc
+/// @brief BddImage の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/BddImage.h"
+#include "ym/Bdd.h"
+#include "BddMgrImpl.h"
+#include "DdInfoMgr.h"
+#include <cmath>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+BEGIN_NONAMESPACE
+
+// シグネチャ
+const std::uint64_t IMAGE_SIG = 0x31696464625f6d79ULL; // "ym_bddi1"
+
+// バイトオーダの印
+const std::uint64_t BYTE_ORDER_MARK = 0x0102030405060708ULL;
+
+// ヘッダのワード数
+const SizeType HEADER_SIZE = 8;
+
+// 1ワードを書き出す．
+inline
+void
+write_word(
+  std::ostream& s,
+  std::uint64_t word
+)
+{
+  s.write(reinterpret_cast<const char*>(&word), sizeof(word));
+}
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス BddImage
+//////////////////////////////////////////////////////////////////////
+
+// @brief ファイルをマップするコンストラクタ
+BddImage::BddImage(
+  const std::string& filename
+)
+{
+  auto fd = ::open(filename.c_str(), O_RDONLY);
+  if ( fd < 0 ) {
+    throw std::invalid_argument{"BddImage: cannot open " + filename};
+  }
+  struct stat st;
+  if ( ::fstat(fd, &st) < 0 ) {
+    ::close(fd);
+    throw std::invalid_argument{"BddImage: cannot stat " + filename};
+  }
+  mSize = static_cast<SizeType>(st.st_size);
+  if ( mSize < HEADER_SIZE * sizeof(std::uint64_t) ) {
+    ::close(fd);
+    throw std::invalid_argument{"BddImage: wrong format"};
+  }
+  auto addr = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  // マップした後はファイルを閉じてもよい．
+  ::close(fd);
+  if ( addr == MAP_FAILED ) {
+    throw std::invalid_argument{"BddImage: cannot map " + filename};
+  }
+  mAddr = addr;
+
+  mHeader = static_cast<const std::uint64_t*>(mAddr);
+  if ( mHeader[0] != IMAGE_SIG || mHeader[1] != BYTE_ORDER_MARK ) {
+    ::munmap(mAddr, mSize);
+    throw std::invalid_argument{"BddImage: wrong signature"};
+  }
+  auto nw = HEADER_SIZE + variable_num() + root_num() + node_num() * 3;
+  if ( nw * sizeof(std::uint64_t) != mSize ) {
+    ::munmap(mAddr, mSize);
+    throw std::invalid_argument{"BddImage: wrong size"};
+  }
+  mVarIdArray = mHeader + HEADER_SIZE;
+  mRootArray = mVarIdArray + variable_num();
+  mNodeArray = mRootArray + root_num();
+}
+
+// @brief ムーブコンストラクタ
+BddImage::BddImage(
+  BddImage&& src
+) : mAddr{src.mAddr},
+    mSize{src.mSize},
+    mHeader{src.mHeader},
+    mVarIdArray{src.mVarIdArray},
+    mRootArray{src.mRootArray},
+    mNodeArray{src.mNodeArray}
+{
+  src.mAddr = nullptr;
+  src.mSize = 0;
+}
+
+// @brief デストラクタ
+BddImage::~BddImage()
+{
+  if ( mAddr != nullptr ) {
+    ::munmap(mAddr, mSize);
+  }
+}
+
+// @brief BDD のリストをイメージの形式で書き出す．
+void
+BddImage::write(
+  std::ostream& s,
+  const std::vector<Bdd>& bdd_list
+)
+{
+  DdInfoMgr info_mgr;
+  if ( !bdd_list.empty() ) {
+    auto mgr = Bdd::_mgr(bdd_list);
+    auto edge_list = Bdd::_conv_to_edgelist(bdd_list);
+    info_mgr = DdInfoMgr{edge_list, mgr};
+  }
+
+  // ヘッダ
+  write_word(s, IMAGE_SIG);
+  write_word(s, BYTE_ORDER_MARK);
+  write_word(s, info_mgr.max_level());
+  write_word(s, info_mgr.root_list().size());
+  write_word(s, info_mgr.node_num());
+  for ( SizeType i = 5; i < HEADER_SIZE; ++ i ) {
+    write_word(s, 0);
+  }
+
+  // 変数順
+  for ( SizeType level = 0; level < info_mgr.max_level(); ++ level ) {
+    write_word(s, info_mgr.level_to_varid(level));
+  }
+
+  // 根の枝
+  for ( auto root: info_mgr.root_list() ) {
+    write_word(s, root);
+  }
+
+  // ノード
+  for ( auto& node: info_mgr.node_list() ) {
+    write_word(s, node.level());
+    write_word(s, node.edge0());
+    write_word(s, node.edge1());
+  }
+}
+
+// @brief BDD のリストをイメージの形式でファイルに書き出す．
+void
+BddImage::write(
+  const std::string& filename,
+  const std::vector<Bdd>& bdd_list
+)
+{
+  std::ofstream s{filename, std::ios::binary};
+  if ( !s ) {
+    throw std::invalid_argument{"BddImage: cannot open " + filename};
+  }
+  write(s, bdd_list);
+}
+
+// @brief 評価を行う．
+bool
+BddImage::eval(
+  SizeType pos,
+  const std::vector<bool>& inputs
+) const
+{
+  auto edge = root(pos);
+  bool inv = false;
+  while ( edge > 1 ) {
+    auto id = edge >> 1;
+    inv ^= static_cast<bool>(edge & 1);
+    auto node = _node(id);
+    auto varid = level_to_varid(node[0]);
+    auto next = inputs.at(varid) ? node[2] : node[1];
+    _check_child(id, next);
+    edge = next;
+  }
+  return (edge == 1) != inv;
+}
+
+// @brief 真となる入力割当の数を数える．
+double
+BddImage::minterm_count(
+  SizeType pos,
+  SizeType nvars
+) const
+{
+  // 根から到達可能なノードは根のノード番号以下なので
+  // その範囲で子供から順に密度(1となる割合)を求める．
+  // 否定枝の密度は 1 - (正の枝の密度) となる．
+  auto root_edge = root(pos);
+  auto n = root_edge >> 1;
+  std::vector<double> density(n + 1);
+  auto get_density = [&](SizeType edge) -> double {
+    if ( edge <= 1 ) {
+      return static_cast<double>(edge);
+    }
+    auto d = density[edge >> 1];
+    return (edge & 1) ? 1.0 - d : d;
+  };
+  for ( SizeType id = 1; id <= n; ++ id ) {
+    auto node = _node(id);
+    _check_child(id, node[1]);
+    _check_child(id, node[2]);
+    density[id] = (get_density(node[1]) + get_density(node[2])) * 0.5;
+  }
+  return std::ldexp(get_density(root_edge), static_cast<int>(nvars));
+}
+
+// @brief 定数1に至る経路を列挙する．
+void
+BddImage::for_each_path(
+  SizeType pos,
+  std::function<bool(const std::vector<Literal>&)> func
+) const
+{
+  struct Frame {
+    SizeType mEdge;   // 枝
+    bool mInv;        // それまでの反転属性
+    SizeType mDepth;  // この枝に至るまでのリテラル数
+    Literal mLit;     // この枝に至るリテラル
+  };
+
+  std::vector<Literal> lit_list;
+  std::vector<Frame> stack;
+  stack.push_back({root(pos), false, 0, Literal::x()});
+  while ( !stack.empty() ) {
+    auto frame = stack.back();
+    stack.pop_back();
+    lit_list.resize(frame.mDepth);
+    if ( frame.mLit != Literal::x() ) {
+      lit_list.push_back(frame.mLit);
+    }
+    auto edge = frame.mEdge;
+    auto inv = frame.mInv;
+    if ( edge <= 1 ) {
+      if ( (edge == 1) != inv ) {
+	if ( !func(lit_list) ) {
+	  return;
+	}
+      }
+      continue;
+    }
+    auto id = edge >> 1;
+    inv ^= static_cast<bool>(edge & 1);
+    auto node = _node(id);
+    _check_child(id, node[1]);
+    _check_child(id, node[2]);
+    auto varid = level_to_varid(node[0]);
+    auto depth = lit_list.size();
+    // 0枝を先に調べるように 1枝から積む．
+    stack.push_back({node[2], inv, depth, Literal{varid, false}});
+    stack.push_back({node[1], inv, depth, Literal{varid, true}});
+  }
+}
+
+END_NAMESPACE_YM_DD
@@ -74,39 +74,282 @@ Bdd::ite(
 }
 
 
+BEGIN_NONAMESPACE
+
+// and_iter(), xor_iter() で用いるフレーム
+struct Frame2
+{
+  // 正規化されたオペランド
+  DdEdge mLeft;
+  DdEdge mRight;
+
+  // 先頭の変数で分解した結果
+  DdEdge mLeft0;
+  DdEdge mLeft1;
+  DdEdge mRight0;
+  DdEdge mRight1;
+
+  // 0枝側の結果
+  DdEdge mAns0;
+
+  // 先頭のレベル
+  SizeType mTop;
+
+  // 出力の反転フラグ(XOR のみ)
+  bool mOinv;
+
+  // 状態
+  // 0: 未処理
+  // 1: 0枝側の結果待ち
+  // 2: 1枝側の結果待ち
+  int mState;
+};
+
+// ite_iter() で用いるフレーム
+struct Frame3
+{
+  // 正規化されたオペランド
+  DdEdge mE0;
+  DdEdge mE1;
+  DdEdge mE2;
+
+  // 先頭の変数で分解した結果
+  DdEdge mE00;
+  DdEdge mE01;
+  DdEdge mE10;
+  DdEdge mE11;
+  DdEdge mE20;
+  DdEdge mE21;
+
+  // 0枝側の結果
+  DdEdge mAns0;
+
+  // 先頭のレベル
+  SizeType mTop;
+
+  // 状態(Frame2 と同じ)
+  int mState;
+};
+
+// スレッドごとの作業用スタック
+thread_local std::vector<Frame2> and_stack;
+thread_local std::vector<Frame2> xor_stack;
+thread_local std::vector<Frame3> ite_stack;
+
+// 枝を指定したレベルで分解する．
+inline
+void
+decomp1(
+  DdEdge edge,
+  SizeType top,
+  DdEdge& edge0,
+  DdEdge& edge1
+)
+{
+  auto node = edge.node();
+  if ( node->level() == top ) {
+    auto inv = edge.inv();
+    edge0 = node->edge0() ^ inv;
+    edge1 = node->edge1() ^ inv;
+  }
+  else {
+    edge0 = edge1 = edge;
+  }
+}
+
+// 二項演算用のフレームを積む．
+inline
+void
+push_frame2(
+  std::vector<Frame2>& stack,
+  DdEdge left,
+  DdEdge right,
+  bool oinv
+)
+{
+  Frame2 frame;
+  frame.mLeft = left;
+  frame.mRight = right;
+  frame.mTop = BddMgrImpl::decomp(left, right,
+				  frame.mLeft0, frame.mLeft1,
+				  frame.mRight0, frame.mRight1);
+  frame.mOinv = oinv;
+  frame.mState = 0;
+  stack.push_back(frame);
+}
+
+// ITE 演算用のフレームを積む．
+inline
+void
+push_frame3(
+  std::vector<Frame3>& stack,
+  DdEdge e0,
+  DdEdge e1,
+  DdEdge e2
+)
+{
+  Frame3 frame;
+  frame.mE0 = e0;
+  frame.mE1 = e1;
+  frame.mE2 = e2;
+  auto level0 = e0.node()->level();
+  auto level1 = e1.node()->level();
+  auto level2 = e2.node()->level();
+  auto top = std::min(std::min(level0, level1), level2);
+  decomp1(e0, top, frame.mE00, frame.mE01);
+  decomp1(e1, top, frame.mE10, frame.mE11);
+  decomp1(e2, top, frame.mE20, frame.mE21);
+  frame.mTop = top;
+  frame.mState = 0;
+  stack.push_back(frame);
+}
+
+END_NONAMESPACE
+
+
 //////////////////////////////////////////////////////////////////////
 // クラス BddIteOP
 //////////////////////////////////////////////////////////////////////
 
+// @brief AND 演算を行う．
 DdEdge
 BddIteOp::and_step(
   DdEdge left,
   DdEdge right
 )
 {
-  // trivial case のチェック
+  DdEdge result;
+  if ( and_terminal(left, right, result) ) {
+    return result;
+  }
+
+  if ( !can_par() ) {
+    return and_iter(left, right);
+  }
+
+  // 並列に apply 演算を行う．
+  // 先頭のインデックスで分解する．
+  DdEdge left0, left1;
+  DdEdge right0, right1;
+  auto top = decomp(
+    left, right,
+    left0, left1,
+    right0, right1
+  );
+  DdEdge ans0, ans1;
+  par_do([&](){ ans0 = and_step(left0, right0); },
+	 [&](){ ans1 = and_step(left1, right1); });
+  result = new_node(top, ans0, ans1);
+  put_result(left, right, DdEdge::zero(), result);
+  return result;
+}
+
+// @brief XOR 演算を行う．
+DdEdge
+BddIteOp::xor_step(
+  DdEdge left,
+  DdEdge right
+)
+{
+  bool oinv;
+  DdEdge result;
+  if ( xor_terminal(left, right, oinv, result) ) {
+    return result;
+  }
+
+  if ( !can_par() ) {
+    return xor_iter(left, right, oinv);
+  }
+
+  // 並列に apply 演算を行う．
+  // 先頭のインデックスで分解する．
+  DdEdge left0, left1;
+  DdEdge right0, right1;
+  auto top = decomp(
+    left, right,
+    left0, left1,
+    right0, right1
+  );
+  DdEdge ans0, ans1;
+  par_do([&](){ ans0 = xor_step(left0, right0); },
+	 [&](){ ans1 = xor_step(left1, right1); });
+  result = new_node(top, ans0, ans1);
+  put_result(left, ~right, right, result);
+  return result ^ oinv;
+}
+
+// @brief ITE 演算を行う．
+DdEdge
+BddIteOp::ite_step(
+  DdEdge e0,
+  DdEdge e1,
+  DdEdge e2
+)
+{
+  DdEdge result;
+  if ( ite_terminal(e0, e1, e2, result) ) {
+    return result;
+  }
+
+  if ( !can_par() ) {
+    return ite_iter(e0, e1, e2);
+  }
+
+  // 並列に apply 演算を行う．
+  // e0, e1, e2 をトップの変数で分解する．
+  auto level0 = e0.node()->level();
+  auto level1 = e1.node()->level();
+  auto level2 = e2.node()->level();
+  auto top = std::min(std::min(level0, level1), level2);
+  DdEdge e00, e01;
+  decomp1(e0, top, e00, e01);
+  DdEdge e10, e11;
+  decomp1(e1, top, e10, e11);
+  DdEdge e20, e21;
+  decomp1(e2, top, e20, e21);
+
+  DdEdge r0, r1;
+  par_do([&](){ r0 = ite_step(e00, e10, e20); },
+	 [&](){ r1 = ite_step(e01, e11, e21); });
+  result = new_node(top, r0, r1);
+  put_result(e0, e1, e2, result);
+  return result;
+}
 
+// @brief AND 演算の自明な場合の処理と演算結果テーブルの検索を行う．
+bool
+BddIteOp::and_terminal(
+  DdEdge& left,
+  DdEdge& right,
+  DdEdge& result
+)
+{
   // case 1: 片方が 0 なら 0 を返す．
   if ( left.is_zero() || right.is_zero() ) {
-    return DdEdge::zero();
+    result = DdEdge::zero();
+    return true;
   }
 
   // case 2: 片方が 1 なら他方を返す．
   if ( left.is_one() ) {
-    return right;
+    result = right;
+    return true;
   }
   if ( right.is_one() ) {
-    return left;
+    result = left;
+    return true;
   }
 
   // case 3: 等しかったらそのまま返す．
   if ( left == right ) {
-    return left;
+    result = left;
+    return true;
   }
 
   // case 4: 極性違いで等しかったら 0 を返す．
   if ( left.node() == right.node() ) {
-    return DdEdge::zero();
+    result = DdEdge::zero();
+    return true;
   }
 
   // 正規化を行う．
@@ -115,64 +358,52 @@ BddIteOp::and_step(
   }
 
   // 演算結果テーブルを調べる．
-  Apply3Key key{left, right, DdEdge::zero()};
-  if ( mTable.count(key) > 0 ) {
-    return mTable.at(key);
-  }
-
-  // 見つからなかったので実際に apply 演算を行う．
-  // 先頭のインデックスで分解する．
-  DdEdge left0, left1;
-  DdEdge right0, right1;
-  auto top = decomp(
-    left, right,
-    left0, left1,
-    right0, right1
-  );
-  auto ans0 = and_step(left0, right0);
-  auto ans1 = and_step(left1, right1);
-  auto result = new_node(top, ans0, ans1);
-  mTable.emplace(key, result);
-  return result;
+  return find_result(left, right, DdEdge::zero(), result);
 }
 
-// @brief XOR 演算を行う．
-DdEdge
-BddIteOp::xor_step(
-  DdEdge left,
-  DdEdge right
+// @brief XOR 演算の自明な場合の処理と演算結果テーブルの検索を行う．
+bool
+BddIteOp::xor_terminal(
+  DdEdge& left,
+  DdEdge& right,
+  bool& oinv,
+  DdEdge& result
 )
 {
-  // trivial case のチェック
-
   // case 1: 片方が 0 なら他方を返す．
   if ( left.is_zero() ) {
-    return right;
+    result = right;
+    return true;
   }
   if ( right.is_zero() ) {
-    return left;
+    result = left;
+    return true;
   }
 
   // case 2: 片方が 1 なら他方の否定を返す．
   if ( left.is_one() ) {
-    return ~right;
+    result = ~right;
+    return true;
   }
   if ( right.is_one() ) {
-    return ~left;
+    result = ~left;
+    return true;
   }
 
   // case 3: 等しかったら 0 を返す．
   if ( left == right ) {
-    return DdEdge::zero();
+    result = DdEdge::zero();
+    return true;
   }
 
   // case 4: 極性違いで等しかったら 1 を返す．
   if ( left.node() == right.node() ) {
-    return DdEdge::one();
+    result = DdEdge::one();
+    return true;
   }
 
   // 正規化を行う．
-  bool oinv = left.inv() ^ right.inv();
+  oinv = left.inv() ^ right.inv();
   left.make_positive();
   right.make_positive();
   if ( left.body() > right.body() ) {
@@ -180,83 +411,81 @@ BddIteOp::xor_step(
   }
 
   // 演算結果テーブルを調べる．
-  Apply3Key key{left, ~right, right};
-  if ( mTable.count(key) > 0 ) {
-    return mTable.at(key) ^ oinv;
+  if ( find_result(left, ~right, right, result) ) {
+    result ^= oinv;
+    return true;
   }
-  // 見つからなかったので実際に apply 演算を行う．
-  // 先頭のインデックスで分解する．
-  DdEdge left0, left1;
-  DdEdge right0, right1;
-  auto top = decomp(
-    left, right,
-    left0, left1,
-    right0, right1
-  );
-  auto ans0 = xor_step(left0, right0);
-  auto ans1 = xor_step(left1, right1);
-  auto result = new_node(top, ans0, ans1);
-  mTable.emplace(key, result);
-  return result ^ oinv;
+  return false;
 }
 
-// @brief ITE 演算を行う．
-DdEdge
-BddIteOp::ite_step(
-  DdEdge e0,
-  DdEdge e1,
-  DdEdge e2
+// @brief ITE 演算の自明な場合の処理と演算結果テーブルの検索を行う．
+bool
+BddIteOp::ite_terminal(
+  DdEdge& e0,
+  DdEdge& e1,
+  DdEdge& e2,
+  DdEdge& result
 )
 {
-  // trivial cases
-
   // e0 が定数なら答は決まっている．
   if ( e0.is_zero() ) {
-    return e2;
+    result = e2;
+    return true;
   }
   if ( e0.is_one() ) {
-    return e1;
+    result = e1;
+    return true;
   }
   // e1 が 0 の時は ~e0 & e2 となる．
   if ( e1.is_zero() ) {
-    return and_step(~e0, e2);
+    result = and_step(~e0, e2);
+    return true;
   }
   // e1 が 1 の時は e0 | e2 となる．
   if ( e1.is_one() ) {
-    return or_step(e0, e2);
+    result = or_step(e0, e2);
+    return true;
   }
   // e2 が 0 の時は e0 & e1 となる．
   if ( e2.is_zero() ) {
-    return and_step(e0, e1);
+    result = and_step(e0, e1);
+    return true;
   }
   // e2 が 1 の時は ~e0 | e1 となる．
   if ( e2.is_one() ) {
-    return or_step(~e0, e1);
+    result = or_step(~e0, e1);
+    return true;
   }
 
   // e1 と e2 が等しければ e0 と無関係に e1 を返す．
   if ( e1 == e2 ) {
-    return e1;
+    result = e1;
+    return true;
   }
   // e1 と e2 が相補的であれば e0 と e2 の XOR となる．
   if ( e1 == ~e2 ) {
-    return xor_step(e0, e2);
+    result = xor_step(e0, e2);
+    return true;
   }
   // e0 と e1 が等しければ e0 | e2 となる．
   if ( e0 == e1 ) {
-    return or_step(e0, e2);
+    result = or_step(e0, e2);
+    return true;
   }
   // e0 と e1 が相補的であれば e1 & e2 となる．
   if ( e0 == ~e1 ) {
-    return and_step(e1, e2);
+    result = and_step(e1, e2);
+    return true;
   }
   // e0 と e2 が等しければ e0 & e1 となる．
   if ( e0 == e2 ) {
-    return and_step(e0, e1);
+    result = and_step(e0, e1);
+    return true;
   }
   // e0 と e2 が相補的であれば ~e0 | e1 となる．
   if ( e0 == ~e2 ) {
-    return or_step(~e0, e1);
+    result = or_step(~e0, e1);
+    return true;
   }
 
   // e0 が正極性になるように正規化する．
@@ -264,62 +493,141 @@ BddIteOp::ite_step(
     e0.make_positive();
     std::swap(e1, e2);
   }
-  Apply3Key key{e0, e1, e2};
-  if ( mTable.count(key) > 0 ) {
-    return mTable.at(key);
-  }
-
-  // e0, e1, e2 をトップの変数で分解する．
-
-  auto node0 = e0.node();
-  auto inv0 = e0.inv();
-  auto level0 = node0->level();
-
-  auto node1 = e1.node();
-  auto inv1 = e1.inv();
-  auto level1 = node1->level();
-
-  auto node2 = e2.node();
-  auto inv2 = e2.inv();
-  auto level2 = node2->level();
-
-  auto top = std::min(std::min(level0, level1), level2);
+  return find_result(e0, e1, e2, result);
+}
 
-  // e0 -> e00, e01
-  DdEdge e00, e01;
-  if ( level0 == top ) {
-    e00 = node0->edge0() ^ inv0;
-    e01 = node0->edge1() ^ inv0;
-  }
-  else {
-    e00 = e01 = e0;
+// @brief 明示的なスタックを用いて AND 演算を行う．
+DdEdge
+BddIteOp::and_iter(
+  DdEdge left,
+  DdEdge right
+)
+{
+  auto& stack = and_stack;
+  auto base = stack.size();
+  push_frame2(stack, left, right, false);
+  DdEdge ret;
+  for ( ; ; ) {
+    auto& frame = stack.back();
+    if ( frame.mState == 0 ) {
+      frame.mState = 1;
+      auto left0 = frame.mLeft0;
+      auto right0 = frame.mRight0;
+      if ( !and_terminal(left0, right0, ret) ) {
+	push_frame2(stack, left0, right0, false);
+	continue;
+      }
+    }
+    if ( frame.mState == 1 ) {
+      frame.mAns0 = ret;
+      frame.mState = 2;
+      auto left1 = frame.mLeft1;
+      auto right1 = frame.mRight1;
+      if ( !and_terminal(left1, right1, ret) ) {
+	push_frame2(stack, left1, right1, false);
+	continue;
+      }
+    }
+    // 両方の結果が揃った．
+    ret = new_node(frame.mTop, frame.mAns0, ret);
+    put_result(frame.mLeft, frame.mRight, DdEdge::zero(), ret);
+    stack.pop_back();
+    if ( stack.size() == base ) {
+      return ret;
+    }
   }
+}
 
-  // e1 -> e10, e11
-  DdEdge e10, e11;
-  if ( level1 == top ) {
-    e10 = node1->edge0() ^ inv1;
-    e11 = node1->edge1() ^ inv1;
-  }
-  else {
-    e10 = e11 = e1;
+// @brief 明示的なスタックを用いて XOR 演算を行う．
+DdEdge
+BddIteOp::xor_iter(
+  DdEdge left,
+  DdEdge right,
+  bool oinv
+)
+{
+  auto& stack = xor_stack;
+  auto base = stack.size();
+  push_frame2(stack, left, right, oinv);
+  DdEdge ret;
+  for ( ; ; ) {
+    auto& frame = stack.back();
+    bool oinv1 = false;
+    if ( frame.mState == 0 ) {
+      frame.mState = 1;
+      auto left0 = frame.mLeft0;
+      auto right0 = frame.mRight0;
+      if ( !xor_terminal(left0, right0, oinv1, ret) ) {
+	push_frame2(stack, left0, right0, oinv1);
+	continue;
+      }
+    }
+    if ( frame.mState == 1 ) {
+      frame.mAns0 = ret;
+      frame.mState = 2;
+      auto left1 = frame.mLeft1;
+      auto right1 = frame.mRight1;
+      if ( !xor_terminal(left1, right1, oinv1, ret) ) {
+	push_frame2(stack, left1, right1, oinv1);
+	continue;
+      }
+    }
+    // 両方の結果が揃った．
+    ret = new_node(frame.mTop, frame.mAns0, ret);
+    put_result(frame.mLeft, ~frame.mRight, frame.mRight, ret);
+    ret ^= frame.mOinv;
+    stack.pop_back();
+    if ( stack.size() == base ) {
+      return ret;
+    }
   }
+}
 
-  // e2 -> e20, e21
-  DdEdge e20, e21;
-  if ( level2 == top ) {
-    e20 = node2->edge0() ^ inv2;
-    e21 = node2->edge1() ^ inv2;
-  }
-  else {
-    e20 = e21 = e2;
+// @brief 明示的なスタックを用いて ITE 演算を行う．
+DdEdge
+BddIteOp::ite_iter(
+  DdEdge e0,
+  DdEdge e1,
+  DdEdge e2
+)
+{
+  auto& stack = ite_stack;
+  auto base = stack.size();
+  push_frame3(stack, e0, e1, e2);
+  DdEdge ret;
+  for ( ; ; ) {
+    // ite_terminal() の中で AND/XOR 演算を行うが
+    // それらは別のスタックを用いるので frame は無効にならない．
+    auto& frame = stack.back();
+    if ( frame.mState == 0 ) {
+      frame.mState = 1;
+      auto e00 = frame.mE00;
+      auto e10 = frame.mE10;
+      auto e20 = frame.mE20;
+      if ( !ite_terminal(e00, e10, e20, ret) ) {
+	push_frame3(stack, e00, e10, e20);
+	continue;
+      }
+    }
+    if ( frame.mState == 1 ) {
+      frame.mAns0 = ret;
+      frame.mState = 2;
+      auto e01 = frame.mE01;
+      auto e11 = frame.mE11;
+      auto e21 = frame.mE21;
+      if ( !ite_terminal(e01, e11, e21, ret) ) {
+	push_frame3(stack, e01, e11, e21);
+	continue;
+      }
+    }
+    // 両方の結果が揃った．
+    ret = new_node(frame.mTop, frame.mAns0, ret);
+    put_result(frame.mE0, frame.mE1, frame.mE2, ret);
+    stack.pop_back();
+    if ( stack.size() == base ) {
+      return ret;
+    }
   }
-
-  auto r0 = ite_step(e00, e10, e20);
-  auto r1 = ite_step(e01, e11, e21);
-  auto result = new_node(top, r0, r1);
-  mTable.emplace(key, result);
-  return result;
 }
 
 END_NAMESPACE_YM_DD
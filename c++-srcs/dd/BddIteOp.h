@@ -10,7 +10,6 @@
 
 #include "ym/logic.h"
 #include "BddOpBase.h"
-#include "Apply3Key.h"
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -18,6 +17,13 @@ BEGIN_NAMESPACE_YM_DD
 //////////////////////////////////////////////////////////////////////
 /// @class BddIteOp BddIteOp.h "BddIteOp.h"
 /// @brief ITE演算(AND, XOR)を行うクラス
+///
+/// 演算結果は BddMgrImpl の演算結果テーブルに格納されるので
+/// 呼び出しをまたいで再利用される．
+/// マネージャのスレッド数が2以上の場合，再帰の上位レベルでは
+/// 2つのコファクターに対する演算を並列に実行する．
+/// 逐次的に処理する部分は再帰呼び出しを用いずに明示的なスタックで
+/// 処理するので，変数の数が非常に多い場合でもスタックあふれを起こさない．
 //////////////////////////////////////////////////////////////////////
 class BddIteOp :
   public BddOpBase
@@ -76,11 +82,73 @@ public:
 
 private:
   //////////////////////////////////////////////////////////////////////
-  // データメンバ
+  // 内部で用いられる関数
   //////////////////////////////////////////////////////////////////////
 
-  // ITE用のテーブル
-  std::unordered_map<Apply3Key, DdEdge> mTable;
+  /// @brief AND 演算の自明な場合の処理と演算結果テーブルの検索を行う．
+  /// @return 結果が求まった時 true を返す．
+  ///
+  /// false を返した時は left, right は正規化されている．
+  bool
+  and_terminal(
+    DdEdge& left,  ///< [inout] 左のオペランド
+    DdEdge& right, ///< [inout] 右のオペランド
+    DdEdge& result ///< [out] 結果
+  );
+
+  /// @brief XOR 演算の自明な場合の処理と演算結果テーブルの検索を行う．
+  /// @return 結果が求まった時 true を返す．
+  ///
+  /// false を返した時は left, right は正極性に正規化されており，
+  /// 出力の反転フラグが oinv に設定される．
+  bool
+  xor_terminal(
+    DdEdge& left,  ///< [inout] 左のオペランド
+    DdEdge& right, ///< [inout] 右のオペランド
+    bool& oinv,    ///< [out] 出力の反転フラグ
+    DdEdge& result ///< [out] 結果
+  );
+
+  /// @brief ITE 演算の自明な場合の処理と演算結果テーブルの検索を行う．
+  /// @return 結果が求まった時 true を返す．
+  ///
+  /// false を返した時は e0 は正極性に正規化されている．
+  bool
+  ite_terminal(
+    DdEdge& e0,    ///< [inout] 条件のオペランド
+    DdEdge& e1,    ///< [inout] then 側のオペランド
+    DdEdge& e2,    ///< [inout] else 側のオペランド
+    DdEdge& result ///< [out] 結果
+  );
+
+  /// @brief 明示的なスタックを用いて AND 演算を行う．
+  ///
+  /// left, right は and_terminal() で正規化されていなければならない．
+  DdEdge
+  and_iter(
+    DdEdge left,
+    DdEdge right
+  );
+
+  /// @brief 明示的なスタックを用いて XOR 演算を行う．
+  ///
+  /// left, right は xor_terminal() で正規化されていなければならない．
+  DdEdge
+  xor_iter(
+    DdEdge left,
+    DdEdge right,
+    bool oinv
+  );
+
+  /// @brief 明示的なスタックを用いて ITE 演算を行う．
+  ///
+  /// e0, e1, e2 は ite_terminal() で正規化されていなければならない．
+  DdEdge
+  ite_iter(
+    DdEdge e0,
+    DdEdge e1,
+    DdEdge e2
+  );
 
 };
 
@@ -81,6 +81,82 @@ BddMgr::set_variable_order(
   get()->set_variable_order(edge_list);
 }
 
+// @brief sifting を用いて変数順の最適化を行う．
+void
+BddMgr::dvo_sift()
+{
+  get()->dvo_sift();
+}
+
+// @brief ウィンドウ置換を用いて変数順の最適化を行う．
+void
+BddMgr::dvo_window(
+  SizeType width
+)
+{
+  get()->dvo_window(width);
+}
+
+// @brief sifting で許容するノード数の増加率を返す．
+double
+BddMgr::dvo_max_growth() const
+{
+  return get()->dvo_max_growth();
+}
+
+// @brief sifting で許容するノード数の増加率を設定する．
+void
+BddMgr::set_dvo_max_growth(
+  double growth
+)
+{
+  get()->set_dvo_max_growth(growth);
+}
+
+// @brief 変数順の最適化の制限時間を返す．
+SizeType
+BddMgr::dvo_time_limit() const
+{
+  return get()->dvo_time_limit();
+}
+
+// @brief 変数順の最適化の制限時間を設定する．
+void
+BddMgr::set_dvo_time_limit(
+  SizeType limit
+)
+{
+  get()->set_dvo_time_limit(limit);
+}
+
+// @brief グループ sifting を許可する．
+void
+BddMgr::enable_dvo_group()
+{
+  get()->set_dvo_group(true);
+}
+
+// @brief グループ sifting を禁止する．
+void
+BddMgr::disable_dvo_group()
+{
+  get()->set_dvo_group(false);
+}
+
+// @brief 自動的な変数順の最適化を許可する．
+void
+BddMgr::enable_auto_dvo()
+{
+  get()->enable_auto_dvo();
+}
+
+// @brief 自動的な変数順の最適化を禁止する．
+void
+BddMgr::disable_auto_dvo()
+{
+  get()->disable_auto_dvo();
+}
+
 // @brief 恒儀関数を作る．
 Bdd
 BddMgr::zero()
@@ -105,6 +181,16 @@ BddMgr::restore(
   return conv_to_bddlist(edge_list);
 }
 
+// @brief BddImage の内容を読み込む．
+std::vector<Bdd>
+BddMgr::load_image(
+  const BddImage& image
+)
+{
+  auto edge_list = get()->load_image(image);
+  return conv_to_bddlist(edge_list);
+}
+
 // @brief ガーベージコレクションを行う．
 void
 BddMgr::garbage_collection()
@@ -149,6 +235,22 @@ BddMgr::disable_gc()
   get()->disable_gc();
 }
 
+// @brief 演算に用いるスレッド数を返す．
+SizeType
+BddMgr::thread_num() const
+{
+  return get()->thread_num();
+}
+
+// @brief 演算に用いるスレッド数を設定する．
+void
+BddMgr::set_thread_num(
+  SizeType num
+)
+{
+  get()->set_thread_num(num);
+}
+
 // @brief 枝のリストをBddのリストに変換する．
 std::vector<Bdd>
 BddMgr::conv_to_bddlist(
@@ -13,6 +13,7 @@
 #include "DdInfoMgr.h"
 #include "ym/BinEnc.h"
 #include "ym/BinDec.h"
+#include "ym/BddImage.h"
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -66,170 +67,6 @@ BddMgrImpl::variable_order()
   return order_list;
 }
 
-// @brief 変数順を設定する．
-void
-BddMgrImpl::set_variable_order(
-  const std::vector<DdEdge>& order_list
-)
-{
-  auto nv = variable_num();
-  if ( order_list.size() != nv ) {
-    throw std::invalid_argument{"order_list.size() mismatch"};
-  }
-  for ( SizeType i = 0; i < nv; ++ i ) {
-    auto dst_level = nv - i - 1;
-    auto edge = order_list[dst_level];
-    auto node = edge.node();
-    auto level = node->level();
-    // level を dst_level に移動する．
-    for ( ; level < dst_level; ++ level ) {
-      swap_level(level);
-    }
-  }
-}
-
-// @brief sifting を用いて変数順の最適化を行う．
-void
-BddMgrImpl::dvo_sift()
-{
-  auto nv = variable_num();
-  std::vector<bool> lock_array(nv, false);
-  while ( true ) {
-    // ノード数が最大の変数を選ぶ．
-    SizeType max_num = 0;
-    SizeType max_varid = 0;
-    SizeType max_level = 0;
-    for ( SizeType varid = 0; varid < nv; ++ varid ) {
-      if ( lock_array[varid] ) {
-	// ロックされていたらスキップする．
-	continue;
-      }
-      auto level = varid_to_level(varid);
-      auto n = node_num(level);
-      if ( max_num < n ) {
-	max_num = n;
-	max_varid = varid;
-	max_level = level;
-      }
-    }
-    if ( max_num == 0 ) {
-      break;
-    }
-    dvo_sub(max_level);
-    lock_array[max_varid] = true;
-  }
-}
-
-// @brief dvo_sift() の下請け関数
-void
-BddMgrImpl::dvo_sub(
-  SizeType level
-)
-{
-  auto best_num = node_num();
-  auto best_level = level;
-  // level を最下部まで移動させる．
-  auto bottom_level = variable_num() - 1;
-  for ( SizeType level1 = level; level1 < bottom_level; ++ level1 ) {
-    swap_level(level1);
-    auto num = node_num();
-    if ( best_num > num ) {
-      best_num = num;
-      best_level = level1 + 1;
-    }
-  }
-  // 最下部のインデックスを level まで移動させる．
-  for ( SizeType level1 = variable_num(); level1 > level; -- level1 ) {
-    swap_level(level1 - 1);
-  }
-  // level を最上部まで移動させる．
-  for ( SizeType level1 = level; level1 > 0; -- level1 ) {
-    swap_level(level1 - 1);
-    auto num = node_num();
-    if ( best_num > num ) {
-      best_num = num;
-      best_level = level1 - 1;
-    }
-  }
-  // 最上部のインデックスを best_level まで移動させる．
-  for ( SizeType level1 = 0; level1 < best_level; ++ level1 ) {
-    swap_level(level1);
-  }
-}
-
-BEGIN_NONAMESPACE
-
-inline
-bool
-_decomp(
-  DdEdge edge,
-  SizeType level1,
-  DdEdge& edge0,
-  DdEdge& edge1
-)
-{
-  if ( !edge.is_const() ) {
-    auto node = edge.node();
-    auto inv = edge.inv();
-    auto level = node->level();
-    if ( level == level1 ) {
-      edge0 = node->edge0() ^ inv;
-      edge1 = node->edge1() ^ inv;
-      return true;
-    }
-  }
-  edge0 = edge;
-  edge1 = edge;
-  return false;
-}
-
-END_NONAMESPACE
-
-// @brief 隣り合うインデックスを交換する．
-void
-BddMgrImpl::swap_level(
-  SizeType level
-)
-{
-  // まず単純に隣り合うレベルのテーブルを入れ替える．
-  DdNodeMgr::swap_level(level);
-
-  // 問題は level + 1 の子供を持つ level のノード
-  //
-  //      level                level
-  //     /     \              /     \
-  // level+1 level+1  ==> level+1 level+1
-  //  /   \   /   \        /   \    /   \
-  // e00 e01 e10 e11      e00 e10  e01 e11
-  //
-  // 他のノードから参照されているので同じノードの
-  // 中身を入れ替える．
-  auto level2 = level + 1;
-  scan(level, [&](DdNode* node) {
-    DdEdge e0 = node->edge0();
-    DdEdge e00, e01;
-    auto d0 = _decomp(e0, level, e00, e01);
-    DdEdge e1 = node->edge1();
-    DdEdge e10, e11;
-    auto d1 = _decomp(e1, level, e10, e11);
-    if ( d0 || d1 ) {
-      // 2つのレベルのインデックスを入れ替える．
-      auto new_e0 = new_node(level2, e00, e10);
-      auto new_e1 = new_node(level2, e01, e11);
-      node->chg_level(level);
-      node->chg_edges(new_e0, new_e1);
-      activate(new_e0);
-      activate(new_e1);
-      deactivate(e0);
-      deactivate(e1);
-      reg_node(node);
-      return true;
-    }
-    return false;
-  });
-  garbage_collection(level);
-}
-
 // @brief ノードを作る．
 DdEdge
 BddMgrImpl::new_node(
@@ -253,6 +90,17 @@ BddMgrImpl::new_node(
   return DdEdge{node, oinv};
 }
 
+// @brief garbage_collection() でノードを削除する直前に呼び出される関数
+void
+BddMgrImpl::before_gc()
+{
+  // 削除されるノードを参照しているエントリを取り除く．
+  // 変数順の変更中は演算結果テーブルは空なので何もしない．
+  if ( !mReordering ) {
+    mCompTable.sweep();
+  }
+}
+
 // @brief garbage_collection() が呼ばれた後に呼び出される関数
 void
 BddMgrImpl::after_gc()
@@ -420,4 +268,95 @@ BddMgrImpl::restore(
   return root_list;
 }
 
+// @brief BddImage の内容を読み込む．
+std::vector<DdEdge>
+BddMgrImpl::load_image(
+  const BddImage& image
+)
+{
+  // イメージの変数を確保する．
+  auto nv1 = image.variable_num();
+  for ( SizeType level = 0; level < nv1; ++ level ) {
+    (void) variable(image.level_to_varid(level));
+  }
+
+  // イメージのレベルとこちらのレベルの対応を求める．
+  // 相対的な順序が同じならば変数順を変える必要はない．
+  auto make_level_map = [&]() -> std::vector<SizeType> {
+    std::vector<SizeType> level_map(nv1);
+    for ( SizeType level = 0; level < nv1; ++ level ) {
+      level_map[level] = varid_to_level(image.level_to_varid(level));
+    }
+    return level_map;
+  };
+  auto level_map = make_level_map();
+  if ( !std::is_sorted(level_map.begin(), level_map.end()) ) {
+    // イメージの変数を先頭に移動させる．
+    auto nv = variable_num();
+    std::vector<DdEdge> order_list;
+    order_list.reserve(nv);
+    std::vector<bool> used(nv, false);
+    for ( SizeType level = 0; level < nv1; ++ level ) {
+      auto varid = image.level_to_varid(level);
+      order_list.push_back(variable(varid));
+      used[varid] = true;
+    }
+    for ( auto edge: variable_order() ) {
+      auto varid = level_to_varid(edge.node()->level());
+      if ( !used[varid] ) {
+	order_list.push_back(edge);
+      }
+    }
+    set_variable_order(order_list);
+    level_map = make_level_map();
+  }
+
+  // レベルごとのノード数を数えて表をあらかじめ拡張しておく．
+  auto n = image.node_num();
+  std::vector<SizeType> num_array(nv1, 0);
+  for ( SizeType id = 1; id <= n; ++ id ) {
+    auto level = image.node_level(id);
+    if ( level >= nv1 ) {
+      throw std::invalid_argument{"BddImage: level is out of range"};
+    }
+    ++ num_array[level];
+  }
+  for ( SizeType level = 0; level < nv1; ++ level ) {
+    auto level1 = level_map[level];
+    reserve(level1, node_num(level1) + num_array[level]);
+  }
+
+  // 子供から順にノードを作る．
+  std::vector<DdEdge> edge_list;
+  edge_list.reserve(n);
+  auto decode_edge = [&](SizeType id, SizeType edge) -> DdEdge {
+    auto node = DdInfo::edge2node(edge);
+    if ( node >= id ) {
+      throw std::invalid_argument{"BddImage: broken node array"};
+    }
+    return decode(edge, edge_list);
+  };
+  auto check_level = [](SizeType level, DdEdge edge) {
+    if ( !edge.is_const() && edge.node()->level() <= level ) {
+      throw std::invalid_argument{"BddImage: broken node array"};
+    }
+  };
+  for ( SizeType id = 1; id <= n; ++ id ) {
+    auto level = level_map[image.node_level(id)];
+    auto edge0 = decode_edge(id, image.node_edge0(id));
+    auto edge1 = decode_edge(id, image.node_edge1(id));
+    check_level(level, edge0);
+    check_level(level, edge1);
+    auto edge = new_node(level, edge0, edge1);
+    edge_list.push_back(edge);
+  }
+
+  auto nr = image.root_num();
+  std::vector<DdEdge> root_list(nr);
+  for ( SizeType i = 0; i < nr; ++ i ) {
+    root_list[i] = decode_edge(n + 1, image.root(i));
+  }
+  return root_list;
+}
+
 END_NAMESPACE_YM_DD
@@ -15,6 +15,8 @@
 #include "DdNode.h"
 #include "DdEdge.h"
 #include "DdNodeMgr.h"
+#include "DdCompTable.h"
+#include <chrono>
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -80,9 +82,106 @@ public:
   );
 
   /// @brief sifting を用いて変数順の最適化を行う．
+  ///
+  /// dvo_group() が true の場合には対称な変数をまとめて
+  /// 移動させる(グループ sifting)．
   void
   dvo_sift();
 
+  /// @brief ウィンドウ置換を用いて変数順の最適化を行う．
+  ///
+  /// 隣り合う width 個の変数の全ての順列を試す．
+  /// 改善がなくなるまで繰り返す．
+  void
+  dvo_window(
+    SizeType width ///< [in] ウィンドウ幅(2 〜 4)
+  );
+
+  /// @brief sifting で許容するノード数の増加率を返す．
+  double
+  dvo_max_growth() const
+  {
+    return mDvoMaxGrowth;
+  }
+
+  /// @brief sifting で許容するノード数の増加率を設定する．
+  ///
+  /// 変数を移動中にノード数がそれまでの最小値のこの倍数を越えたら
+  /// その方向への移動を打ち切る．
+  void
+  set_dvo_max_growth(
+    double growth ///< [in] 増加率(1.0 以上)
+  )
+  {
+    mDvoMaxGrowth = std::max(growth, 1.0);
+  }
+
+  /// @brief 変数順の最適化の制限時間を返す．
+  ///
+  /// 単位はミリ秒で 0 の場合は制限なし．
+  SizeType
+  dvo_time_limit() const
+  {
+    return mDvoTimeLimit;
+  }
+
+  /// @brief 変数順の最適化の制限時間を設定する．
+  void
+  set_dvo_time_limit(
+    SizeType limit ///< [in] 制限時間(ミリ秒), 0 の場合は制限なし
+  )
+  {
+    mDvoTimeLimit = limit;
+  }
+
+  /// @brief グループ sifting を行う時 true を返す．
+  bool
+  dvo_group() const
+  {
+    return mDvoGroup;
+  }
+
+  /// @brief グループ sifting を行うかどうかを設定する．
+  void
+  set_dvo_group(
+    bool flag ///< [in] フラグ
+  )
+  {
+    mDvoGroup = flag;
+  }
+
+  /// @brief 自動的な変数順の最適化を許可する．
+  ///
+  /// セーフポイントでノード数が前回の最適化後の2倍を越えていたら
+  /// dvo_sift() を行う．
+  void
+  enable_auto_dvo()
+  {
+    mAutoDvo = true;
+    mAutoDvoThreshold = std::max(AUTO_DVO_LIMIT, node_num() * 2);
+  }
+
+  /// @brief 自動的な変数順の最適化を禁止する．
+  void
+  disable_auto_dvo()
+  {
+    mAutoDvo = false;
+  }
+
+  /// @brief 自動的な変数順の最適化が許可されている時 true を返す．
+  bool
+  auto_dvo() const
+  {
+    return mAutoDvo;
+  }
+
+  /// @brief 演算結果テーブルを返す．
+  DdCompTable&
+  comp_table()
+  {
+    return mCompTable;
+  }
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -105,6 +204,16 @@ public:
     BinDec& s ///< [in] 入力ストリーム
   );
 
+  /// @brief BddImage の内容を読み込む．
+  /// @return 根の枝のリストを返す．
+  ///
+  /// 必要ならばイメージと同じ変数順に変更する．
+  /// 不正な形式の場合は std::invalid_argument 例外を送出する．
+  std::vector<DdEdge>
+  load_image(
+    const BddImage& image ///< [in] イメージ
+  );
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -302,22 +411,69 @@ private:
   // DdNodeMgr の仮想関数
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief garbage_collection() でノードを削除する直前に呼び出される関数
+  void
+  before_gc() override;
+
   /// @brief garbage_collection() が呼ばれた後に呼び出される関数
   void
   after_gc() override;
 
+  /// @brief セーフポイントの最後に呼び出される関数
+  void
+  at_safe_point() override;
+
 
 private:
   //////////////////////////////////////////////////////////////////////
   // 内部で用いられる関数
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief 変数順の変更を開始する．
+  ///
+  /// 参照されていないノードを全て削除し，演算結果テーブルをクリアする．
+  void
+  begin_reorder();
+
+  /// @brief 変数順の変更を終了する．
+  void
+  end_reorder();
+
+  /// @brief 制限時間を過ぎていたら true を返す．
+  bool
+  dvo_timeout() const;
+
   /// @brief dvo_sift() の下請け関数
   ///
-  /// level の移動先として最適な位置を求める．
+  /// block_list 中の pos 番目のブロックを最適な位置に移動させる．
+  /// ブロックは隣接したレベルの変数のまとまりで，
+  /// block_list は各ブロックの変数の数をレベルの順に並べたもの．
+  /// pos は移動後の位置に更新される．
+  void
+  sift_block(
+    std::vector<SizeType>& block_list, ///< [inout] ブロックのリスト
+    SizeType& pos                      ///< [inout] 対象のブロックの位置
+  );
+
+  /// @brief 隣り合うブロックを交換する．
+  ///
+  /// top から始まる size1 個のレベルと，それに続く size2 個のレベルを
+  /// 交換する．
   void
-  dvo_sub(
-    SizeType level
+  swap_block(
+    SizeType top,   ///< [in] 上のブロックの先頭のレベル
+    SizeType size1, ///< [in] 上のブロックのサイズ
+    SizeType size2  ///< [in] 下のブロックのサイズ
+  );
+
+  /// @brief level と level + 1 の変数が対称か調べる．
+  ///
+  /// level のノードで分解した全ての関数について
+  /// 2つの変数を入れ替えても関数が変わらない時 true を返す．
+  /// ただし，2つの変数の両方に依存する関数がない場合は false を返す．
+  bool
+  check_sym(
+    SizeType level ///< [in] 上のレベル
   );
 
   /// @brief 隣り合うレベルを交換する．
@@ -335,6 +491,34 @@ private:
   // 変数(の枝)のリスト
   std::vector<DdEdge> mVarList;
 
+  // 演算結果テーブル
+  DdCompTable mCompTable;
+
+  // sifting で許容するノード数の増加率
+  double mDvoMaxGrowth{1.2};
+
+  // 変数順の最適化の制限時間(ミリ秒)
+  SizeType mDvoTimeLimit{0};
+
+  // 変数順の最適化を打ち切る時刻
+  std::chrono::steady_clock::time_point mDvoDeadline;
+
+  // グループ sifting を行う時 true にするフラグ
+  bool mDvoGroup{false};
+
+  // 自動的な変数順の最適化を行う時 true にするフラグ
+  bool mAutoDvo{false};
+
+  // 自動的な変数順の最適化を起動するノード数
+  SizeType mAutoDvoThreshold{0};
+
+  // 変数順の変更中に true となるフラグ
+  bool mReordering{false};
+
+  // 自動的な変数順の最適化を起動するノード数の下限
+  static
+  const SizeType AUTO_DVO_LIMIT = 4096;
+
 };
 
 END_NAMESPACE_YM_DD
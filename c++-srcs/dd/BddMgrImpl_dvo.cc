@@ -0,0 +1,490 @@
+
+/// @file BddMgrImpl_dvo.cc
+/// @brief BddMgrImpl の変数順の変更に関する実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "BddMgrImpl.h"
+#include <numeric>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+BEGIN_NONAMESPACE
+
+// edge が level のノードを指していたらその子供を返す．
+// そうでなければ edge 自身を返す．
+inline
+bool
+_decomp(
+  DdEdge edge,
+  SizeType level1,
+  DdEdge& edge0,
+  DdEdge& edge1
+)
+{
+  if ( !edge.is_const() ) {
+    auto node = edge.node();
+    auto inv = edge.inv();
+    auto level = node->level();
+    if ( level == level1 ) {
+      edge0 = node->edge0() ^ inv;
+      edge1 = node->edge1() ^ inv;
+      return true;
+    }
+  }
+  edge0 = edge;
+  edge1 = edge;
+  return false;
+}
+
+// edge が level のノードを指している時 true を返す．
+inline
+bool
+_at_level(
+  DdEdge edge,
+  SizeType level
+)
+{
+  return !edge.is_const() && edge.node()->level() == level;
+}
+
+// n 個の要素の全ての順列を隣接互換の列で列挙する．
+// 結果の i 番目の要素 k は k 番目と k + 1 番目を交換することを表す．
+// Steinhaus-Johnson-Trotter のアルゴリズムを用いる．
+std::vector<SizeType>
+adjacent_swap_sequence(
+  SizeType n
+)
+{
+  std::vector<SizeType> perm(n);
+  std::iota(perm.begin(), perm.end(), 0);
+  // 各要素の向き(true なら左向き)
+  std::vector<bool> left(n, true);
+  std::vector<SizeType> seq;
+  for ( ; ; ) {
+    // 移動可能な最大の要素を探す．
+    SizeType max_pos = n;
+    for ( SizeType i = 0; i < n; ++ i ) {
+      auto v = perm[i];
+      bool movable = left[v] ?
+	(i > 0 && perm[i - 1] < v) :
+	(i + 1 < n && perm[i + 1] < v);
+      if ( movable && (max_pos == n || perm[max_pos] < v) ) {
+	max_pos = i;
+      }
+    }
+    if ( max_pos == n ) {
+      break;
+    }
+    auto v = perm[max_pos];
+    auto k = left[v] ? max_pos - 1 : max_pos;
+    std::swap(perm[k], perm[k + 1]);
+    seq.push_back(k);
+    for ( SizeType u = v + 1; u < n; ++ u ) {
+      left[u] = !left[u];
+    }
+  }
+  return seq;
+}
+
+END_NONAMESPACE
+
+// @brief 変数順を設定する．
+void
+BddMgrImpl::set_variable_order(
+  const std::vector<DdEdge>& order_list
+)
+{
+  auto nv = variable_num();
+  if ( order_list.size() != nv ) {
+    throw std::invalid_argument{"order_list.size() mismatch"};
+  }
+  begin_reorder();
+  for ( SizeType i = 0; i < nv; ++ i ) {
+    auto dst_level = nv - i - 1;
+    auto edge = order_list[dst_level];
+    auto node = edge.node();
+    auto level = node->level();
+    // level を dst_level に移動する．
+    for ( ; level < dst_level; ++ level ) {
+      swap_level(level);
+    }
+  }
+  end_reorder();
+}
+
+// @brief sifting を用いて変数順の最適化を行う．
+void
+BddMgrImpl::dvo_sift()
+{
+  auto nv = variable_num();
+  if ( nv < 2 ) {
+    return;
+  }
+  begin_reorder();
+
+  // 最初は全ての変数が大きさ1のブロックとなる．
+  std::vector<SizeType> block_list(nv, 1);
+
+  // ノード数の多い順に処理する．
+  std::vector<SizeType> varid_list(nv);
+  std::iota(varid_list.begin(), varid_list.end(), 0);
+  std::vector<SizeType> num_array(nv);
+  for ( SizeType varid = 0; varid < nv; ++ varid ) {
+    num_array[varid] = node_num(varid_to_level(varid));
+  }
+  std::stable_sort(varid_list.begin(), varid_list.end(),
+		   [&](SizeType a, SizeType b) {
+		     return num_array[a] > num_array[b];
+		   });
+
+  std::vector<bool> done(nv, false);
+  for ( auto varid: varid_list ) {
+    if ( dvo_timeout() ) {
+      break;
+    }
+    if ( done[varid] ) {
+      // 既にグループとして移動済み
+      continue;
+    }
+    // varid を含むブロックを探す．
+    auto level = varid_to_level(varid);
+    SizeType pos = 0;
+    SizeType top = 0;
+    while ( top + block_list[pos] <= level ) {
+      top += block_list[pos];
+      ++ pos;
+    }
+    for ( SizeType i = 0; i < block_list[pos]; ++ i ) {
+      done[level_to_varid(top + i)] = true;
+    }
+    sift_block(block_list, pos);
+
+    if ( mDvoGroup ) {
+      // 隣のブロックと対称ならば併合する．
+      top = std::accumulate(block_list.begin(), block_list.begin() + pos,
+			    SizeType{0});
+      if ( pos + 1 < block_list.size() &&
+	   check_sym(top + block_list[pos] - 1) ) {
+	block_list[pos] += block_list[pos + 1];
+	block_list.erase(block_list.begin() + pos + 1);
+      }
+      if ( pos > 0 && check_sym(top - 1) ) {
+	block_list[pos - 1] += block_list[pos];
+	block_list.erase(block_list.begin() + pos);
+      }
+    }
+  }
+
+  end_reorder();
+}
+
+// @brief dvo_sift() の下請け関数
+void
+BddMgrImpl::sift_block(
+  std::vector<SizeType>& block_list,
+  SizeType& pos
+)
+{
+  auto nb = block_list.size();
+  auto top = std::accumulate(block_list.begin(), block_list.begin() + pos,
+			     SizeType{0});
+
+  // 1つ下に移動する．
+  auto move_down = [&]() {
+    auto size1 = block_list[pos];
+    auto size2 = block_list[pos + 1];
+    swap_block(top, size1, size2);
+    std::swap(block_list[pos], block_list[pos + 1]);
+    top += size2;
+    ++ pos;
+  };
+  // 1つ上に移動する．
+  auto move_up = [&]() {
+    auto size1 = block_list[pos - 1];
+    auto size2 = block_list[pos];
+    swap_block(top - size1, size1, size2);
+    std::swap(block_list[pos - 1], block_list[pos]);
+    top -= size1;
+    -- pos;
+  };
+
+  auto best_num = node_num();
+  auto best_pos = pos;
+  // ノード数を調べて移動を続けるか判断する．
+  auto check = [&]() -> bool {
+    auto num = node_num();
+    if ( num < best_num ) {
+      best_num = num;
+      best_pos = pos;
+    }
+    else if ( static_cast<double>(num) > best_num * mDvoMaxGrowth ) {
+      return false;
+    }
+    return !dvo_timeout();
+  };
+  auto sift_down = [&]() {
+    while ( pos + 1 < nb ) {
+      move_down();
+      if ( !check() ) {
+	break;
+      }
+    }
+  };
+  auto sift_up = [&]() {
+    while ( pos > 0 ) {
+      move_up();
+      if ( !check() ) {
+	break;
+      }
+    }
+  };
+
+  // 近い方の端から先に調べる．
+  if ( pos < nb - pos - 1 ) {
+    sift_up();
+    sift_down();
+  }
+  else {
+    sift_down();
+    sift_up();
+  }
+
+  // 最良の位置に戻す．
+  // 時間切れの場合もここは省略しない．
+  while ( pos < best_pos ) {
+    move_down();
+  }
+  while ( pos > best_pos ) {
+    move_up();
+  }
+}
+
+// @brief 隣り合うブロックを交換する．
+void
+BddMgrImpl::swap_block(
+  SizeType top,
+  SizeType size1,
+  SizeType size2
+)
+{
+  // 下のブロックの変数を順に上に移動させる．
+  for ( SizeType i = 0; i < size2; ++ i ) {
+    auto level = top + size1 + i;
+    auto dst_level = top + i;
+    for ( ; level > dst_level; -- level ) {
+      swap_level(level - 1);
+    }
+  }
+}
+
+// @brief level と level + 1 の変数が対称か調べる．
+bool
+BddMgrImpl::check_sym(
+  SizeType level
+)
+{
+  // level の全てのノードについて f01 == f10 が成り立ち，
+  // level + 1 のノードが level のノード以外から参照されていなければ
+  // 2つの変数は対称となる．
+  // ただし，変数を表すノードは mVarList から参照されているので除外する．
+  auto level2 = level + 1;
+  auto var_node1 = mVarList[level_to_varid(level)].node();
+  auto var_node2 = mVarList[level_to_varid(level2)].node();
+  bool sym = true;
+  SizeType nref = 0;
+  scan(level, [&](DdNode* node) -> bool {
+    if ( !sym || node == var_node1 ) {
+      return false;
+    }
+    auto e0 = node->edge0();
+    auto e1 = node->edge1();
+    DdEdge e00, e01, e10, e11;
+    auto d0 = _decomp(e0, level2, e00, e01);
+    auto d1 = _decomp(e1, level2, e10, e11);
+    if ( d0 ) {
+      ++ nref;
+    }
+    if ( d1 ) {
+      ++ nref;
+    }
+    if ( e01 != e10 ) {
+      sym = false;
+    }
+    return false;
+  });
+  if ( !sym || nref == 0 ) {
+    return false;
+  }
+
+  // level + 1 のノードの参照回数の総和を求める．
+  SizeType total_ref = 0;
+  scan(level2, [&](DdNode* node) -> bool {
+    total_ref += node->ref_count();
+    if ( node == var_node2 ) {
+      -- total_ref;
+    }
+    return false;
+  });
+  return total_ref == nref;
+}
+
+// @brief ウィンドウ置換を用いて変数順の最適化を行う．
+void
+BddMgrImpl::dvo_window(
+  SizeType width
+)
+{
+  auto nv = variable_num();
+  width = std::min(std::max(width, SizeType{2}), SizeType{4});
+  width = std::min(width, nv);
+  if ( width < 2 ) {
+    return;
+  }
+  begin_reorder();
+
+  auto seq = adjacent_swap_sequence(width);
+  for ( bool improved = true; improved && !dvo_timeout(); ) {
+    improved = false;
+    for ( SizeType top = 0; top + width <= nv; ++ top ) {
+      if ( dvo_timeout() ) {
+	break;
+      }
+      // ウィンドウ内の変数の並びと最良の並び
+      std::vector<SizeType> cur_order(width);
+      for ( SizeType i = 0; i < width; ++ i ) {
+	cur_order[i] = level_to_varid(top + i);
+      }
+      auto best_order = cur_order;
+      auto init_num = node_num();
+      auto best_num = init_num;
+      for ( auto k: seq ) {
+	swap_level(top + k);
+	std::swap(cur_order[k], cur_order[k + 1]);
+	auto num = node_num();
+	if ( num < best_num ) {
+	  best_num = num;
+	  best_order = cur_order;
+	}
+	if ( dvo_timeout() ) {
+	  break;
+	}
+      }
+      // 最良の並びに戻す．
+      for ( SizeType i = 0; i < width; ++ i ) {
+	auto level = varid_to_level(best_order[i]);
+	for ( ; level > top + i; -- level ) {
+	  swap_level(level - 1);
+	}
+      }
+      if ( best_num < init_num ) {
+	improved = true;
+      }
+    }
+  }
+
+  end_reorder();
+}
+
+// @brief 変数順の変更を開始する．
+void
+BddMgrImpl::begin_reorder()
+{
+  // 演算結果テーブルの内容は変数順が変わると無効になる．
+  // 先に消しておけば以降の GC で演算結果テーブルを調べずに済む．
+  mCompTable.clear();
+  mReordering = true;
+  // 参照回数が 0 のノードは swap_level() で正しく扱えないので
+  // GC が禁止されていてもここで全て削除しておく．
+  sweep_garbage();
+  if ( mDvoTimeLimit > 0 ) {
+    mDvoDeadline = std::chrono::steady_clock::now() +
+      std::chrono::milliseconds{mDvoTimeLimit};
+  }
+}
+
+// @brief 変数順の変更を終了する．
+void
+BddMgrImpl::end_reorder()
+{
+  // 変数順の変更中は演算結果テーブルは空のままなので
+  // mReordering を下ろす前に GC を行う．
+  garbage_collection();
+  mReordering = false;
+}
+
+// @brief 制限時間を過ぎていたら true を返す．
+bool
+BddMgrImpl::dvo_timeout() const
+{
+  if ( mDvoTimeLimit == 0 ) {
+    return false;
+  }
+  return std::chrono::steady_clock::now() >= mDvoDeadline;
+}
+
+// @brief セーフポイントの最後に呼び出される関数
+void
+BddMgrImpl::at_safe_point()
+{
+  if ( mAutoDvo && !mReordering && node_num() >= mAutoDvoThreshold ) {
+    dvo_sift();
+    mAutoDvoThreshold = std::max(AUTO_DVO_LIMIT, node_num() * 2);
+  }
+}
+
+// @brief 隣り合うレベルを交換する．
+void
+BddMgrImpl::swap_level(
+  SizeType level
+)
+{
+  ASSERT_COND( mReordering );
+
+  // まず単純に隣り合うレベルのテーブルを入れ替える．
+  // これで level には元の level + 1 の変数(y)のノードが，
+  // level + 1 には元の level の変数(x)のノードが入る．
+  DdNodeMgr::swap_level(level);
+
+  // 問題は y のノードを子供に持つ x のノード
+  //
+  //        x                      y
+  //     0/   \1                0/   \1
+  //     y     y        ==>      x     x
+  //   0/ \1 0/ \1            0/ \1 0/ \1
+  // e00 e01 e10 e11        e00 e10 e01 e11
+  //
+  // 他のノードから参照されているので同じノードの
+  // 中身を入れ替えて y のノードにする．
+  auto level2 = level + 1;
+  auto node_list = move_out(level2, [&](const DdNode* node) {
+    return _at_level(node->edge0(), level) || _at_level(node->edge1(), level);
+  });
+  for ( auto node: node_list ) {
+    auto e0 = node->edge0();
+    auto e1 = node->edge1();
+    DdEdge e00, e01;
+    _decomp(e0, level, e00, e01);
+    DdEdge e10, e11;
+    _decomp(e1, level, e10, e11);
+    // e0 は正規化されているので new_e0 も反転属性を持たない．
+    auto new_e0 = new_node(level2, e00, e10);
+    auto new_e1 = new_node(level2, e01, e11);
+    activate(new_e0);
+    activate(new_e1);
+    deactivate(e0);
+    deactivate(e1);
+    node->chg_level(level);
+    node->chg_edges(new_e0, new_e1);
+    move_in(node);
+  }
+  // 参照されなくなった y のノードを削除する．
+  // 演算結果テーブルは begin_reorder() で空にしてあるので
+  // before_gc() はそれを調べない．
+  sweep_garbage();
+}
+
+END_NAMESPACE_YM_DD
@@ -24,14 +24,13 @@ Bdd::_multi_compose(
 ) const
 {
   _check_valid();
-  std::unordered_map<SizeType, DdEdge> cmap;
+  std::vector<std::pair<DdEdge, DdEdge>> cmap;
   for ( auto& p: compose_map ) {
     auto var = p.first;
-    auto level = var.level();
     auto& bdd = p.second;
     bdd._check_valid();
     auto cedge = bdd.root();
-    cmap.emplace(level, cedge);
+    cmap.push_back({var.root(), cedge});
   }
   BddMultiCompOp op(get(), cmap);
   auto edge = op.mcomp_op(root());
@@ -45,13 +44,12 @@ Bdd::_remap_vars(
 ) const
 {
   _check_valid();
-  std::unordered_map<SizeType, DdEdge> cmap;
+  std::vector<std::pair<DdEdge, DdEdge>> cmap;
   for ( auto& p: varmap ) {
     auto var = p.first;
-    auto level = var.level();
     auto lit = p.second;
     auto cedge = lit.root();
-    cmap.emplace(level, cedge);
+    cmap.push_back({var.root(), cedge});
   }
   BddMultiCompOp op(get(), cmap);
   auto edge = op.mcomp_op(root());
@@ -66,13 +64,16 @@ Bdd::_remap_vars(
 // @brief コンストラクタ
 BddMultiCompOp::BddMultiCompOp(
   BddMgrImpl* mgr,
-  const std::unordered_map<SizeType, DdEdge>& comp_map
+  const std::vector<std::pair<DdEdge, DdEdge>>& comp_map
 ) : BddOpBase{mgr},
     mIteOp{mgr}
 {
+  // 変数のレベルはセーフポイントで変わる可能性があるので
+  // BddOpBase のコンストラクタの後で求める．
   mCompList.reserve(comp_map.size());
   for ( auto& p: comp_map ) {
-    mCompList.push_back(p);
+    auto level = p.first.node()->level();
+    mCompList.push_back({level, p.second});
   }
   sort(mCompList.begin(), mCompList.end(),
        [](const std::pair<SizeType, DdEdge>& a,
@@ -26,7 +26,7 @@ public:
   /// @brief コンストラクタ
   BddMultiCompOp(
     BddMgrImpl* mgr,                                     ///< [in] マネージャ
-    const std::unordered_map<SizeType, DdEdge>& comp_map ///< [in] 変換マップ
+    const std::vector<std::pair<DdEdge, DdEdge>>& comp_map ///< [in] (変数, 置き換える関数) のリスト
   );
 
   /// @brief デストラクタ
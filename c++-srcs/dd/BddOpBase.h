@@ -15,11 +15,31 @@
 
 BEGIN_NAMESPACE_YM_DD
 
+/// @brief 演算結果テーブルで用いる演算コード
+///
+/// ITE 系の演算(AND, XOR, ITE)は演算コードを用いない．
+enum class BddOpCode : SizeType {
+  Cofactor = 1, ///< コファクター
+  Simplify,     ///< ドントケアを用いた簡単化
+  Exist         ///< 存在量化
+};
+
+/// @brief 演算結果テーブルで用いる三項演算の演算コード
+///
+/// DdCompTable::tag_edge() の制約で 1 〜 3 しか使えない．
+enum class BddOp3Code : SizeType {
+  AndExist = 1  ///< 論理積と存在量化
+};
+
+
 //////////////////////////////////////////////////////////////////////
 /// @class BddOpBase BddOpBase.h "BddOpBase.h"
 /// @brief BDD用の演算クラスの基底クラス
 ///
 /// いわゆる BddMgrImpl の delegate クラス
+///
+/// コンストラクタとデストラクタで演算の開始と終了をマネージャに知らせる．
+/// 演算の途中で GC が起こらないようにするため．
 //////////////////////////////////////////////////////////////////////
 class BddOpBase
 {
@@ -30,10 +50,25 @@ public:
     BddMgrImpl* mgr ///< [in] マネージャ
   ) : mMgr{mgr}
   {
+    mMgr->begin_op();
   }
 
   /// @brief デストラクタ
-  ~BddOpBase() = default;
+  ~BddOpBase()
+  {
+    mMgr->end_op();
+  }
+
+  /// @brief コピーコンストラクタは禁止
+  BddOpBase(
+    const BddOpBase& src
+  ) = delete;
+
+  /// @brief コピー代入演算子は禁止
+  BddOpBase&
+  operator=(
+    const BddOpBase& src
+  ) = delete;
 
 
 protected:
@@ -67,6 +102,105 @@ protected:
     return BddMgrImpl::decomp(left, right, left0, left1, right0, right1);
   }
 
+  /// @brief par_do() で並列実行が行える時 true を返す．
+  bool
+  can_par() const
+  {
+    return mMgr->can_par();
+  }
+
+  /// @brief 2つの処理を(可能ならば)並列に実行する．
+  template <class Func0, class Func1>
+  void
+  par_do(
+    Func0&& func0, ///< [in] 処理1
+    Func1&& func1  ///< [in] 処理2
+  )
+  {
+    mMgr->par_do(func0, func1);
+  }
+
+  /// @brief ITE 系の演算結果を演算結果テーブルから探す．
+  /// @return 見つかったら true を返す．
+  bool
+  find_result(
+    DdEdge e0,     ///< [in] オペランド1
+    DdEdge e1,     ///< [in] オペランド2
+    DdEdge e2,     ///< [in] オペランド3
+    DdEdge& result ///< [out] 結果を格納する変数
+  )
+  {
+    return mMgr->comp_table().find(e0, e1, e2, result);
+  }
+
+  /// @brief ITE 系の演算結果を演算結果テーブルに登録する．
+  void
+  put_result(
+    DdEdge e0,    ///< [in] オペランド1
+    DdEdge e1,    ///< [in] オペランド2
+    DdEdge e2,    ///< [in] オペランド3
+    DdEdge result ///< [in] 結果
+  )
+  {
+    mMgr->comp_table().put(e0, e1, e2, result);
+  }
+
+  /// @brief 二項演算の結果を演算結果テーブルから探す．
+  /// @return 見つかったら true を返す．
+  bool
+  find_result(
+    BddOpCode op,  ///< [in] 演算コード
+    DdEdge e0,     ///< [in] オペランド1
+    DdEdge e1,     ///< [in] オペランド2
+    DdEdge& result ///< [out] 結果を格納する変数
+  )
+  {
+    auto tag = DdCompTable::op_tag(static_cast<SizeType>(op));
+    return mMgr->comp_table().find(e0, e1, tag, result);
+  }
+
+  /// @brief 二項演算の結果を演算結果テーブルに登録する．
+  void
+  put_result(
+    BddOpCode op, ///< [in] 演算コード
+    DdEdge e0,    ///< [in] オペランド1
+    DdEdge e1,    ///< [in] オペランド2
+    DdEdge result ///< [in] 結果
+  )
+  {
+    auto tag = DdCompTable::op_tag(static_cast<SizeType>(op));
+    mMgr->comp_table().put(e0, e1, tag, result);
+  }
+
+  /// @brief 三項演算の結果を演算結果テーブルから探す．
+  /// @return 見つかったら true を返す．
+  bool
+  find_result(
+    BddOp3Code op, ///< [in] 演算コード
+    DdEdge e0,     ///< [in] オペランド1(定数は不可)
+    DdEdge e1,     ///< [in] オペランド2
+    DdEdge e2,     ///< [in] オペランド3
+    DdEdge& result ///< [out] 結果を格納する変数
+  )
+  {
+    auto key0 = DdCompTable::tag_edge(e0, static_cast<SizeType>(op));
+    return mMgr->comp_table().find(key0, e1, e2, result);
+  }
+
+  /// @brief 三項演算の結果を演算結果テーブルに登録する．
+  void
+  put_result(
+    BddOp3Code op, ///< [in] 演算コード
+    DdEdge e0,     ///< [in] オペランド1(定数は不可)
+    DdEdge e1,     ///< [in] オペランド2
+    DdEdge e2,     ///< [in] オペランド3
+    DdEdge result  ///< [in] 結果
+  )
+  {
+    auto key0 = DdCompTable::tag_edge(e0, static_cast<SizeType>(op));
+    mMgr->comp_table().put(key0, e1, e2, result);
+  }
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -0,0 +1,165 @@
+
+/// @file BddSampler.cc
+/// @brief BddSampler の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/BddSampler.h"
+#include "ym/Bdd.h"
+#include "DdEdge.h"
+#include "DdNode.h"
+#include "BddCountOp.h"
+#include <cmath>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+BEGIN_NONAMESPACE
+
+// 64ビットの乱数を作る．
+inline
+std::uint64_t
+random_word(
+  std::mt19937& randgen
+)
+{
+  std::uint64_t w0 = randgen();
+  std::uint64_t w1 = randgen();
+  return (w0 << 32) | w1;
+}
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス BddSampler
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+BddSampler::BddSampler(
+  const Bdd& bdd,
+  const std::vector<BddVar>& var_list
+) : mVarNum{var_list.size()}
+{
+  bdd._check_valid();
+  if ( bdd.is_zero() ) {
+    throw std::invalid_argument{"bdd has no satisfying assignment"};
+  }
+
+  // レベルから var_list 中の位置への写像
+  std::unordered_map<SizeType, SizeType> pos_map;
+  auto level_list = BddVar::conv_to_levellist(var_list);
+  for ( SizeType i = 0; i < level_list.size(); ++ i ) {
+    pos_map.emplace(level_list[i], i);
+  }
+
+  auto root = bdd.root();
+  BddCountOp op(root);
+  auto& node_list = op.node_list();
+  auto log_density = op.log2_density_list();
+  mNodeList.reserve(node_list.size());
+  for ( SizeType i = 0; i < node_list.size(); ++ i ) {
+    auto node = node_list[i];
+    if ( pos_map.count(node->level()) == 0 ) {
+      throw std::invalid_argument{"var_list does not contain the support"};
+    }
+    auto pos = pos_map.at(node->level());
+    auto edge0 = op.edge2int(node->edge0());
+    auto edge1 = op.edge2int(node->edge1());
+    auto& p = log_density[i];
+    mNodeList.push_back({pos, edge0, edge1, p.first, p.second});
+  }
+  mRoot = op.edge2int(root);
+}
+
+// @brief 充足割当を一つ求める．
+std::vector<bool>
+BddSampler::sample(
+  std::mt19937& randgen
+) const
+{
+  std::vector<std::uint64_t> row(row_size());
+  sample_row(randgen, row.data());
+  std::vector<bool> ans(mVarNum);
+  for ( SizeType i = 0; i < mVarNum; ++ i ) {
+    ans[i] = static_cast<bool>((row[i / 64] >> (i % 64)) & 1UL);
+  }
+  return ans;
+}
+
+// @brief 充足割当をまとめて求める．
+std::vector<std::uint64_t>
+BddSampler::sample_batch(
+  SizeType num,
+  std::mt19937& randgen
+) const
+{
+  auto n = row_size();
+  std::vector<std::uint64_t> ans(num * n);
+  for ( SizeType i = 0; i < num; ++ i ) {
+    sample_row(randgen, ans.data() + i * n);
+  }
+  return ans;
+}
+
+// @brief 1つの割当を row に書き込む．
+void
+BddSampler::sample_row(
+  std::mt19937& randgen,
+  std::uint64_t* row
+) const
+{
+  // まず全ての変数にランダムな値を割り当てておき，
+  // 経路上の変数の値だけを上書きする．
+  // 経路上で飛ばされた変数はどちらの値でも同数の割当を持つ．
+  auto n = row_size();
+  for ( SizeType i = 0; i < n; ++ i ) {
+    row[i] = random_word(randgen);
+  }
+  if ( mVarNum % 64 != 0 ) {
+    row[n - 1] &= (1UL << (mVarNum % 64)) - 1UL;
+  }
+
+  std::uniform_real_distribution<double> rd{0.0, 1.0};
+  auto edge = mRoot;
+  while ( edge > 1 ) {
+    auto& node = mNodeList[edge / 2 - 1];
+    auto inv = edge & 1UL;
+    auto edge0 = node.mEdge0 ^ inv;
+    auto edge1 = node.mEdge1 ^ inv;
+    // 1枝を選ぶ確率は d1 / (d0 + d1) = 1 / (1 + 2^(log d0 - log d1))
+    auto l0 = log_density(edge0);
+    auto l1 = log_density(edge1);
+    auto p1 = 1.0 / (1.0 + std::exp2(l0 - l1));
+    auto& word = row[node.mPos / 64];
+    auto bit = 1UL << (node.mPos % 64);
+    if ( rd(randgen) < p1 ) {
+      word |= bit;
+      edge = edge1;
+    }
+    else {
+      word &= ~bit;
+      edge = edge0;
+    }
+  }
+  ASSERT_COND( edge == 1 );
+}
+
+// @brief 枝の密度の対数を返す．
+double
+BddSampler::log_density(
+  SizeType edge
+) const
+{
+  if ( edge == 0 ) {
+    return -std::numeric_limits<double>::infinity();
+  }
+  if ( edge == 1 ) {
+    return 0.0;
+  }
+  auto& node = mNodeList[edge / 2 - 1];
+  return (edge & 1UL) ? node.mLogNega : node.mLogPosi;
+}
+
+END_NAMESPACE_YM_DD
@@ -56,9 +56,9 @@ BddSimp::simp_step(
   }
 
   // 演算結果テーブルを調べる．
-  Apply2Key key{on, dc};
-  if ( mTable.count(key) > 0 ) {
-    return mTable.at(key);
+  DdEdge result;
+  if ( find_result(BddOpCode::Simplify, on, dc, result) ) {
+    return result;
   }
 
   // 見つからなかったので実際に apply 演算を行う．
@@ -71,7 +71,6 @@ BddSimp::simp_step(
     dc0, dc1
   );
 
-  DdEdge result;
   if ( dc0.is_one() ) {
     result = simp_step(on1, dc1);
   }
@@ -83,7 +82,7 @@ BddSimp::simp_step(
     auto ans1 = simp_step(on1, dc1);
     result = new_node(top, ans0, ans1);
   }
-  mTable.emplace(key, result);
+  put_result(BddOpCode::Simplify, on, dc, result);
   return result;
 }
 
@@ -10,7 +10,6 @@
 
 #include "ym/logic.h"
 #include "BddOpBase.h"
-#include "Apply2Key.h"
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -47,15 +46,6 @@ public:
     DdEdge right
   );
 
-
-private:
-  //////////////////////////////////////////////////////////////////////
-  // データメンバ
-  //////////////////////////////////////////////////////////////////////
-
-  // simplify用のテーブル
-  std::unordered_map<Apply2Key, DdEdge> mTable;
-
 };
 
 END_NAMESPACE_YM_DD
@@ -260,6 +260,10 @@ BddSupOp::cup_step(
   if ( edge1.is_one() ) {
     return edge0;
   }
+  if ( edge0 == edge1 ) {
+    // 共通部分を辿り直さないようにする．
+    return edge0;
+  }
 
   auto node0 = edge0.node();
   auto node1 = edge1.node();
@@ -293,6 +297,9 @@ BddSupOp::cap_step(
   if ( edge0.is_one() || edge1.is_one() ) {
     return DdEdge::one();
   }
+  if ( edge0 == edge1 ) {
+    return edge0;
+  }
 
   auto node0 = edge0.node();
   auto node1 = edge1.node();
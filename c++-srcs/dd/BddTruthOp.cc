@@ -10,8 +10,10 @@
 #include "ym/BddMgr.h"
 #include "ym/BddVar.h"
 #include "ym/BddLit.h"
+#include "ym/TvFunc.h"
 #include "BddMgrImpl.h"
 #include "BddTruthOp.h"
+#include <algorithm>
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -30,6 +32,19 @@ log2(
   return y;
 }
 
+// 下位 2^ni ビットのマスクを返す．
+inline
+BddTruthOp::WordType
+word_mask(
+  SizeType ni
+)
+{
+  if ( ni >= 6 ) {
+    return ~0ULL;
+  }
+  return (1ULL << (1 << ni)) - 1ULL;
+}
+
 END_NONAMESPACE
 
 // @brief 真理値表形式の文字列からBDDを作る．
@@ -53,18 +68,65 @@ BddMgr::from_truth(
   else if ( var_list.size() != ni ) {
     throw std::invalid_argument{"var_list.size() mismatch"};
   }
-  tmp_var_list = var_list;
+  else {
+    tmp_var_list = var_list;
+  }
 
-  // str が適切な文字列か確認する．
-  for ( char c: str ) {
-    if ( c != '0' && c != '1' ) {
+  // str をパックされた真理値表に変換する．
+  // str の末尾が最小項 0 に対応し，var_list の先頭が MSB となる．
+  std::vector<BddTruthOp::WordType> word_list(BddTruthOp::word_num(ni), 0ULL);
+  for ( SizeType p = 0; p < n; ++ p ) {
+    char c = str[n - p - 1];
+    if ( c == '1' ) {
+      word_list[p / 64] |= 1ULL << (p % 64);
+    }
+    else if ( c != '0' ) {
       throw std::invalid_argument("only '0' or '1' are expected");
     }
   }
+  std::reverse(tmp_var_list.begin(), tmp_var_list.end());
+
+  auto edge_list = BddVar::conv_to_edgelist(tmp_var_list);
+  BddTruthOp op(get(), edge_list);
+  auto edge = op.op_step(word_list);
+  return _bdd(edge);
+}
+
+// @brief 真理値表から BDD を作る．
+Bdd
+BddMgr::from_tvfunc(
+  const TvFunc& func,
+  const std::vector<BddVar>& var_list
+)
+{
+  if ( func.is_invalid() ) {
+    throw std::invalid_argument{"func is invalid"};
+  }
+  auto ni = func.input_num();
+  std::vector<BddVar> tmp_var_list(ni);
+  if ( var_list.empty() ) {
+    for ( SizeType i = 0; i < ni; ++ i ) {
+      tmp_var_list[i] = variable(i);
+    }
+  }
+  else if ( var_list.size() < ni ) {
+    throw std::invalid_argument{"var_list.size() is too small"};
+  }
+  else {
+    for ( SizeType i = 0; i < ni; ++ i ) {
+      tmp_var_list[i] = var_list[i];
+    }
+  }
 
-  auto level_list = BddVar::conv_to_levellist(tmp_var_list);
-  BddTruthOp op(get(), level_list);
-  auto edge = op.op_step(str, 0);
+  auto nw = BddTruthOp::word_num(ni);
+  std::vector<BddTruthOp::WordType> word_list(nw);
+  for ( SizeType b = 0; b < nw; ++ b ) {
+    word_list[b] = func.raw_data(b);
+  }
+
+  auto edge_list = BddVar::conv_to_edgelist(tmp_var_list);
+  BddTruthOp op(get(), edge_list);
+  auto edge = op.op_step(word_list);
   return _bdd(edge);
 }
 
@@ -73,32 +135,148 @@ BddMgr::from_truth(
 // クラス BddTruthOp
 //////////////////////////////////////////////////////////////////////
 
-// @brief 真理値表の文字列からBDDを作る．
+// @brief コンストラクタ
+BddTruthOp::BddTruthOp(
+  BddMgrImpl* mgr,
+  const std::vector<DdEdge>& var_list
+) : BddOpBase{mgr}
+{
+  // レベルは演算の開始後に求める．
+  auto ni = var_list.size();
+  std::vector<SizeType> order(ni);
+  std::vector<SizeType> level_list(ni);
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    order[i] = i;
+    level_list[i] = var_list[i].node()->level();
+  }
+  // 下のレベル(大きい値)の入力ほど前に来るように並べる．
+  std::sort(order.begin(), order.end(),
+	    [&](SizeType a, SizeType b) {
+	      return level_list[a] > level_list[b];
+	    });
+  mLevelList.resize(ni);
+  mPosList.resize(ni);
+  for ( SizeType k = 0; k < ni; ++ k ) {
+    auto i = order[k];
+    if ( k > 0 && level_list[i] == mLevelList[k - 1] ) {
+      throw std::invalid_argument{"var_list contains duplicated variables"};
+    }
+    mLevelList[k] = level_list[i];
+    mPosList[i] = k;
+    if ( i != k ) {
+      mNeedPermute = true;
+    }
+  }
+}
+
+// @brief パックされた真理値表からBDDを作る．
 DdEdge
 BddTruthOp::op_step(
-  const std::string& str,
-  SizeType level
+  const std::vector<WordType>& word_list
+)
+{
+  auto ni = mLevelList.size();
+  auto nw = word_num(ni);
+  if ( word_list.size() != nw ) {
+    throw std::invalid_argument{"word_list.size() mismatch"};
+  }
+
+  std::vector<WordType> tmp_list;
+  if ( mNeedPermute ) {
+    tmp_list = permute(word_list, mPosList);
+  }
+  const auto& src_list = mNeedPermute ? tmp_list : word_list;
+
+  // まずワードごとに BDD を作る．
+  auto nw_ni = std::min(ni, static_cast<SizeType>(6));
+  std::vector<DdEdge> edge_list(nw);
+  for ( SizeType b = 0; b < nw; ++ b ) {
+    edge_list[b] = word_step(src_list[b], nw_ni);
+  }
+
+  // 隣り合う枝を組み合わせて上のレベルのノードを作る．
+  for ( SizeType k = 6; k < ni; ++ k ) {
+    auto level = mLevelList[k];
+    auto n = edge_list.size() / 2;
+    for ( SizeType j = 0; j < n; ++ j ) {
+      auto e0 = edge_list[j * 2 + 0];
+      auto e1 = edge_list[j * 2 + 1];
+      edge_list[j] = new_node(level, e0, e1);
+    }
+    edge_list.resize(n);
+  }
+  return edge_list[0];
+}
+
+// @brief 1ワード以内の真理値表からBDDを作る．
+DdEdge
+BddTruthOp::word_step(
+  WordType pat,
+  SizeType ni
 )
 {
-  if ( str == "0" ) {
+  auto mask = word_mask(ni);
+  pat &= mask;
+  if ( pat == 0ULL ) {
     return DdEdge::zero();
   }
-  if ( str == "1" ) {
+  if ( pat == mask ) {
     return DdEdge::one();
   }
-  if ( mTable.count(str) > 0 ) {
-    // 同じ文字列の結果が記録されていたらそれを用いる．
-    return mTable.at(str);
+
+  auto& table = mTable[ni];
+  if ( table.count(pat) > 0 ) {
+    return table.at(pat);
   }
 
-  SizeType n = str.size();
-  SizeType h = n / 2;
-  auto str0 = str.substr(h);
-  auto str1 = str.substr(0, h);
-  auto e0 = op_step(str0, level + 1);
-  auto e1 = op_step(str1, level + 1);
-  auto ans = new_node(level, e0, e1);
-  mTable.emplace(str, ans);
+  auto h = 1 << (ni - 1);
+  auto e0 = word_step(pat, ni - 1);
+  auto e1 = word_step(pat >> h, ni - 1);
+  auto ans = new_node(mLevelList[ni - 1], e0, e1);
+  table.emplace(pat, ans);
+  return ans;
+}
+
+// @brief 真理値表の入力を並べ替える．
+std::vector<BddTruthOp::WordType>
+BddTruthOp::permute(
+  const std::vector<WordType>& word_list,
+  const std::vector<SizeType>& pos_list
+)
+{
+  // 最小項の番号の変換を 8 ビットずつの表引きで行う．
+  auto ni = pos_list.size();
+  auto nt = (ni + 7) / 8;
+  std::vector<SizeType> conv_table(nt * 256, 0);
+  for ( SizeType t = 0; t < nt; ++ t ) {
+    for ( SizeType b = 0; b < 256; ++ b ) {
+      SizeType q = 0;
+      for ( SizeType k = 0; k < 8; ++ k ) {
+	auto i = t * 8 + k;
+	if ( i < ni && ((b >> k) & 1) ) {
+	  q |= 1UL << pos_list[i];
+	}
+      }
+      conv_table[t * 256 + b] = q;
+    }
+  }
+
+  std::vector<WordType> ans(word_list.size(), 0ULL);
+  auto mask = word_mask(ni);
+  for ( SizeType blk = 0; blk < word_list.size(); ++ blk ) {
+    // 1 のビットのみを移動させる．
+    auto pat = word_list[blk] & mask;
+    while ( pat != 0ULL ) {
+      auto s = __builtin_ctzll(pat);
+      pat &= pat - 1;
+      auto p = blk * 64 + s;
+      SizeType q = 0;
+      for ( SizeType t = 0; t < nt; ++ t ) {
+	q |= conv_table[t * 256 + ((p >> (t * 8)) & 255)];
+      }
+      ans[q / 64] |= 1ULL << (q % 64);
+    }
+  }
   return ans;
 }
 
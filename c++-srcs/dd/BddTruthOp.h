@@ -16,21 +16,36 @@ BEGIN_NAMESPACE_YM_DD
 
 //////////////////////////////////////////////////////////////////////
 /// @class BddTruthOp BddTruthOp.h "BddTruthOp.h"
-/// @brief 真理値表の文字列からBDDを作る演算
+/// @brief 真理値表からBDDを作る演算
+///
+/// 真理値表は 64 ビットのワードにパックされた形で受け取る．
+/// 最小項の番号 p の値は (p / 64) 番目のワードの (p % 64) ビット目に
+/// 格納されており，p の i ビット目が var_list[i] の値に対応する．
+///
+/// 入力の順番が変数順と異なる場合には，まずビットの並べ替えを行って
+/// 下のレベルの変数ほど下位のビットとなるようにする．
+/// その後，ワード内は 64 ビットのパタンをキーにした表を用いて，
+/// ワードより上の部分は隣り合う2つの枝を組み合わせることで，
+/// 下のレベルから順にノードを直接作る．
+/// そのため ITE 演算は一切用いない．
 //////////////////////////////////////////////////////////////////////
 class BddTruthOp :
   public BddOpBase
 {
+public:
+
+  using WordType = std::uint64_t;
+
 public:
 
   /// @brief コンストラクタ
+  ///
+  /// var_list に同じ変数が複数含まれていた場合には
+  /// std::invalid_argument 例外を送出する．
   BddTruthOp(
-    BddMgrImpl* mgr,                        ///< [in] マネージャ
-    const std::vector<SizeType>& index_list ///< [in] インデックスリスト
-  ) : BddOpBase{mgr},
-      mIndexList{index_list}
-  {
-  }
+    BddMgrImpl* mgr,                    ///< [in] マネージャ
+    const std::vector<DdEdge>& var_list ///< [in] 変数(を表す枝)のリスト
+  );
 
   /// @brief デストラクタ
   ~BddTruthOp() = default;
@@ -41,11 +56,46 @@ public:
   // 外部インターフェイス
   //////////////////////////////////////////////////////////////////////
 
-  /// @brief 真理値表の文字列からBDDを作る．
+  /// @brief パックされた真理値表からBDDを作る．
+  ///
+  /// word_list のサイズは word_num(var_list.size()) でなければならない．
   DdEdge
   op_step(
-    const std::string& str, ///< [in] 文字列
-    SizeType index          ///< [in] 先頭の変数インデックス
+    const std::vector<WordType>& word_list ///< [in] 真理値表
+  );
+
+  /// @brief 入力数 ni の真理値表を納めるのに必要なワード数を返す．
+  static
+  SizeType
+  word_num(
+    SizeType ni ///< [in] 入力数
+  )
+  {
+    return ni <= 6 ? 1 : (1UL << (ni - 6));
+  }
+
+  /// @brief 真理値表の入力を並べ替える．
+  /// @return 並べ替えた真理値表を返す．
+  ///
+  /// 元の i 番目の入力が pos_list[i] 番目の入力となる．
+  static
+  std::vector<WordType>
+  permute(
+    const std::vector<WordType>& word_list, ///< [in] 真理値表
+    const std::vector<SizeType>& pos_list   ///< [in] 移動先の位置のリスト
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 1ワード以内の真理値表からBDDを作る．
+  DdEdge
+  word_step(
+    WordType pat, ///< [in] ビットパタン
+    SizeType ni   ///< [in] 入力数 ( 0 <= ni <= 6 )
   );
 
 
@@ -54,11 +104,18 @@ private:
   // データメンバ
   //////////////////////////////////////////////////////////////////////
 
-  // 演算結果テーブル
-  std::unordered_map<std::string, DdEdge> mTable;
+  // 並べ替え後の入力位置ごとのレベル
+  // 0 番目が最も下のレベルとなる．
+  std::vector<SizeType> mLevelList;
+
+  // 元の入力ごとの並べ替え後の位置
+  std::vector<SizeType> mPosList;
+
+  // 並べ替えが必要な時 true にするフラグ
+  bool mNeedPermute{false};
 
-  // インデックスリスト
-  std::vector<SizeType> mIndexList;
+  // 入力数ごとのワード内のパタンをキーにした演算結果テーブル
+  std::unordered_map<WordType, DdEdge> mTable[7];
 
 };
 
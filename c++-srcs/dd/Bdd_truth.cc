@@ -8,9 +8,12 @@
 
 #include "ym/Bdd.h"
 #include "ym/BddVar.h"
+#include "ym/TvFunc.h"
 #include "BddMgrImpl.h"
+#include "BddTruthOp.h"
 #include "DdEdge.h"
 #include "DdNode.h"
+#include <algorithm>
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -18,24 +21,61 @@ BEGIN_NAMESPACE_YM_DD
 BEGIN_NONAMESPACE
 
 //////////////////////////////////////////////////////////////////////
-/// @class TruStrOp TruStrOp.h "TruStrOp.h"
-/// @brief 真理値表文字列を作る
+/// @class TruthWordOp
+/// @brief BDD からパックされた真理値表を作る
 ///
-/// 具体的には var_list を保持しているだけのクラス
+/// 真理値表の形式は BddTruthOp と同じ．
+/// 変数順に並べ替えた入力について，ノードと入力数をキーにして
+/// 結果を記録しておき，同じノードが現れた場合には
+/// 記録しておいた領域をワード単位でコピーする．
+/// 最後に元の入力の順にビットを並べ替える．
 //////////////////////////////////////////////////////////////////////
-class TruStrOp
+class TruthWordOp
 {
+public:
+
+  using WordType = BddTruthOp::WordType;
+
 public:
 
   /// @brief コンストラクタ
-  TruStrOp(
-    const std::vector<BddVar>& var_list ///< [in] 変数のリスト
-  ) : mVarList{var_list}
+  TruthWordOp(
+    const std::vector<DdEdge>& var_list ///< [in] 変数(を表す枝)のリスト
+  )
   {
+    auto ni = var_list.size();
+    std::vector<SizeType> order(ni);
+    std::vector<SizeType> level_list(ni);
+    for ( SizeType i = 0; i < ni; ++ i ) {
+      order[i] = i;
+      level_list[i] = var_list[i].node()->level();
+    }
+    // 下のレベル(大きい値)の入力ほど前に来るように並べる．
+    std::sort(order.begin(), order.end(),
+	      [&](SizeType a, SizeType b) {
+		return level_list[a] > level_list[b];
+	      });
+    mOrder.resize(ni);
+    for ( SizeType k = 0; k < ni; ++ k ) {
+      auto i = order[k];
+      auto level = level_list[i];
+      if ( mPosMap.count(level) > 0 ) {
+	throw std::invalid_argument{"var_list contains duplicated variables"};
+      }
+      mPosMap.emplace(level, k);
+      mOrder[k] = i;
+      if ( i != k ) {
+	mNeedPermute = true;
+      }
+    }
+    mWordTable.resize(std::min(ni, static_cast<SizeType>(6)) + 1);
+    if ( ni > 6 ) {
+      mBlockTable.resize(ni + 1);
+    }
   }
 
   /// @brief デストラクタ
-  ~TruStrOp() = default;
+  ~TruthWordOp() = default;
 
 
 public:
@@ -43,12 +83,27 @@ public:
   // 外部インターフェイス
   //////////////////////////////////////////////////////////////////////
 
-  std::string
+  /// @brief パックされた真理値表を作る．
+  std::vector<WordType>
   run(
-    const Bdd& bdd
-  ) const
+    DdEdge edge ///< [in] 根の枝
+  )
   {
-    return trustr_step(bdd, 0);
+    auto ni = mOrder.size();
+    std::vector<WordType> word_list(BddTruthOp::word_num(ni), 0ULL);
+    if ( ni <= 6 ) {
+      word_list[0] = word_step(edge, ni);
+    }
+    else {
+      mWordList = &word_list;
+      block_step(edge, ni, 0);
+      mWordList = nullptr;
+    }
+    if ( mNeedPermute ) {
+      // 並べ替え後の k 番目の入力を mOrder[k] 番目に戻す．
+      word_list = BddTruthOp::permute(word_list, mOrder);
+    }
+    return word_list;
   }
 
 
@@ -57,11 +112,117 @@ private:
   // 内部で用いられる関数
   //////////////////////////////////////////////////////////////////////
 
-  std::string
-  trustr_step(
-    const Bdd& bdd,
-    SizeType pos
-  ) const;
+  /// @brief ノードの変数の並べ替え後の位置を返す．
+  ///
+  /// var_list に含まれていない場合には例外を送出する．
+  SizeType
+  node_pos(
+    const DdNode* node
+  ) const
+  {
+    auto p = mPosMap.find(node->level());
+    if ( p == mPosMap.end() ) {
+      throw std::invalid_argument("Bdd::to_truth(var_list): invalid var_list");
+    }
+    return p->second;
+  }
+
+  /// @brief 入力数 ni (<= 6) の真理値表のパタンを求める．
+  WordType
+  word_step(
+    DdEdge edge,
+    SizeType ni
+  )
+  {
+    auto w = 1 << ni;
+    WordType mask = ni >= 6 ? ~0ULL : ((1ULL << w) - 1ULL);
+    if ( edge.is_zero() ) {
+      return 0ULL;
+    }
+    if ( edge.is_one() ) {
+      return mask;
+    }
+    auto node = edge.node();
+    WordType inv_mask = edge.inv() ? mask : 0ULL;
+    auto& table = mWordTable[ni];
+    if ( table.count(node) > 0 ) {
+      return table.at(node) ^ inv_mask;
+    }
+
+    // ni == 0 でノードが現れることはない．
+    auto h = w / 2;
+    WordType pat;
+    if ( node_pos(node) == ni - 1 ) {
+      auto pat0 = word_step(node->edge0(), ni - 1);
+      auto pat1 = word_step(node->edge1(), ni - 1);
+      pat = pat0 | (pat1 << h);
+    }
+    else {
+      auto pat0 = word_step(DdEdge{node, false}, ni - 1);
+      pat = pat0 | (pat0 << h);
+    }
+    table.emplace(node, pat);
+    return pat ^ inv_mask;
+  }
+
+  /// @brief 入力数 ni (> 6) の真理値表を offset 以降に書き込む．
+  void
+  block_step(
+    DdEdge edge,
+    SizeType ni,
+    SizeType offset
+  )
+  {
+    auto& word_list = *mWordList;
+    auto nw = 1UL << (ni - 6);
+    auto begin = word_list.begin() + offset;
+    if ( edge.is_const() ) {
+      auto pat = edge.is_one() ? ~0ULL : 0ULL;
+      std::fill(begin, begin + nw, pat);
+      return;
+    }
+
+    auto node = edge.node();
+    auto inv = edge.inv();
+    auto& table = mBlockTable[ni];
+    if ( table.count(node) > 0 ) {
+      // 一度書き込んだ領域をコピーする．
+      auto& p = table.at(node);
+      auto src = word_list.begin() + p.first;
+      if ( p.second == inv ) {
+	std::copy(src, src + nw, begin);
+      }
+      else {
+	std::transform(src, src + nw, begin,
+		       [](WordType w) { return ~w; });
+      }
+      return;
+    }
+
+    auto h = nw / 2;
+    if ( node_pos(node) == ni - 1 ) {
+      auto e0 = node->edge0() ^ inv;
+      auto e1 = node->edge1() ^ inv;
+      if ( ni == 7 ) {
+	word_list[offset] = word_step(e0, 6);
+	word_list[offset + 1] = word_step(e1, 6);
+      }
+      else {
+	block_step(e0, ni - 1, offset);
+	block_step(e1, ni - 1, offset + h);
+      }
+    }
+    else {
+      if ( ni == 7 ) {
+	word_list[offset] = word_step(edge, 6);
+      }
+      else {
+	block_step(edge, ni - 1, offset);
+      }
+      std::copy(begin, begin + h, begin + h);
+    }
+    table.emplace(node, std::make_pair(offset, inv));
+  }
 
 
 private:
@@ -69,35 +230,28 @@ private:
   // データメンバ
   //////////////////////////////////////////////////////////////////////
 
-  // 変数のリスト
-  std::vector<BddVar> mVarList;
+  // レベルをキーにして並べ替え後の入力位置を保持する辞書
+  std::unordered_map<SizeType, SizeType> mPosMap;
 
-};
+  // 並べ替え後の位置ごとの元の入力番号
+  std::vector<SizeType> mOrder;
 
-std::string
-TruStrOp::trustr_step(
-  const Bdd& bdd,
-  SizeType pos
-) const
-{
-  if ( pos >= mVarList.size() ) {
-    if ( bdd.is_zero() ) {
-      return "0";
-    }
-    if ( bdd.is_one() ) {
-      return "1";
-    }
-    throw std::invalid_argument("Bdd::to_truth(var_list): invalid var_list");
-  }
-  auto var = mVarList[pos];
-  // bdd を var で分解する．
-  auto bdd0 = bdd / ~var;
-  auto bdd1 = bdd / var;
-  auto ans0 = trustr_step(bdd0, pos + 1);
-  auto ans1 = trustr_step(bdd1, pos + 1);
-  auto ans = ans1 + ans0;
-  return ans;
-}
+  // 並べ替えが必要な時 true にするフラグ
+  bool mNeedPermute{false};
+
+  // 入力数ごとのワード内のパタンの表
+  // 正極性のパタンを記録する．
+  std::vector<std::unordered_map<const DdNode*, WordType>> mWordTable;
+
+  // 入力数ごとの書き込み済みの領域の表
+  // 値は (先頭の位置, 反転属性)
+  std::vector<std::unordered_map<const DdNode*,
+				 std::pair<SizeType, bool>>> mBlockTable;
+
+  // 結果を書き込むワードのリスト
+  std::vector<WordType>* mWordList{nullptr};
+
+};
 
 END_NONAMESPACE
 
@@ -111,8 +265,34 @@ Bdd::to_truth(
     // 不正値の場合には空文字列を返す．
     return std::string{};
   }
-  TruStrOp op{var_list};
-  return op.run(*this);
+  // var_list の先頭が MSB となるので逆順にする．
+  auto edge_list = BddVar::conv_to_edgelist(var_list);
+  std::reverse(edge_list.begin(), edge_list.end());
+  TruthWordOp op{edge_list};
+  auto word_list = op.run(root());
+  SizeType n = 1UL << var_list.size();
+  std::string ans(n, '0');
+  for ( SizeType p = 0; p < n; ++ p ) {
+    if ( (word_list[p / 64] >> (p % 64)) & 1 ) {
+      ans[n - p - 1] = '1';
+    }
+  }
+  return ans;
+}
+
+// @brief 内容を真理値表に変換する．
+TvFunc
+Bdd::to_tvfunc(
+  const std::vector<BddVar>& var_list
+) const
+{
+  if ( is_invalid() ) {
+    return TvFunc::invalid();
+  }
+  auto edge_list = BddVar::conv_to_edgelist(var_list);
+  TruthWordOp op{edge_list};
+  auto word_list = op.run(root());
+  return TvFunc::from_raw_data(var_list.size(), std::move(word_list));
 }
 
 END_NAMESPACE_YM_DD
@@ -0,0 +1,194 @@
+
+/// @file DdBigUint.cc
+/// @brief DdBigUint の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "DdBigUint.h"
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+//////////////////////////////////////////////////////////////////////
+// クラス DdBigUint
+//////////////////////////////////////////////////////////////////////
+
+// @brief 加算付き代入
+DdBigUint&
+DdBigUint::operator+=(
+  const DdBigUint& right
+)
+{
+  auto n = right.mBody.size();
+  if ( mBody.size() < n ) {
+    mBody.resize(n, 0);
+  }
+  std::uint64_t carry = 0;
+  for ( SizeType i = 0; i < mBody.size(); ++ i ) {
+    if ( i >= n && carry == 0 ) {
+      break;
+    }
+    std::uint64_t v = mBody[i];
+    v += carry;
+    if ( i < n ) {
+      v += right.mBody[i];
+    }
+    mBody[i] = static_cast<std::uint32_t>(v);
+    carry = v >> 32;
+  }
+  if ( carry != 0 ) {
+    mBody.push_back(static_cast<std::uint32_t>(carry));
+  }
+  return *this;
+}
+
+// @brief 減算付き代入
+DdBigUint&
+DdBigUint::operator-=(
+  const DdBigUint& right
+)
+{
+  auto n = right.mBody.size();
+  ASSERT_COND( mBody.size() >= n );
+  std::int64_t borrow = 0;
+  for ( SizeType i = 0; i < mBody.size(); ++ i ) {
+    if ( i >= n && borrow == 0 ) {
+      break;
+    }
+    std::int64_t v = mBody[i];
+    v -= borrow;
+    if ( i < n ) {
+      v -= right.mBody[i];
+    }
+    if ( v < 0 ) {
+      v += (1LL << 32);
+      borrow = 1;
+    }
+    else {
+      borrow = 0;
+    }
+    mBody[i] = static_cast<std::uint32_t>(v);
+  }
+  ASSERT_COND( borrow == 0 );
+  normalize();
+  return *this;
+}
+
+// @brief 左シフト付き代入(2^k 倍)
+DdBigUint&
+DdBigUint::operator<<=(
+  SizeType k
+)
+{
+  if ( is_zero() ) {
+    return *this;
+  }
+  auto wshift = k / 32;
+  auto bshift = k % 32;
+  if ( bshift > 0 ) {
+    std::uint32_t carry = 0;
+    for ( auto& w: mBody ) {
+      auto v = w;
+      w = (v << bshift) | carry;
+      carry = v >> (32 - bshift);
+    }
+    if ( carry != 0 ) {
+      mBody.push_back(carry);
+    }
+  }
+  if ( wshift > 0 ) {
+    mBody.insert(mBody.begin(), wshift, 0);
+  }
+  return *this;
+}
+
+// @brief 右シフト付き代入(2^k で割って切り捨て)
+DdBigUint&
+DdBigUint::operator>>=(
+  SizeType k
+)
+{
+  auto wshift = k / 32;
+  auto bshift = k % 32;
+  if ( wshift >= mBody.size() ) {
+    mBody.clear();
+    return *this;
+  }
+  mBody.erase(mBody.begin(), mBody.begin() + wshift);
+  if ( bshift > 0 ) {
+    auto n = mBody.size();
+    for ( SizeType i = 0; i < n; ++ i ) {
+      auto v = mBody[i] >> bshift;
+      if ( i + 1 < n ) {
+	v |= mBody[i + 1] << (32 - bshift);
+      }
+      mBody[i] = v;
+    }
+  }
+  normalize();
+  return *this;
+}
+
+// @brief SizeType に変換する．
+SizeType
+DdBigUint::to_size() const
+{
+  SizeType ans = 0;
+  auto n = std::min(mBody.size(), sizeof(SizeType) / 4);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    ans |= static_cast<SizeType>(mBody[i]) << (i * 32);
+  }
+  return ans;
+}
+
+// @brief double に変換する．
+double
+DdBigUint::to_double() const
+{
+  // 上位の3ワードだけ見れば double の精度には十分
+  double ans = 0.0;
+  auto n = mBody.size();
+  auto start = n > 3 ? n - 3 : 0;
+  for ( SizeType i = n; i -- > start; ) {
+    ans = ans * 4294967296.0 + mBody[i];
+  }
+  return std::ldexp(ans, static_cast<int>(start * 32));
+}
+
+// @brief 10進表記の文字列に変換する．
+std::string
+DdBigUint::to_string() const
+{
+  if ( is_zero() ) {
+    return "0";
+  }
+  // 10^9 で割った余りを下位から求める．
+  const std::uint32_t BASE = 1000000000U;
+  std::vector<std::uint32_t> tmp{mBody};
+  std::vector<std::uint32_t> digit_list;
+  while ( !tmp.empty() ) {
+    std::uint64_t rem = 0;
+    for ( SizeType i = tmp.size(); i -- > 0; ) {
+      auto v = (rem << 32) | tmp[i];
+      tmp[i] = static_cast<std::uint32_t>(v / BASE);
+      rem = v % BASE;
+    }
+    digit_list.push_back(static_cast<std::uint32_t>(rem));
+    while ( !tmp.empty() && tmp.back() == 0 ) {
+      tmp.pop_back();
+    }
+  }
+  std::ostringstream buf;
+  buf << digit_list.back();
+  for ( SizeType i = digit_list.size() - 1; i -- > 0; ) {
+    buf << std::setw(9) << std::setfill('0') << digit_list[i];
+  }
+  return buf.str();
+}
+
+END_NAMESPACE_YM_DD
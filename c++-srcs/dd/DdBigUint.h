@@ -0,0 +1,164 @@
+#ifndef DDBIGUINT_H
+#define DDBIGUINT_H
+
+/// @file DdBigUint.h
+/// @brief DdBigUint のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+
+
+BEGIN_NAMESPACE_YM_DD
+
+//////////////////////////////////////////////////////////////////////
+/// @class DdBigUint DdBigUint.h "DdBigUint.h"
+/// @brief 多倍長の符号なし整数
+///
+/// 解の数を数えるために用いるので
+/// 加算，減算，2のべき乗の乗除算のみをサポートする．
+/// 内部では 32 ビットのワードを下位から順に並べている．
+/// 最上位のワードは 0 にならないように正規化されている．
+//////////////////////////////////////////////////////////////////////
+class DdBigUint
+{
+public:
+
+  /// @brief 値を指定したコンストラクタ
+  explicit
+  DdBigUint(
+    std::uint64_t val = 0 ///< [in] 値
+  )
+  {
+    while ( val != 0 ) {
+      mBody.push_back(static_cast<std::uint32_t>(val));
+      val >>= 32;
+    }
+  }
+
+  /// @brief 2のべき乗を作る．
+  static
+  DdBigUint
+  pow2(
+    SizeType k ///< [in] 指数
+  )
+  {
+    DdBigUint ans{1};
+    ans <<= k;
+    return ans;
+  }
+
+  /// @brief デストラクタ
+  ~DdBigUint() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 0 の時 true を返す．
+  bool
+  is_zero() const
+  {
+    return mBody.empty();
+  }
+
+  /// @brief 加算付き代入
+  DdBigUint&
+  operator+=(
+    const DdBigUint& right ///< [in] オペランド
+  );
+
+  /// @brief 減算付き代入
+  ///
+  /// right は自分以下でなければならない．
+  DdBigUint&
+  operator-=(
+    const DdBigUint& right ///< [in] オペランド
+  );
+
+  /// @brief 左シフト付き代入(2^k 倍)
+  DdBigUint&
+  operator<<=(
+    SizeType k ///< [in] シフト量
+  );
+
+  /// @brief 右シフト付き代入(2^k で割って切り捨て)
+  DdBigUint&
+  operator>>=(
+    SizeType k ///< [in] シフト量
+  );
+
+  /// @brief 等価比較
+  bool
+  operator==(
+    const DdBigUint& right ///< [in] オペランド
+  ) const
+  {
+    return mBody == right.mBody;
+  }
+
+  /// @brief 非等価比較
+  bool
+  operator!=(
+    const DdBigUint& right ///< [in] オペランド
+  ) const
+  {
+    return !operator==(right);
+  }
+
+  /// @brief SizeType に収まる時 true を返す．
+  bool
+  fits_size() const
+  {
+    return mBody.size() * 32 <= sizeof(SizeType) * 8;
+  }
+
+  /// @brief SizeType に変換する．
+  ///
+  /// 収まらない場合には上位のビットは失われる．
+  SizeType
+  to_size() const;
+
+  /// @brief double に変換する．
+  ///
+  /// 表現できない場合には無限大となる．
+  double
+  to_double() const;
+
+  /// @brief 10進表記の文字列に変換する．
+  std::string
+  to_string() const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 上位の 0 のワードを取り除く．
+  void
+  normalize()
+  {
+    while ( !mBody.empty() && mBody.back() == 0 ) {
+      mBody.pop_back();
+    }
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 本体
+  std::vector<std::uint32_t> mBody;
+
+};
+
+END_NAMESPACE_YM_DD
+
+#endif // DDBIGUINT_H
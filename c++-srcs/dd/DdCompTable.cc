@@ -0,0 +1,114 @@
+
+/// @file DdCompTable.cc
+/// @brief DdCompTable の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "DdCompTable.h"
+#include "DdNode.h"
+
+
+BEGIN_NAMESPACE_YM_DD
+
+BEGIN_NONAMESPACE
+
+// テーブルの最小サイズ
+const SizeType MIN_SIZE = 1024;
+
+// キーに含まれるノードが削除予定なら true を返す．
+//
+// タグのビット(下位3ビットのうち上位2ビット)は無視する．
+// 第3オペランドの位置の二項演算用タグはノードを含まない．
+inline
+bool
+is_dead(
+  PtrIntType body
+)
+{
+  auto node = reinterpret_cast<const DdNode*>(body & ~7UL);
+  return node != nullptr && node->ref_count() == 0;
+}
+
+inline
+bool
+is_dead_key2(
+  PtrIntType body
+)
+{
+  if ( body & 2UL ) {
+    // 二項演算用のタグ
+    return false;
+  }
+  return is_dead(body);
+}
+
+END_NONAMESPACE
+
+// @brief コンストラクタ
+DdCompTable::DdCompTable(
+  SizeType size
+)
+{
+  resize(size);
+}
+
+// @brief デストラクタ
+DdCompTable::~DdCompTable()
+{
+  delete [] mTable;
+  delete [] mStatus;
+}
+
+// @brief 参照回数が 0 のノードを含むエントリを削除する．
+void
+DdCompTable::sweep()
+{
+  for ( SizeType i = 0; i < mSize; ++ i ) {
+    auto& cell = mTable[i];
+    if ( cell.mKey0 == 0UL ) {
+      continue;
+    }
+    if ( is_dead(cell.mKey0) ||
+	 is_dead(cell.mKey1) ||
+	 is_dead_key2(cell.mKey2) ||
+	 is_dead(cell.mResult) ) {
+      cell.clear();
+    }
+  }
+}
+
+// @brief 全てのエントリを削除する．
+void
+DdCompTable::clear()
+{
+  for ( SizeType i = 0; i < mSize; ++ i ) {
+    mTable[i].clear();
+  }
+}
+
+// @brief サイズを変更する．
+void
+DdCompTable::resize(
+  SizeType size
+)
+{
+  SizeType new_size = MIN_SIZE;
+  SizeType shift = 64 - 10;
+  while ( new_size < size ) {
+    new_size <<= 1;
+    -- shift;
+  }
+  delete [] mTable;
+  delete [] mStatus;
+  mSize = new_size;
+  mShift = shift;
+  mTable = new Cell[mSize];
+  mStatus = new std::atomic<std::uint32_t>[mSize];
+  for ( SizeType i = 0; i < mSize; ++ i ) {
+    mStatus[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+END_NAMESPACE_YM_DD
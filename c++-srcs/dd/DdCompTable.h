@@ -0,0 +1,255 @@
+#ifndef DDCOMPTABLE_H
+#define DDCOMPTABLE_H
+
+/// @file DdCompTable.h
+/// @brief DdCompTable のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "DdEdge.h"
+#include <atomic>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+//////////////////////////////////////////////////////////////////////
+/// @class DdCompTable DdCompTable.h "DdCompTable.h"
+/// @brief 演算結果を保持するテーブル
+///
+/// マネージャごとに一つ持ち，全ての演算で共有する．
+/// 固定サイズのハッシュ表で，衝突した場合には古いエントリを上書きする．
+/// そのため，登録したエントリが後で見つかるとは限らない．
+///
+/// キーは3つの枝で表す．
+/// - ITE 系の演算(AND, XOR, ITE)は3つのオペランドをそのままキーとする．
+/// - 二項演算は第3オペランドの位置に op_tag() で作ったタグを置く．
+/// - ITE 以外の三項演算は第1オペランドを tag_edge() でタグ付けする．
+///
+/// 通常の枝はポインタの下位3ビットのうち最下位ビットしか使わないので
+/// これらのタグは通常の枝と衝突しない．
+/// なお，第1オペランドは定数であってはならない．
+///
+/// エントリは参照しているノードが削除されると無効になるので
+/// GC の直前に sweep() を呼ぶ必要がある．
+///
+/// 並列実行中は複数のスレッドから find() と put() が呼ばれる．
+/// 各エントリは状態ワード(ロックビット＋版数)を持ち，
+/// put() はロックが取れなければ登録をあきらめ，
+/// find() は読み出しの前後で状態ワードが変化していたら見つからなかった
+/// ことにする．そのためどちらもブロックしない．
+//////////////////////////////////////////////////////////////////////
+class DdCompTable
+{
+public:
+
+  /// @brief コンストラクタ
+  DdCompTable(
+    SizeType size = 1UL << 16 ///< [in] エントリ数(2のべき乗に切り上げる)
+  );
+
+  /// @brief デストラクタ
+  ~DdCompTable();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 二項演算用のタグを作る．
+  static
+  DdEdge
+  op_tag(
+    SizeType op ///< [in] 演算コード
+  )
+  {
+    return DdEdge{(op << 3) | 2UL};
+  }
+
+  /// @brief 三項演算用に枝にタグを付ける．
+  ///
+  /// op は 1 〜 3 でなければならない．
+  static
+  DdEdge
+  tag_edge(
+    DdEdge edge, ///< [in] 第1オペランドの枝
+    SizeType op  ///< [in] 演算コード
+  )
+  {
+    ASSERT_COND( 1 <= op && op <= 3 );
+    return DdEdge{edge.body() | (op << 1)};
+  }
+
+  /// @brief エントリ数を返す．
+  SizeType
+  size() const
+  {
+    return mSize;
+  }
+
+  /// @brief 結果を探す．
+  /// @return 見つかったら true を返す．
+  bool
+  find(
+    DdEdge e0,     ///< [in] オペランド1
+    DdEdge e1,     ///< [in] オペランド2
+    DdEdge e2,     ///< [in] オペランド3
+    DdEdge& result ///< [out] 結果を格納する変数
+  ) const
+  {
+    auto pos = hash_func(e0, e1, e2);
+    auto& status = mStatus[pos];
+    auto s0 = status.load(std::memory_order_acquire);
+    if ( s0 & LOCK_BIT ) {
+      // 書き込み中
+      return false;
+    }
+    auto& cell = mTable[pos];
+    auto key0 = cell.mKey0.load(std::memory_order_relaxed);
+    auto key1 = cell.mKey1.load(std::memory_order_relaxed);
+    auto key2 = cell.mKey2.load(std::memory_order_relaxed);
+    auto val = cell.mResult.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if ( status.load(std::memory_order_relaxed) != s0 ) {
+      // 読んでいる間に書き換えられた．
+      return false;
+    }
+    if ( key0 == e0.body() && key1 == e1.body() && key2 == e2.body() ) {
+      result = DdEdge{val};
+      return true;
+    }
+    return false;
+  }
+
+  /// @brief 結果を登録する．
+  ///
+  /// 同じ位置にあったエントリは上書きされる．
+  /// 他のスレッドが同じ位置に書き込み中の場合は何もしない．
+  void
+  put(
+    DdEdge e0,    ///< [in] オペランド1
+    DdEdge e1,    ///< [in] オペランド2
+    DdEdge e2,    ///< [in] オペランド3
+    DdEdge result ///< [in] 結果
+  )
+  {
+    auto pos = hash_func(e0, e1, e2);
+    auto& status = mStatus[pos];
+    auto s0 = status.load(std::memory_order_relaxed);
+    if ( (s0 & LOCK_BIT) ||
+	 !status.compare_exchange_strong(s0, s0 | LOCK_BIT,
+					 std::memory_order_acq_rel) ) {
+      return;
+    }
+    // ロックの獲得がデータの書き込みより先に見えるようにする．
+    std::atomic_thread_fence(std::memory_order_release);
+    auto& cell = mTable[pos];
+    cell.mKey0.store(e0.body(), std::memory_order_relaxed);
+    cell.mKey1.store(e1.body(), std::memory_order_relaxed);
+    cell.mKey2.store(e2.body(), std::memory_order_relaxed);
+    cell.mResult.store(result.body(), std::memory_order_relaxed);
+    // ロックを外して版数を一つ進める．
+    status.store(s0 + VERSION_INC, std::memory_order_release);
+  }
+
+  /// @brief 参照回数が 0 のノードを含むエントリを削除する．
+  ///
+  /// GC でノードが削除される前に呼ぶ必要がある．
+  void
+  sweep();
+
+  /// @brief 全てのエントリを削除する．
+  void
+  clear();
+
+  /// @brief サイズを変更する．
+  ///
+  /// 内容はクリアされる．
+  void
+  resize(
+    SizeType size ///< [in] エントリ数(2のべき乗に切り上げる)
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief エントリ
+  ///
+  /// 2つで1キャッシュラインに収まるように 32 バイト境界に揃える．
+  /// 並列実行時のデータ競合を避けるためにアトミック変数を用いるが，
+  /// relaxed なアクセスは通常のロード/ストアと同じになる．
+  struct alignas(32) Cell
+  {
+    std::atomic<PtrIntType> mKey0{0};
+    std::atomic<PtrIntType> mKey1{0};
+    std::atomic<PtrIntType> mKey2{0};
+    std::atomic<PtrIntType> mResult{0};
+
+    /// @brief 内容をクリアする．
+    void
+    clear()
+    {
+      mKey0.store(0, std::memory_order_relaxed);
+      mKey1.store(0, std::memory_order_relaxed);
+      mKey2.store(0, std::memory_order_relaxed);
+      mResult.store(0, std::memory_order_relaxed);
+    }
+  };
+
+  // 状態ワードのロックビット
+  static
+  const std::uint32_t LOCK_BIT = 1U;
+
+  // 状態ワードの版数の増分
+  static
+  const std::uint32_t VERSION_INC = 2U;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ハッシュ関数
+  SizeType
+  hash_func(
+    DdEdge e0,
+    DdEdge e1,
+    DdEdge e2
+  ) const
+  {
+    auto h = e0.body() * 0x9E3779B97F4A7C15UL;
+    h ^= e1.body() * 0xC2B2AE3D27D4EB4FUL;
+    h ^= e2.body() * 0x165667B19E3779F9UL;
+    return static_cast<SizeType>(h >> mShift);
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // エントリ数
+  SizeType mSize{0};
+
+  // ハッシュ値を求める時のシフト量
+  SizeType mShift{0};
+
+  // 表の本体
+  Cell* mTable{nullptr};
+
+  // 状態ワードの配列
+  std::atomic<std::uint32_t>* mStatus{nullptr};
+
+};
+
+END_NAMESPACE_YM_DD
+
+#endif // DDCOMPTABLE_H
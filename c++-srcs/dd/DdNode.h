@@ -31,6 +31,7 @@ class DdNode
 {
   friend class DdNodeMgr;
   friend class DdNodeTable;
+  friend class DdNodePool;
 public:
 
   /// @brief コンストラクタ
@@ -118,7 +119,12 @@ private:
 
   // 参照回数
   mutable
-  SizeType mRefCount{0};
+  std::uint32_t mRefCount{0};
+
+  // 参照回数が 0 になったが子供の参照回数をまだ減らしていない時
+  // true となるフラグ
+  mutable
+  bool mPending{false};
 
   // ノードテーブル用のリンク
   mutable
@@ -40,7 +40,7 @@ SizeType
 DdNodeMgr::new_variable()
 {
   auto varid = mTableArray.size();
-  auto table = new DdNodeTable{varid};
+  auto table = new DdNodeTable{varid, mNodePool};
   // 追加される変数のレベルは最初は変数番号に等しい
   auto level = varid;
   mTableArray.push_back(table);
@@ -59,22 +59,80 @@ DdNodeMgr::new_node(
   _check_level(level);
   auto table = mTableArray[level];
   DdNode* node = nullptr;
+  if ( mConcurrent ) {
+    if ( table->new_node_mt(level, edge0, edge1, node) ) {
+      mMtNodeNum.fetch_add(1, std::memory_order_relaxed);
+    }
+    return node;
+  }
+
+  if ( table->is_full() && table->is_dirty() ) {
+    // テーブルを拡張する代わりに GC で空きを作れるかもしれない．
+    // ただし，演算の途中では GC を行えないので次のセーフポイントで行う．
+    mGcRequest = true;
+  }
   if ( table->new_node(level, edge0, edge1, node) ) {
     ++ mNodeNum;
     ++ mGarbageNum;
+    mark_dirty(node);
   }
   return node;
 }
 
-// @brief ノードを登録する．
+// @brief 演算に用いるスレッド数を設定する．
+void
+DdNodeMgr::set_thread_num(
+  SizeType num
+)
+{
+  if ( num == 0 ) {
+    num = std::thread::hardware_concurrency();
+  }
+  if ( num == thread_num() ) {
+    return;
+  }
+  if ( num <= 1 ) {
+    mWorkerPool = nullptr;
+  }
+  else {
+    mWorkerPool.reset(new DdWorkerPool{num});
+  }
+}
+
+// @brief 並列実行区間を開始する．
+void
+DdNodeMgr::begin_concurrent()
+{
+  mConcurrent = true;
+  mMtNodeNum = 0;
+  mWorkerPool->begin();
+}
+
+// @brief 並列実行区間を終了する．
+void
+DdNodeMgr::end_concurrent()
+{
+  mWorkerPool->end();
+  mConcurrent = false;
+  auto n = mMtNodeNum.load();
+  mNodeNum += n;
+  mGarbageNum += n;
+  if ( n > 0 ) {
+    // どのテーブルにノードが追加されたかはわからない．
+    mAllDirty = true;
+  }
+}
+
+// @brief move_out() で取り出したノードを登録する．
 void
-DdNodeMgr::reg_node(
+DdNodeMgr::move_in(
   DdNode* node
 )
 {
   auto level = node->level();
+  _check_level(level);
   auto table = mTableArray[level];
-  table->reg_node(node);
+  table->move_in(node);
 }
 
 // @brief ノード(枝)の参照回数を増やす．
@@ -93,39 +151,88 @@ DdNodeMgr::deactivate(
 )
 {
   dec_ref(edge);
-  garbage_collection();
 }
 
 // @brief ノード(枝)の参照回数を増やす．
+//
+// 参照回数が 0 から 1 になったノードは子供の参照回数も増やす．
+// ただし，保留中のノードは子供の参照回数を減らしていないので
+// 印を消すだけでよい．
+// 深いグラフでスタックがあふれないように再帰は用いずに
+// 明示的なスタックを用いる．
 void
 DdNodeMgr::inc_ref(
   DdEdge edge
 )
 {
   auto node = edge.node();
-  if ( node != nullptr ) {
+  if ( node == nullptr ) {
+    return;
+  }
+  mRefStack.clear();
+  mRefStack.push_back(node);
+  while ( !mRefStack.empty() ) {
+    auto node = mRefStack.back();
+    mRefStack.pop_back();
     ++ node->mRefCount;
     if ( node->mRefCount == 1 ) {
       -- mGarbageNum;
-      inc_ref(node->edge0());
-      inc_ref(node->edge1());
+      if ( node->mPending ) {
+	node->mPending = false;
+      }
+      else {
+	push_children(node);
+      }
     }
   }
 }
 
 // @brief ノード(枝)の参照回数を減らす．
+//
+// 参照回数が 1 から 0 になったノードは保留の印を付けて
+// mPendingList に積んでおく．
 void
 DdNodeMgr::dec_ref(
   DdEdge edge
 )
 {
   auto node = edge.node();
-  if ( node != nullptr ) {
+  if ( node == nullptr ) {
+    return;
+  }
+  -- node->mRefCount;
+  if ( node->mRefCount == 0 ) {
+    ++ mGarbageNum;
+    node->mPending = true;
+    mPendingList.push_back(node);
+    mark_dirty(node);
+  }
+}
+
+// @brief 保留中のノードの子供の参照回数を減らす．
+//
+// 参照回数が 1 から 0 になった子供はさらにその子供の参照回数を減らす．
+void
+DdNodeMgr::release_pending()
+{
+  mRefStack.clear();
+  for ( auto node: mPendingList ) {
+    // 再び参照されたノードは印が消えている．
+    // 同じノードが複数回積まれている場合もある．
+    if ( node->mPending ) {
+      node->mPending = false;
+      push_children(node);
+    }
+  }
+  mPendingList.clear();
+  while ( !mRefStack.empty() ) {
+    auto node = mRefStack.back();
+    mRefStack.pop_back();
     -- node->mRefCount;
     if ( node->mRefCount == 0 ) {
       ++ mGarbageNum;
-      dec_ref(node->edge0());
-      dec_ref(node->edge1());
+      mark_dirty(node);
+      push_children(node);
     }
   }
 }
@@ -134,14 +241,66 @@ DdNodeMgr::dec_ref(
 void
 DdNodeMgr::garbage_collection()
 {
-  if ( mGcEnable && mGarbageNum >= mGcLimit ) {
+  if ( !mGcEnable ) {
+    return;
+  }
+  mGcRequest = false;
+  if ( !sweep_garbage() ) {
+    // 削除するノードはなかった．
+    return;
+  }
+  update_gc_threshold();
+  after_gc();
+}
+
+// @brief 参照されていないノードを削除する．
+bool
+DdNodeMgr::sweep_garbage()
+{
+  release_pending();
+  if ( mDirtyList.empty() && !mAllDirty ) {
+    return false;
+  }
+
+  before_gc();
+  auto sweep = [&](DdNodeTable* table) {
+    auto n = table->garbage_collection();
+    mNodeNum -= n;
+    table->set_dirty(false);
+  };
+  if ( mAllDirty ) {
     for ( auto table: mTableArray ) {
-      auto n = table->garbage_collection();
-      mNodeNum -= n;
+      sweep(table);
     }
-    mGarbageNum = 0;
   }
-  after_gc();
+  else {
+    for ( auto table: mDirtyList ) {
+      sweep(table);
+    }
+  }
+  mDirtyList.clear();
+  mAllDirty = false;
+  mGarbageNum = 0;
+  return true;
+}
+
+// @brief GC を起動するしきい値を更新する．
+void
+DdNodeMgr::update_gc_threshold()
+{
+  auto live_num = mNodeNum - mGarbageNum;
+  SizeType size = 0;
+  for ( auto table: mTableArray ) {
+    size += table->size();
+  }
+  mGcThreshold = std::max(mGcLimit, live_num / GC_RATIO);
+  mGcThreshold = std::max(mGcThreshold, size / GC_SIZE_RATIO);
+}
+
+// @brief garbage_collection() でノードを削除する直前に呼び出される関数
+void
+DdNodeMgr::before_gc()
+{
 }
 
 // @brief garbage_collection() が呼ばれた後に呼び出される関数
@@ -150,6 +309,12 @@ DdNodeMgr::after_gc()
 {
 }
 
+// @brief セーフポイントの最後に呼び出される関数
+void
+DdNodeMgr::at_safe_point()
+{
+}
+
 
 //////////////////////////////////////////////////////////////////////
 // クラス DdEdge
@@ -12,6 +12,8 @@
 #include "DdNode.h"
 #include "DdEdge.h"
 #include "DdNodeTable.h"
+#include "DdNodePool.h"
+#include "DdWorkerPool.h"
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -25,8 +27,28 @@ BEGIN_NAMESPACE_YM_DD
 /// ただし実際の共有処理は DdNodeTable が行う．
 /// また，各ノードは参照回数を持っており，参照回数が 0 のノードは
 /// 必要に応じて再利用される(GC: ガーベージコレクション)．
-/// GC は明示的に行うこともできるが deactivate() をトリガーとして
-/// 自動的に行われることもある．
+///
+/// deactivate() で参照回数が 0 になったノードはすぐには子供の参照回数を
+/// 減らさずに「保留」の印を付けてリストに積んでおく．
+/// 保留中のノードが再び activate() された場合には印を消すだけでよい．
+/// 子供の参照回数は次のセーフポイントでまとめて減らす．
+/// 参照回数が 0 になったノードもすぐには削除せずにテーブルに残しておくので
+/// 同じノードが再び作られた場合には再利用される．
+///
+/// 演算の途中では新しく作られたノードは activate() されていないので
+/// GC を行うことはできない．
+/// そこで GC は演算の外側の安全な場所(セーフポイント)でのみ行う．
+/// - 最も外側の演算の開始時(begin_op())
+/// - 明示的に garbage_collection() が呼ばれた時
+/// セーフポイントではガーベージノード数がしきい値を超えているか，
+/// 前回の GC 以降にノードテーブルの拡張が必要になった場合に GC を行う．
+/// しきい値は生きているノード数に応じて GC のたびに更新される．
+/// GC では参照回数が 0 のノードを含んでいる可能性のあるテーブルのみを
+/// 走査する．
+///
+/// set_thread_num() で2以上を指定すると par_do() を用いた演算が
+/// 複数のスレッドで並列に実行される．
+/// 並列実行中のノードの生成は DdNodeTable ごとに排他制御を行う．
 //////////////////////////////////////////////////////////////////////
 class DdNodeMgr
 {
@@ -84,12 +106,52 @@ public:
     DdEdge edge1    ///< [in] 1枝
   );
 
-  /// @brief ノードを登録する．
+  /// @brief 保持しているノードに対して処理を行う．
+  ///
+  /// func が true を返したノードは表から取り除かれる．
   void
-  reg_node(
-    DdNode* node
+  scan(
+    SizeType level,
+    std::function<bool(DdNode*)> func
+  )
+  {
+    _check_level(level);
+    mTableArray[level]->scan(func);
+  }
+
+  /// @brief 条件を満たすノードをレベルの表から取り出す．
+  /// @return 取り出したノードのリストを返す．
+  ///
+  /// 取り出したノードは move_in() で再び登録しなければならない．
+  std::vector<DdNode*>
+  move_out(
+    SizeType level,                         ///< [in] レベル
+    std::function<bool(const DdNode*)> pred ///< [in] 条件
+  )
+  {
+    _check_level(level);
+    return mTableArray[level]->move_out(pred);
+  }
+
+  /// @brief move_out() で取り出したノードを登録する．
+  ///
+  /// ノードのレベルの表に登録される．
+  void
+  move_in(
+    DdNode* node ///< [in] 対象のノード
   );
 
+  /// @brief レベルの表を num 個のノードを格納できるように拡張する．
+  void
+  reserve(
+    SizeType level, ///< [in] レベル
+    SizeType num    ///< [in] ノード数
+  )
+  {
+    _check_level(level);
+    mTableArray[level]->reserve(num);
+  }
+
   /// @brief ノード(枝)の参照回数を増やす．
   void
   activate(
@@ -97,11 +159,32 @@ public:
   );
 
   /// @brief ノード(枝)の参照回数を減らす．
+  ///
+  /// ここでは GC は行わない．
   void
   deactivate(
     DdEdge edge ///< [in] 対象の枝
   );
 
+  /// @brief 演算の開始を宣言する．
+  ///
+  /// 最も外側の演算の開始時はセーフポイントとなる．
+  void
+  begin_op()
+  {
+    if ( mOpDepth == 0 ) {
+      safe_point();
+    }
+    ++ mOpDepth;
+  }
+
+  /// @brief 演算の終了を宣言する．
+  void
+  end_op()
+  {
+    -- mOpDepth;
+  }
+
   /// @brief 隣り合うレベルの変数を交換する．
   ///
   /// 具体的には level と (level + 1) を交換する．
@@ -122,32 +205,22 @@ public:
     std::swap(mLevelArray[varid1], mLevelArray[varid2]);
   }
 
-  /// @brief 保持しているノードに対して処理を行う．
-  void
-  scan(
-    SizeType level,
-    std::function<bool(DdNode*)> func
-  )
-  {
-    _check_level(level);
-    mTableArray[level]->scan(func);
-  }
-
   /// @brief ガーベージコレクションを行う．
+  ///
+  /// しきい値に関係なく参照されていないノードを全て削除する．
+  /// ただし GC が禁止されている時は何もしない．
+  /// 演算の途中で呼んではいけない．
   void
   garbage_collection();
 
-  /// @brief ガーベージコレクションを行う．
-  void
-  garbage_collection(
-    SizeType level ///< [in] レベル
-  )
-  {
-    _check_level(level);
-    auto n = mTableArray[level]->garbage_collection();
-    mNodeNum -= n;
-    mGarbageNum -= n;
-  }
+  /// @brief 参照されていないノードを削除する．
+  /// @return 削除を行った時 true を返す．
+  ///
+  /// garbage_collection() と異なり GC のしきい値の更新と
+  /// after_gc() の呼び出しは行わない．
+  /// 変数順の変更中のように頻繁に呼び出す場合に用いる．
+  bool
+  sweep_garbage();
 
   /// @brief ノード数を返す．
   SizeType
@@ -173,20 +246,94 @@ public:
     return mGarbageNum;
   }
 
-  /// @brief GC を起動するしきい値を返す．
+  /// @brief ノードのアロケータを返す．
+  ///
+  /// ページ数や断片化率などの統計情報を得るために用いる．
+  const DdNodePool&
+  node_pool() const
+  {
+    return mNodePool;
+  }
+
+  /// @brief GC を起動するしきい値の下限を返す．
   SizeType
   gc_limit()
   {
     return mGcLimit;
   }
 
-  /// @brief GC を起動するしきい値を設定する．
+  /// @brief GC を起動するしきい値の下限を設定する．
   void
   set_gc_limit(
     SizeType limit
   )
   {
     mGcLimit = limit;
+    update_gc_threshold();
+  }
+
+  /// @brief 現在の GC を起動するしきい値を返す．
+  ///
+  /// gc_limit() と生きているノード数から決まる．
+  SizeType
+  gc_threshold() const
+  {
+    return mGcThreshold;
+  }
+
+  /// @brief 演算に用いるスレッド数を返す．
+  SizeType
+  thread_num() const
+  {
+    if ( mWorkerPool == nullptr ) {
+      return 1;
+    }
+    return mWorkerPool->thread_num();
+  }
+
+  /// @brief 演算に用いるスレッド数を設定する．
+  ///
+  /// - 0 の場合にはハードウェアのスレッド数を用いる．
+  /// - 1 の場合には並列実行を行わない．
+  void
+  set_thread_num(
+    SizeType num ///< [in] スレッド数
+  );
+
+  /// @brief par_do() で並列実行が行える時 true を返す．
+  bool
+  can_par() const
+  {
+    return mWorkerPool != nullptr && mWorkerPool->can_spawn();
+  }
+
+  /// @brief 2つの処理を(可能ならば)並列に実行する．
+  ///
+  /// 並列実行が行えない場合には func0, func1 の順に実行する．
+  /// いずれの場合も両方の処理が終わるまで戻らない．
+  template <class Func0, class Func1>
+  void
+  par_do(
+    Func0&& func0, ///< [in] 処理1
+    Func1&& func1  ///< [in] 処理2
+  )
+  {
+    if ( !can_par() ) {
+      func0();
+      func1();
+      return;
+    }
+    std::function<void()> f0{func0};
+    std::function<void()> f1{func1};
+    if ( mWorkerPool->is_active() ) {
+      mWorkerPool->fork_join(f0, f1);
+    }
+    else {
+      // 並列実行区間の開始
+      begin_concurrent();
+      mWorkerPool->fork_join(f0, f1);
+      end_concurrent();
+    }
   }
 
   /// @brief GC を許可する．
@@ -221,11 +368,85 @@ private:
     DdEdge edge ///< [in] 対象の枝
   );
 
+  /// @brief セーフポイントでの処理を行う．
+  ///
+  /// 必要ならば GC を行う．
+  void
+  safe_point()
+  {
+    // ガーベージノード数を正しく数えるために保留中のノードを処理する．
+    release_pending();
+    if ( mGcEnable && (mGarbageNum >= mGcThreshold || mGcRequest) ) {
+      garbage_collection();
+    }
+    at_safe_point();
+  }
+
+  /// @brief 保留中のノードの子供の参照回数を減らす．
+  void
+  release_pending();
+
+  /// @brief ノードを含むテーブルに印を付ける．
+  void
+  mark_dirty(
+    const DdNode* node ///< [in] 参照回数が 0 になったノード
+  )
+  {
+    auto table = mTableArray[node->level()];
+    if ( !table->is_dirty() ) {
+      table->set_dirty(true);
+      mDirtyList.push_back(table);
+    }
+  }
+
+  /// @brief GC を起動するしきい値を更新する．
+  ///
+  /// GC のコストは走査する表の大きさに比例するので
+  /// 生きているノード数と表の大きさの両方を考慮する．
+  void
+  update_gc_threshold();
+
+  /// @brief 子供のノードを mRefStack に積む．
+  void
+  push_children(
+    const DdNode* node ///< [in] 対象のノード
+  )
+  {
+    auto node0 = node->edge0().node();
+    if ( node0 != nullptr ) {
+      mRefStack.push_back(node0);
+    }
+    auto node1 = node->edge1().node();
+    if ( node1 != nullptr ) {
+      mRefStack.push_back(node1);
+    }
+  }
+
+  /// @brief garbage_collection() でノードを削除する直前に呼び出される関数
+  virtual
+  void
+  before_gc();
+
   /// @brief garbage_collection() が呼ばれた後に呼び出される関数
   virtual
   void
   after_gc();
 
+  /// @brief セーフポイントの最後に呼び出される関数
+  ///
+  /// デフォルトでは何もしない．
+  virtual
+  void
+  at_safe_point();
+
+  /// @brief 並列実行区間を開始する．
+  void
+  begin_concurrent();
+
+  /// @brief 並列実行区間を終了する．
+  void
+  end_concurrent();
+
   /// @brief レベルが適正か調べる．
   void
   _check_level(
@@ -244,6 +465,9 @@ private:
   // データメンバ
   //////////////////////////////////////////////////////////////////////
 
+  // ノードのアロケータ
+  DdNodePool mNodePool;
+
   // 変数番号をキーにしてレベルを格納する配列
   std::vector<SizeType> mLevelArray;
 
@@ -256,11 +480,50 @@ private:
   // ガーベージノード数
   SizeType mGarbageNum{0};
 
-  // GC を起こすしきい値
+  // GC を起こすしきい値の下限
   SizeType mGcLimit{1024};
 
+  // GC を起こすしきい値
+  SizeType mGcThreshold{1024};
+
   // GC の許可フラグ
-  bool mGcEnable;
+  bool mGcEnable{true};
+
+  // 次のセーフポイントで GC を行う時 true となるフラグ
+  bool mGcRequest{false};
+
+  // 演算の入れ子の深さ
+  SizeType mOpDepth{0};
+
+  // 保留中のノードのリスト
+  std::vector<const DdNode*> mPendingList;
+
+  // 参照回数が 0 のノードを含んでいる可能性のあるテーブルのリスト
+  std::vector<DdNodeTable*> mDirtyList;
+
+  // 全てのテーブルを GC の対象とする時 true となるフラグ
+  bool mAllDirty{false};
+
+  // inc_ref()/release_pending() で用いる作業用のスタック
+  std::vector<const DdNode*> mRefStack;
+
+  // 生きているノード数に対するしきい値の比の逆数
+  static
+  const SizeType GC_RATIO = 2;
+
+  // 表の大きさに対するしきい値の比の逆数
+  static
+  const SizeType GC_SIZE_RATIO = 4;
+
+  // 並列実行用のワーカースレッドのプール
+  // 並列実行を行わない時は nullptr
+  std::unique_ptr<DdWorkerPool> mWorkerPool;
+
+  // 並列実行区間の中の時 true となるフラグ
+  bool mConcurrent{false};
+
+  // 並列実行区間の中で作られたノード数
+  std::atomic<SizeType> mMtNodeNum{0};
 
 };
 
@@ -0,0 +1,33 @@
+
+/// @file DdNodePool.cc
+/// @brief DdNodePool の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "DdNodePool.h"
+
+
+BEGIN_NAMESPACE_YM_DD
+
+// @brief デストラクタ
+DdNodePool::~DdNodePool()
+{
+  // DdNode は自明なデストラクタしか持たないので
+  // ページをそのまま解放してよい．
+  for ( auto page: mPageList ) {
+    ::operator delete(page);
+  }
+}
+
+// @brief 新しいページを確保する．
+void
+DdNodePool::new_page()
+{
+  auto page = static_cast<DdNode*>(::operator new(sizeof(DdNode) * PAGE_SIZE));
+  mPageList.push_back(page);
+  mNextPos = 0;
+}
+
+END_NAMESPACE_YM_DD
@@ -0,0 +1,193 @@
+#ifndef DDNODEPOOL_H
+#define DDNODEPOOL_H
+
+/// @file DdNodePool.h
+/// @brief DdNodePool のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "DdNode.h"
+#include <new>
+#include <mutex>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+//////////////////////////////////////////////////////////////////////
+/// @class DdNodePool DdNodePool.h "DdNodePool.h"
+/// @brief DdNode 用のメモリアロケータ
+///
+/// 一定個数のノードをまとめたページ単位でメモリを確保し，
+/// そこから一つずつノードを切り出す．
+/// 解放されたノードは DdNode::mLink を用いたフリーリストにつながれて
+/// 再利用される．
+/// ページは DdNodePool が破棄される時にまとめて解放される．
+//////////////////////////////////////////////////////////////////////
+class DdNodePool
+{
+public:
+
+  /// @brief 1ページあたりのノード数
+  static
+  const SizeType PAGE_SIZE = 4096;
+
+public:
+
+  /// @brief コンストラクタ
+  DdNodePool() = default;
+
+  /// @brief デストラクタ
+  ~DdNodePool();
+
+  /// @brief コピーは禁止
+  DdNodePool(
+    const DdNodePool& src
+  ) = delete;
+
+  /// @brief コピー代入は禁止
+  DdNodePool&
+  operator=(
+    const DdNodePool& src
+  ) = delete;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ノードを確保する．
+  DdNode*
+  alloc(
+    SizeType level, ///< [in] レベル
+    DdEdge edge0,   ///< [in] 0枝
+    DdEdge edge1    ///< [in] 1枝
+  )
+  {
+    DdNode* p;
+    if ( mFreeTop != nullptr ) {
+      p = mFreeTop;
+      mFreeTop = p->mLink;
+      -- mFreeNum;
+    }
+    else {
+      if ( mNextPos == PAGE_SIZE ) {
+	new_page();
+      }
+      p = mPageList.back() + mNextPos;
+      ++ mNextPos;
+    }
+    ++ mUsedNum;
+    return new (p) DdNode{level, edge0, edge1};
+  }
+
+  /// @brief 排他制御を行ってノードを確保する．
+  ///
+  /// 並列実行中に複数のスレッドから呼ばれる．
+  DdNode*
+  alloc_mt(
+    SizeType level, ///< [in] レベル
+    DdEdge edge0,   ///< [in] 0枝
+    DdEdge edge1    ///< [in] 1枝
+  )
+  {
+    std::unique_lock<std::mutex> lock{mMutex};
+    return alloc(level, edge0, edge1);
+  }
+
+  /// @brief ノードを解放する．
+  void
+  free(
+    DdNode* node ///< [in] 対象のノード
+  )
+  {
+    node->mLink = mFreeTop;
+    mFreeTop = node;
+    ++ mFreeNum;
+    -- mUsedNum;
+  }
+
+  /// @brief 確保しているページ数を返す．
+  SizeType
+  page_num() const
+  {
+    return mPageList.size();
+  }
+
+  /// @brief 使用中のノード数を返す．
+  SizeType
+  used_num() const
+  {
+    return mUsedNum;
+  }
+
+  /// @brief フリーリストにつながっているノード数を返す．
+  SizeType
+  free_num() const
+  {
+    return mFreeNum;
+  }
+
+  /// @brief 確保しているメモリ量(バイト)を返す．
+  SizeType
+  allocated_size() const
+  {
+    return page_num() * PAGE_SIZE * sizeof(DdNode);
+  }
+
+  /// @brief 断片化率を返す．
+  ///
+  /// 確保済みの領域(未使用の末尾部分を除く)のうち
+  /// フリーリストにつながっている割合を返す．
+  double
+  fragmentation() const
+  {
+    auto n = mUsedNum + mFreeNum;
+    if ( n == 0 ) {
+      return 0.0;
+    }
+    return static_cast<double>(mFreeNum) / static_cast<double>(n);
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 新しいページを確保する．
+  void
+  new_page();
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // ページのリスト
+  std::vector<DdNode*> mPageList;
+
+  // 最後のページの次に使う位置
+  SizeType mNextPos{PAGE_SIZE};
+
+  // フリーリストの先頭
+  DdNode* mFreeTop{nullptr};
+
+  // フリーリストの要素数
+  SizeType mFreeNum{0};
+
+  // 使用中のノード数
+  SizeType mUsedNum{0};
+
+  // alloc_mt() 用のミューテックス
+  std::mutex mMutex;
+
+};
+
+END_NAMESPACE_YM_DD
+
+#endif // DDNODEPOOL_H
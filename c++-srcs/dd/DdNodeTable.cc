@@ -59,8 +59,10 @@ END_NONAMESPACE
 
 // @brief コンストラクタ
 DdNodeTable::DdNodeTable(
-  SizeType varid
-) : mVarId{varid}
+  SizeType varid,
+  DdNodePool& pool
+) : mVarId{varid},
+    mPool{pool}
 {
   extend(1024);
 }
@@ -68,13 +70,7 @@ DdNodeTable::DdNodeTable(
 // @brief デストラクタ
 DdNodeTable::~DdNodeTable()
 {
-  DdNode* next = nullptr;
-  for ( SizeType i = 0; i < mSize; ++ i ) {
-    for ( auto node = mTable[i]; node != nullptr; node = next ) {
-      next = node->mLink;
-      delete node;
-    }
-  }
+  // ノードのメモリは DdNodePool がまとめて解放する．
   delete [] mTable;
 }
 
@@ -88,24 +84,34 @@ DdNodeTable::new_node(
 )
 {
   // ノードテーブルを探す．
-  // ハッシュ値を求める．
-  auto pos0 = hash_func(edge0, edge1);
-  auto pos = pos0 % mHashSize;
-  for ( node = mTable[pos]; node != nullptr; node = node->mLink ) {
-    if ( node->edge0() == edge0 &&
-	 node->edge1() == edge1 ) {
-      // 見つけた．
-      return false;
-    }
+  node = find(edge0, edge1);
+  if ( node != nullptr ) {
+    // 見つけた．
+    return false;
   }
   // なかったので新規に作る．
-  node = new DdNode{level, edge0, edge1};
-  if ( mNodeNum >= mNextLimit ) {
-    // テーブルを拡張する．
-    extend(mSize * 2);
+  node = mPool.alloc(level, edge0, edge1);
+  add_node(node);
+  return true;
+}
+
+// @brief 排他制御を行ってノードを作る．
+bool
+DdNodeTable::new_node_mt(
+  SizeType level,
+  DdEdge edge0,
+  DdEdge edge1,
+  DdNode*& node
+)
+{
+  std::unique_lock<std::mutex> lock{mMutex};
+  node = find(edge0, edge1);
+  if ( node != nullptr ) {
+    return false;
   }
-  reg_node(node);
-  ++ mNodeNum;
+  // DdNodePool は全レベルで共有なので別に排他制御を行う．
+  node = mPool.alloc_mt(level, edge0, edge1);
+  add_node(node);
   return true;
 }
 
@@ -158,6 +164,39 @@ DdNodeTable::scan(
   }
 }
 
+// @brief 条件を満たすノードを表から取り出す．
+std::vector<DdNode*>
+DdNodeTable::move_out(
+  std::function<bool(const DdNode*)> pred
+)
+{
+  std::vector<DdNode*> node_list;
+  scan([&](DdNode* node){
+    if ( pred(node) ) {
+      node_list.push_back(node);
+      return true;
+    }
+    return false;
+  });
+  mNodeNum -= node_list.size();
+  return node_list;
+}
+
+// @brief num 個のノードを格納できるように表を拡張する．
+void
+DdNodeTable::reserve(
+  SizeType num
+)
+{
+  auto size = mSize;
+  while ( static_cast<SizeType>(size * 1.8) <= num ) {
+    size *= 2;
+  }
+  if ( size > mSize ) {
+    extend(size);
+  }
+}
+
 // @brief ガーベージコレクションを行う．
 SizeType
 DdNodeTable::garbage_collection()
@@ -165,7 +204,7 @@ DdNodeTable::garbage_collection()
   SizeType dcount = 0;
   scan([&](DdNode* node){
     if ( node->mRefCount == 0 ) {
-      delete node;
+      mPool.free(node);
       ++ dcount;
       return true;
     }
@@ -175,6 +214,39 @@ DdNodeTable::garbage_collection()
   return dcount;
 }
 
+// @brief 枝の組に対応するノードを探す．
+DdNode*
+DdNodeTable::find(
+  DdEdge edge0,
+  DdEdge edge1
+) const
+{
+  // ハッシュ値を求める．
+  auto pos0 = hash_func(edge0, edge1);
+  auto pos = pos0 % mHashSize;
+  for ( auto node = mTable[pos]; node != nullptr; node = node->mLink ) {
+    if ( node->edge0() == edge0 &&
+	 node->edge1() == edge1 ) {
+      return node;
+    }
+  }
+  return nullptr;
+}
+
+// @brief 新しく作ったノードを追加する．
+void
+DdNodeTable::add_node(
+  DdNode* node
+)
+{
+  if ( mNodeNum >= mNextLimit ) {
+    // テーブルを拡張する．
+    extend(mSize * 2);
+  }
+  reg_node(node);
+  ++ mNodeNum;
+}
+
 // @brief 表を拡張する．
 void
 DdNodeTable::extend(
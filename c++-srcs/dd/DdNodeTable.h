@@ -11,6 +11,8 @@
 #include "ym/logic.h"
 #include "DdNode.h"
 #include "DdEdge.h"
+#include "DdNodePool.h"
+#include <mutex>
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -21,6 +23,7 @@ BEGIN_NAMESPACE_YM_DD
 ///
 /// 同じ edge0, edge1 を持つノードを共有する処理を行う．
 /// このクラスでは同一のレベルのノードのみを対象にする．
+/// ノードのメモリは DdNodeMgr の持つ DdNodePool から確保する．
 //////////////////////////////////////////////////////////////////////
 class DdNodeTable
 {
@@ -28,7 +31,8 @@ public:
 
   /// @brief コンストラクタ
   DdNodeTable(
-    SizeType varid ///< [in] 変数番号
+    SizeType varid,   ///< [in] 変数番号
+    DdNodePool& pool  ///< [in] ノードのアロケータ
   );
 
   /// @brief デストラクタ
@@ -57,6 +61,18 @@ public:
     DdNode*& node   ///< [out] 結果を格納する変数
   );
 
+  /// @brief 排他制御を行ってノードを作る．
+  /// @return 新規にノードを作った時の true を返す．
+  ///
+  /// 並列実行中に複数のスレッドから呼ばれる．
+  bool
+  new_node_mt(
+    SizeType level, ///< [in] レベル
+    DdEdge edge0,   ///< [in] 0枝
+    DdEdge edge1,   ///< [in] 1枝
+    DdNode*& node   ///< [out] 結果を格納する変数
+  );
+
   /// @brief ノードを登録する．
   void
   reg_node(
@@ -70,6 +86,36 @@ public:
     return mNodeNum;
   }
 
+  /// @brief 表のサイズを返す．
+  SizeType
+  size() const
+  {
+    return mSize;
+  }
+
+  /// @brief 次にノードを追加すると表を拡張する時 true を返す．
+  bool
+  is_full() const
+  {
+    return mNodeNum >= mNextLimit;
+  }
+
+  /// @brief 参照回数が 0 のノードを含んでいる可能性がある時 true を返す．
+  bool
+  is_dirty() const
+  {
+    return mDirty;
+  }
+
+  /// @brief is_dirty() のフラグを設定する．
+  void
+  set_dirty(
+    bool dirty ///< [in] 設定する値
+  )
+  {
+    mDirty = dirty;
+  }
+
   /// @brief 保持しているノードのレベルを変更する．
   void
   chg_level(
@@ -77,11 +123,42 @@ public:
   );
 
   /// @brief 保持しているノードに対して処理を行う．
+  ///
+  /// func が true を返したノードは表から取り除かれる．
   void
   scan(
     std::function<bool(DdNode*)> func
   );
 
+  /// @brief 条件を満たすノードを表から取り出す．
+  /// @return 取り出したノードのリストを返す．
+  ///
+  /// ノードは解放されない．
+  std::vector<DdNode*>
+  move_out(
+    std::function<bool(const DdNode*)> pred ///< [in] 条件
+  );
+
+  /// @brief 他の表から取り出したノードを追加する．
+  ///
+  /// 必要ならば表を拡張する．
+  void
+  move_in(
+    DdNode* node ///< [in] 対象のノード
+  )
+  {
+    add_node(node);
+  }
+
+  /// @brief num 個のノードを格納できるように表を拡張する．
+  ///
+  /// ノード数があらかじめわかっている場合に
+  /// 途中で表の拡張が起こらないようにするために用いる．
+  void
+  reserve(
+    SizeType num ///< [in] ノード数
+  );
+
   /// @brief ガーベージコレクションを行う．
   /// @return 削除したノード数を返す．
   SizeType
@@ -93,6 +170,20 @@ private:
   // 内部で用いられる関数
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief 枝の組に対応するノードを探す．
+  /// @return 見つからなければ nullptr を返す．
+  DdNode*
+  find(
+    DdEdge edge0, ///< [in] 0枝
+    DdEdge edge1  ///< [in] 1枝
+  ) const;
+
+  /// @brief 新しく作ったノードを追加する．
+  void
+  add_node(
+    DdNode* node ///< [in] 対象のノード
+  );
+
   /// @brief 表を拡張する．
   void
   extend(
@@ -108,6 +199,9 @@ private:
   // 変数番号
   SizeType mVarId;
 
+  // ノードのアロケータ
+  DdNodePool& mPool;
+
   // 表のサイズ
   SizeType mSize{0};
 
@@ -118,12 +212,19 @@ private:
   // 表の本体
   DdNode** mTable{nullptr};
 
+  // new_node_mt() 用のミューテックス
+  std::mutex mMutex;
+
   // 格納されているノード数
   SizeType mNodeNum{0};
 
   // テーブルを拡張する目安
   SizeType mNextLimit;
 
+  // 参照回数が 0 のノードを含んでいる可能性がある時 true となるフラグ
+  // DdNodeMgr が設定する．
+  bool mDirty{false};
+
 };
 
 END_NAMESPACE_YM_DD
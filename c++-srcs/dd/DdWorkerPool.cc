@@ -0,0 +1,225 @@
+
+/// @file DdWorkerPool.cc
+/// @brief DdWorkerPool の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "DdWorkerPool.h"
+
+
+BEGIN_NAMESPACE_YM_DD
+
+thread_local
+DdWorkerPool* DdWorkerPool::sCurPool = nullptr;
+
+thread_local
+SizeType DdWorkerPool::sWorkerId = 0;
+
+thread_local
+SizeType DdWorkerPool::sDepth = 0;
+
+// @brief コンストラクタ
+DdWorkerPool::DdWorkerPool(
+  SizeType thread_num,
+  SizeType spawn_depth
+) : mSpawnDepth{spawn_depth}
+{
+  ASSERT_COND( thread_num >= 2 );
+
+  if ( mSpawnDepth == 0 ) {
+    // スレッド数の 16 倍程度のタスクができるようにする．
+    mSpawnDepth = 4;
+    for ( SizeType n = 1; n < thread_num; n <<= 1 ) {
+      ++ mSpawnDepth;
+    }
+  }
+
+  mWorkerList.reserve(thread_num);
+  for ( SizeType i = 0; i < thread_num; ++ i ) {
+    mWorkerList.push_back(std::unique_ptr<Worker>{new Worker});
+  }
+  // 0番目は呼び出し側のスレッドが使う．
+  mThreadList.reserve(thread_num - 1);
+  for ( SizeType i = 1; i < thread_num; ++ i ) {
+    mThreadList.push_back(std::thread{[this, i](){ worker_main(i); }});
+  }
+}
+
+// @brief デストラクタ
+DdWorkerPool::~DdWorkerPool()
+{
+  {
+    std::unique_lock<std::mutex> lock{mMutex};
+    mStop = true;
+    mActive = false;
+  }
+  mCond.notify_all();
+  for ( auto& th: mThreadList ) {
+    th.join();
+  }
+}
+
+// @brief 並列実行区間を開始する．
+void
+DdWorkerPool::begin()
+{
+  ASSERT_COND( sCurPool == nullptr );
+
+  sCurPool = this;
+  sWorkerId = 0;
+  sDepth = 0;
+  {
+    std::unique_lock<std::mutex> lock{mMutex};
+    mActive = true;
+  }
+  mCond.notify_all();
+}
+
+// @brief 並列実行区間を終了する．
+void
+DdWorkerPool::end()
+{
+  ASSERT_COND( sCurPool == this && sWorkerId == 0 );
+
+  {
+    std::unique_lock<std::mutex> lock{mMutex};
+    mActive = false;
+  }
+  sCurPool = nullptr;
+}
+
+// @brief 2つの処理を並列に実行する．
+void
+DdWorkerPool::fork_join(
+  const std::function<void()>& func0,
+  const std::function<void()>& func1
+)
+{
+  ASSERT_COND( sCurPool == this );
+
+  auto& worker = *mWorkerList[sWorkerId];
+  Task task;
+  task.mFunc = &func1;
+  task.mDepth = sDepth + 1;
+  {
+    std::unique_lock<std::mutex> lock{worker.mMutex};
+    worker.mQueue.push_back(&task);
+  }
+
+  // task はこの関数のローカル変数なので，例外が送出されても
+  // キューから取り除くか終了を待つまではこの関数を抜けられない．
+  std::exception_ptr exc0;
+  ++ sDepth;
+  try {
+    func0();
+  }
+  catch ( ... ) {
+    exc0 = std::current_exception();
+  }
+  -- sDepth;
+
+  // 盗まれていなければ自分で実行する．
+  bool stolen = true;
+  {
+    std::unique_lock<std::mutex> lock{worker.mMutex};
+    if ( !worker.mQueue.empty() && worker.mQueue.back() == &task ) {
+      worker.mQueue.pop_back();
+      stolen = false;
+    }
+  }
+  if ( !stolen ) {
+    if ( exc0 ) {
+      std::rethrow_exception(exc0);
+    }
+    ++ sDepth;
+    func1();
+    -- sDepth;
+    return;
+  }
+
+  // 盗まれたタスクが終わるまで他のタスクを手伝う．
+  while ( !task.mDone.load(std::memory_order_acquire) ) {
+    if ( !steal_and_run() ) {
+      std::this_thread::yield();
+    }
+  }
+
+  if ( exc0 ) {
+    std::rethrow_exception(exc0);
+  }
+  if ( task.mException ) {
+    std::rethrow_exception(task.mException);
+  }
+}
+
+// @brief ワーカースレッドの本体
+void
+DdWorkerPool::worker_main(
+  SizeType id
+)
+{
+  sCurPool = this;
+  sWorkerId = id;
+  sDepth = 0;
+  for ( ; ; ) {
+    {
+      std::unique_lock<std::mutex> lock{mMutex};
+      mCond.wait(lock, [this](){ return mStop || mActive; });
+      if ( mStop ) {
+	return;
+      }
+    }
+    while ( mActive.load(std::memory_order_acquire) ) {
+      if ( !steal_and_run() ) {
+	std::this_thread::yield();
+      }
+    }
+  }
+}
+
+// @brief 他のワーカーからタスクを盗んで実行する．
+bool
+DdWorkerPool::steal_and_run()
+{
+  auto n = mWorkerList.size();
+  for ( SizeType i = 1; i < n; ++ i ) {
+    auto& victim = *mWorkerList[(sWorkerId + i) % n];
+    Task* task = nullptr;
+    {
+      std::unique_lock<std::mutex> lock{victim.mMutex};
+      if ( !victim.mQueue.empty() ) {
+	task = victim.mQueue.front();
+	victim.mQueue.pop_front();
+      }
+    }
+    if ( task != nullptr ) {
+      run_task(task);
+      return true;
+    }
+  }
+  return false;
+}
+
+// @brief タスクを実行する．
+void
+DdWorkerPool::run_task(
+  Task* task
+)
+{
+  auto old_depth = sDepth;
+  sDepth = task->mDepth;
+  // ワーカースレッドには例外を受け取る者がいないので
+  // タスクに記録しておいて fork_join() を呼んだスレッドで送出する．
+  try {
+    (*task->mFunc)();
+  }
+  catch ( ... ) {
+    task->mException = std::current_exception();
+  }
+  sDepth = old_depth;
+  task->mDone.store(true, std::memory_order_release);
+}
+
+END_NAMESPACE_YM_DD
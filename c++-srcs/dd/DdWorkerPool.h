@@ -0,0 +1,231 @@
+#ifndef DDWORKERPOOL_H
+#define DDWORKERPOOL_H
+
+/// @file DdWorkerPool.h
+/// @brief DdWorkerPool のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+//////////////////////////////////////////////////////////////////////
+/// @class DdWorkerPool DdWorkerPool.h "DdWorkerPool.h"
+/// @brief apply 演算を並列に実行するためのワーカースレッドのプール
+///
+/// fork_join() で2つの処理を並列に実行する．
+/// 一方はタスクとして自分のキューに積み，もう一方をその場で実行する．
+/// 手の空いたスレッドは他のスレッドのキューの先頭(=浅いレベル)から
+/// タスクを盗んで実行する(work stealing)．
+/// タスクを盗まれたスレッドは終了を待つ間，他のタスクを盗んで実行する．
+///
+/// タスクを生成するのは再帰の深さが spawn_depth 未満の場合のみで，
+/// それより深いところでは逐次的に処理する．
+///
+/// 並列実行区間(begin() から end() まで)以外ではワーカースレッドは
+/// 条件変数で待機している．
+//////////////////////////////////////////////////////////////////////
+class DdWorkerPool
+{
+public:
+
+  /// @brief コンストラクタ
+  ///
+  /// 呼び出し側のスレッドも処理に加わるので
+  /// 実際に作られるスレッド数は thread_num - 1 となる．
+  DdWorkerPool(
+    SizeType thread_num,     ///< [in] スレッド数(2以上)
+    SizeType spawn_depth = 0 ///< [in] タスクを生成する再帰の深さの上限
+                             ///<      0 の場合には thread_num から決める．
+  );
+
+  /// @brief デストラクタ
+  ~DdWorkerPool();
+
+  /// @brief コピーは禁止
+  DdWorkerPool(
+    const DdWorkerPool& src
+  ) = delete;
+
+  /// @brief コピー代入は禁止
+  DdWorkerPool&
+  operator=(
+    const DdWorkerPool& src
+  ) = delete;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief スレッド数を返す．
+  SizeType
+  thread_num() const
+  {
+    return mWorkerList.size();
+  }
+
+  /// @brief タスクを生成する再帰の深さの上限を返す．
+  SizeType
+  spawn_depth() const
+  {
+    return mSpawnDepth;
+  }
+
+  /// @brief 並列実行区間の中にいる時 true を返す．
+  bool
+  is_active() const
+  {
+    return sCurPool == this;
+  }
+
+  /// @brief タスクを生成してよい時 true を返す．
+  ///
+  /// 並列実行区間の外では常に true となる．
+  bool
+  can_spawn() const
+  {
+    if ( sCurPool != this ) {
+      return sCurPool == nullptr;
+    }
+    return sDepth < mSpawnDepth;
+  }
+
+  /// @brief 並列実行区間を開始する．
+  ///
+  /// 呼び出したスレッドは 0 番目のワーカーとなる．
+  void
+  begin();
+
+  /// @brief 並列実行区間を終了する．
+  void
+  end();
+
+  /// @brief 2つの処理を並列に実行する．
+  ///
+  /// 両方の処理が終わるまで戻らない．
+  /// 並列実行区間の中で呼ばなければならない．
+  /// どちらかの処理で例外が送出された場合には，両方の処理が
+  /// 終わるのを待ってからこのスレッドで送出し直す．
+  void
+  fork_join(
+    const std::function<void()>& func0, ///< [in] その場で実行する処理
+    const std::function<void()>& func1  ///< [in] タスクとして積む処理
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief タスク
+  struct Task
+  {
+    // 処理本体
+    const std::function<void()>* mFunc;
+
+    // 再帰の深さ
+    SizeType mDepth;
+
+    // 実行中に送出された例外
+    std::exception_ptr mException;
+
+    // 終了フラグ
+    std::atomic<bool> mDone{false};
+  };
+
+  /// @brief ワーカーごとのタスクキュー
+  ///
+  /// 所有者は末尾から，他のスレッドは先頭から取り出す．
+  struct Worker
+  {
+    // 排他制御用のミューテックス
+    std::mutex mMutex;
+
+    // タスクキュー
+    std::deque<Task*> mQueue;
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ワーカースレッドの本体
+  void
+  worker_main(
+    SizeType id ///< [in] ワーカー番号
+  );
+
+  /// @brief 他のワーカーからタスクを盗んで実行する．
+  /// @return 実行した時 true を返す．
+  bool
+  steal_and_run();
+
+  /// @brief タスクを実行する．
+  void
+  run_task(
+    Task* task ///< [in] 対象のタスク
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // ワーカーのリスト
+  std::vector<std::unique_ptr<Worker>> mWorkerList;
+
+  // スレッドのリスト
+  std::vector<std::thread> mThreadList;
+
+  // タスクを生成する再帰の深さの上限
+  SizeType mSpawnDepth;
+
+  // 待機用のミューテックス
+  std::mutex mMutex;
+
+  // 待機用の条件変数
+  std::condition_variable mCond;
+
+  // 並列実行区間の中の時 true となるフラグ
+  std::atomic<bool> mActive{false};
+
+  // スレッドを終了させる時 true となるフラグ
+  bool mStop{false};
+
+  // 現在のスレッドが属しているプール
+  static
+  thread_local
+  DdWorkerPool* sCurPool;
+
+  // 現在のスレッドのワーカー番号
+  static
+  thread_local
+  SizeType sWorkerId;
+
+  // 現在のスレッドが実行している処理の再帰の深さ
+  static
+  thread_local
+  SizeType sDepth;
+
+};
+
+END_NAMESPACE_YM_DD
+
+#endif // DDWORKERPOOL_H
@@ -28,6 +28,9 @@ NodeCollector::NodeCollector(
 }
 
 // @brief ノードを集める．
+//
+// 子供のノードが親のノードより先に番号付けされるように帰りがけ順で
+// 処理する．深いグラフでスタックがあふれないように明示的なスタックを用いる．
 void
 NodeCollector::get_node(
   DdEdge edge
@@ -36,15 +39,36 @@ NodeCollector::get_node(
   if ( edge.is_const() ) {
     return;
   }
-
-  auto node = edge.node();
-  if ( mNodeMap.count(node) == 0 ) {
-    get_node(node->edge0());
-    get_node(node->edge1());
-    // 定数用に '0' は予約されている．
-    SizeType id = mNodeList.size() + 1;
-    mNodeMap.emplace(node, id);
-    mNodeList.push_back(node);
+  // 2番目の要素は子供を処理済みの時 true となる．
+  std::vector<std::pair<const DdNode*, bool>> stack;
+  stack.push_back({edge.node(), false});
+  while ( !stack.empty() ) {
+    auto& top = stack.back();
+    auto node = top.first;
+    if ( top.second ) {
+      stack.pop_back();
+      if ( mNodeMap.count(node) == 0 ) {
+	// 定数用に '0' は予約されている．
+	SizeType id = mNodeList.size() + 1;
+	mNodeMap.emplace(node, id);
+	mNodeList.push_back(node);
+      }
+      continue;
+    }
+    if ( mNodeMap.count(node) > 0 ) {
+      stack.pop_back();
+      continue;
+    }
+    top.second = true;
+    // 0枝側を先に処理するために1枝側を先に積む．
+    auto edge1 = node->edge1();
+    if ( !edge1.is_const() ) {
+      stack.push_back({edge1.node(), false});
+    }
+    auto edge0 = node->edge0();
+    if ( !edge0.is_const() ) {
+      stack.push_back({edge0.node(), false});
+    }
   }
 }
 
@@ -67,9 +67,9 @@ ZddCapOp::cap_step(
   }
 
   // 演算結果テーブルを調べる．
-  Apply2Key key{left, right};
-  if ( mTable.count(key) > 0 ) {
-    return mTable.at(key);
+  DdEdge result;
+  if ( find_result(ZddOpCode::Cap, left, right, result) ) {
+    return result;
   }
 
   // 見つからなかったので実際に apply 演算を行う．
@@ -81,10 +81,11 @@ ZddCapOp::cap_step(
     left0, left1,
     right0, right1
   );
-  auto ans0 = cap_step(left0, right0);
-  auto ans1 = cap_step(left1, right1);
-  auto result = new_node(top, ans0, ans1);
-  mTable.emplace(key, result);
+  DdEdge ans0, ans1;
+  par_do([&](){ ans0 = cap_step(left0, right0); },
+	 [&](){ ans1 = cap_step(left1, right1); });
+  result = new_node(top, ans0, ans1);
+  put_result(ZddOpCode::Cap, left, right, result);
   return result;
 }
 
@@ -97,17 +98,17 @@ ZddCapOp::cap_step2(
     return left;
   }
 
-  Apply2Key key{left, DdEdge::one()};
-  if ( mTable.count(key) > 0 ) {
-    return mTable.at(key);
+  DdEdge result;
+  if ( find_result(ZddOpCode::Cap, left, DdEdge::one(), result) ) {
+    return result;
   }
   auto node = left.node();
   auto level = node->level();
   auto edge0 = node->edge0();
   auto edge1 = node->edge1();
   auto ans0 = cap_step2(edge0);
-  auto result = new_node(level, ans0, edge1);
-  mTable.emplace(key, result);
+  result = new_node(level, ans0, edge1);
+  put_result(ZddOpCode::Cap, left, DdEdge::one(), result);
   return result;
 }
 
@@ -10,6 +10,7 @@
 #include "DdEdge.h"
 #include "DdNode.h"
 #include "ZddCountOp.h"
+#include <cmath>
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -20,8 +21,42 @@ Zdd::count() const
 {
   _check_valid();
 
-  ZddCountOp op;
-  return op.count_step(root());
+  ZddCountOp op(root());
+  auto ans = op.count_exact();
+  if ( !ans.fits_size() ) {
+    throw std::overflow_error{"too many elements"};
+  }
+  return ans.to_size();
+}
+
+// @brief 集合の要素数を double で数える．
+double
+Zdd::count_double() const
+{
+  _check_valid();
+
+  ZddCountOp op(root());
+  return op.count_double();
+}
+
+// @brief 集合の要素数の2を底とする対数を求める．
+double
+Zdd::log2_count() const
+{
+  _check_valid();
+
+  ZddCountOp op(root());
+  return op.log2_count();
+}
+
+// @brief 集合の要素数を厳密に数える．
+std::string
+Zdd::count_str() const
+{
+  _check_valid();
+
+  ZddCountOp op(root());
+  return op.count_exact().to_string();
 }
 
 
@@ -29,30 +64,96 @@ Zdd::count() const
 // クラス ZddCountOP
 //////////////////////////////////////////////////////////////////////
 
-SizeType
-ZddCountOp::count_step(
-  DdEdge edge
-)
+// @brief double で数える．
+double
+ZddCountOp::count_double()
 {
-  if ( edge.is_zero() ) {
-    return 0;
+  auto& node_list = mCollector.node_list();
+  std::vector<double> count_array(node_list.size());
+  auto get_count = [&](DdEdge edge) -> double {
+    if ( edge.is_zero() ) {
+      return 0.0;
+    }
+    if ( edge.is_one() ) {
+      return 1.0;
+    }
+    return count_array[node_id(edge)];
+  };
+  for ( SizeType i = 0; i < node_list.size(); ++ i ) {
+    auto node = node_list[i];
+    count_array[i] = get_count(node->edge0()) + get_count(node->edge1());
   }
-  if ( edge.is_one() ) {
-    return 1;
+  return get_count(mRoot);
+}
+
+// @brief 要素数の2を底とする対数を求める．
+double
+ZddCountOp::log2_count()
+{
+  if ( mRoot.is_zero() ) {
+    return -std::numeric_limits<double>::infinity();
   }
+  if ( mRoot.is_one() ) {
+    return 0.0;
+  }
+  auto count_array = log2_count_list();
+  return count_array[node_id(mRoot)];
+}
 
-  if ( mTable.count(edge) > 0 ) {
-    return mTable.at(edge);
+// @brief 各ノードの要素数の対数を求める．
+std::vector<double>
+ZddCountOp::log2_count_list()
+{
+  auto& node_list = mCollector.node_list();
+  const double NEG_INF = -std::numeric_limits<double>::infinity();
+  std::vector<double> count_array(node_list.size());
+  auto get_count = [&](DdEdge edge) -> double {
+    if ( edge.is_zero() ) {
+      return NEG_INF;
+    }
+    if ( edge.is_one() ) {
+      return 0.0;
+    }
+    return count_array[node_id(edge)];
+  };
+  for ( SizeType i = 0; i < node_list.size(); ++ i ) {
+    auto node = node_list[i];
+    auto a = get_count(node->edge0());
+    auto b = get_count(node->edge1());
+    if ( a < b ) {
+      std::swap(a, b);
+    }
+    // 0枝が空集合でも1枝は空集合ではないので a は有限
+    if ( !std::isinf(b) ) {
+      a += std::log2(1.0 + std::exp2(b - a));
+    }
+    count_array[i] = a;
   }
+  return count_array;
+}
 
-  auto node = edge.node();
-  auto edge0 = node->edge0();
-  auto edge1 = node->edge1();
-  auto c0 = count_step(edge0);
-  auto c1 = count_step(edge1);
-  auto result = c0 + c1;
-  mTable.emplace(edge, result);
-  return result;
+// @brief 厳密に数える．
+DdBigUint
+ZddCountOp::count_exact()
+{
+  auto& node_list = mCollector.node_list();
+  std::vector<DdBigUint> count_array(node_list.size());
+  auto get_count = [&](DdEdge edge) -> DdBigUint {
+    if ( edge.is_zero() ) {
+      return DdBigUint{0};
+    }
+    if ( edge.is_one() ) {
+      return DdBigUint{1};
+    }
+    return count_array[node_id(edge)];
+  };
+  for ( SizeType i = 0; i < node_list.size(); ++ i ) {
+    auto node = node_list[i];
+    auto c = get_count(node->edge0());
+    c += get_count(node->edge1());
+    count_array[i] = std::move(c);
+  }
+  return get_count(mRoot);
 }
 
 END_NAMESPACE_YM_DD
@@ -9,6 +9,8 @@
 /// All rights reserved.
 
 #include "DdEdge.h"
+#include "DdBigUint.h"
+#include "NodeCollector.h"
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -16,13 +18,21 @@ BEGIN_NAMESPACE_YM_DD
 //////////////////////////////////////////////////////////////////////
 /// @class ZddCountOp ZddCountOp.h "ZddCountOp.h"
 /// @brief 要素数を数える
+///
+/// NodeCollector で子供が先に来る順にノードを並べて
+/// 各ノードの値(0枝と1枝の値の和)を順に求める．
 //////////////////////////////////////////////////////////////////////
 class ZddCountOp
 {
 public:
 
   /// @brief コンストラクタ
-  ZddCountOp() = default;
+  ZddCountOp(
+    DdEdge root ///< [in] 根の枝
+  ) : mRoot{root},
+      mCollector{{root}}
+  {
+  }
 
   /// @brief デストラクタ
   ~ZddCountOp() = default;
@@ -33,10 +43,56 @@ public:
   // 外部インターフェイス
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief double で数える．
+  double
+  count_double();
+
+  /// @brief 要素数の2を底とする対数を求める．
+  ///
+  /// 要素数が 0 の場合には -inf を返す．
+  double
+  log2_count();
+
+  /// @brief 厳密に数える．
+  DdBigUint
+  count_exact();
+
+  /// @brief 各ノードの要素数の対数を求める．
+  ///
+  /// 結果は node_list() と同じ順に並んでいる．
+  std::vector<double>
+  log2_count_list();
+
+  /// @brief ノードのリストを返す．
+  ///
+  /// 子供のノードは親のノードより前にある．
+  const std::vector<const DdNode*>&
+  node_list() const
+  {
+    return mCollector.node_list();
+  }
+
+  /// @brief ノード番号を返す．
+  ///
+  /// node_list() 中の位置を返す．
+  SizeType
+  node_id(
+    DdEdge edge ///< [in] 枝(定数ではないこと)
+  ) const
+  {
+    return mCollector.edge2int(edge) / 2 - 1;
+  }
+
+  /// @brief 枝を整数値に変換する．
+  ///
+  /// 定数0は 0, 定数1は 1, それ以外は (node_id() + 1) * 2 となる．
   SizeType
-  count_step(
-    DdEdge edge
-  );
+  edge2int(
+    DdEdge edge ///< [in] 枝
+  ) const
+  {
+    return mCollector.edge2int(edge);
+  }
 
 
 private:
@@ -44,11 +100,14 @@ private:
   // データメンバ
   //////////////////////////////////////////////////////////////////////
 
-  // 演算結果テーブル
-  std::unordered_map<DdEdge, SizeType> mTable;
+  // 根の枝
+  DdEdge mRoot;
+
+  // ノードを集めたもの
+  NodeCollector mCollector;
 
 };
 
 END_NAMESPACE_YM_DD
 
-#endif // COUNTOP_H
+#endif // ZDDCOUNTOP_H
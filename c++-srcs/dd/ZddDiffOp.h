@@ -10,7 +10,6 @@
 
 #include "ZddOpBase.h"
 #include "DdEdge.h"
-#include "Apply2Key.h"
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -65,15 +64,6 @@ private:
     DdEdge left
   );
 
-
-private:
-  //////////////////////////////////////////////////////////////////////
-  // データメンバ
-  //////////////////////////////////////////////////////////////////////
-
-  // 演算結果テーブル
-  std::unordered_map<Apply2Key, DdEdge> mTable;
-
 };
 
 END_NAMESPACE_YM_DD
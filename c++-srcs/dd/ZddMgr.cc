@@ -142,6 +142,22 @@ ZddMgr::disable_gc()
   get()->disable_gc();
 }
 
+// @brief 演算に用いるスレッド数を返す．
+SizeType
+ZddMgr::thread_num() const
+{
+  return get()->thread_num();
+}
+
+// @brief 演算に用いるスレッド数を設定する．
+void
+ZddMgr::set_thread_num(
+  SizeType num
+)
+{
+  get()->set_thread_num(num);
+}
+
 // @brief 枝のリストをZddのリストに変換する．
 std::vector<Zdd>
 ZddMgr::conv_to_zddlist(
@@ -83,6 +83,14 @@ ZddMgrImpl::new_node(
   return DdEdge{node};
 }
 
+// @brief garbage_collection() でノードを削除する直前に呼び出される関数
+void
+ZddMgrImpl::before_gc()
+{
+  // 削除されるノードを参照しているエントリを取り除く．
+  mCompTable.sweep();
+}
+
 // @brief garbage_collection() が呼ばれた後に呼び出される関数
 void
 ZddMgrImpl::after_gc()
@@ -17,6 +17,7 @@
 #include "DdNode.h"
 #include "DdEdge.h"
 #include "DdNodeMgr.h"
+#include "DdCompTable.h"
 
 
 BEGIN_NAMESPACE_YM_DD
@@ -61,6 +62,13 @@ public:
     return mItemList;
   }
 
+  /// @brief 演算結果テーブルを返す．
+  DdCompTable&
+  comp_table()
+  {
+    return mCompTable;
+  }
+
   /// @brief 部分集合を作る．
   DdEdge
   make_set(
@@ -155,6 +163,10 @@ private:
   // DdNodeMgr の仮想関数
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief garbage_collection() でノードを削除する直前に呼び出される関数
+  void
+  before_gc() override;
+
   /// @brief garbage_collection() が呼ばれた後に呼び出される関数
   void
   after_gc() override;
@@ -168,6 +180,9 @@ private:
   // 要素(の枝)のリスト
   std::vector<DdEdge> mItemList;
 
+  // 演算結果テーブル
+  DdCompTable mCompTable;
+
 };
 
 END_NAMESPACE_YM_DD
@@ -16,11 +16,23 @@ BEGIN_NAMESPACE_YM_DD
 
 class ZddMgrImpl;
 
+/// @brief 演算結果テーブルで用いる演算コード
+enum class ZddOpCode : SizeType {
+  Cup = 1, ///< ユニオン
+  Cap,     ///< インターセクション
+  Diff,    ///< 集合差
+  Product  ///< 直積
+};
+
+
 //////////////////////////////////////////////////////////////////////
 /// @class ZddOpBase ZddOpBase.h "ZddOpBase.h"
 /// @brief BDD用の演算クラスの基底クラス
 ///
 /// いわゆる ZddMgrImpl の delegate クラス
+///
+/// コンストラクタとデストラクタで演算の開始と終了をマネージャに知らせる．
+/// 演算の途中で GC が起こらないようにするため．
 //////////////////////////////////////////////////////////////////////
 class ZddOpBase
 {
@@ -31,10 +43,25 @@ public:
     ZddMgrImpl* mgr ///< [in] マネージャ
   ) : mMgr{mgr}
   {
+    mMgr->begin_op();
   }
 
   /// @brief デストラクタ
-  ~ZddOpBase() = default;
+  ~ZddOpBase()
+  {
+    mMgr->end_op();
+  }
+
+  /// @brief コピーコンストラクタは禁止
+  ZddOpBase(
+    const ZddOpBase& src
+  ) = delete;
+
+  /// @brief コピー代入演算子は禁止
+  ZddOpBase&
+  operator=(
+    const ZddOpBase& src
+  ) = delete;
 
 
 protected:
@@ -60,6 +87,44 @@ protected:
     return mMgr->new_node(index, edge0, edge1);
   }
 
+  /// @brief 2つの処理を(可能ならば)並列に実行する．
+  template <class Func0, class Func1>
+  void
+  par_do(
+    Func0&& func0, ///< [in] 処理1
+    Func1&& func1  ///< [in] 処理2
+  )
+  {
+    mMgr->par_do(func0, func1);
+  }
+
+  /// @brief 演算結果を演算結果テーブルから探す．
+  /// @return 見つかったら true を返す．
+  bool
+  find_result(
+    ZddOpCode op,  ///< [in] 演算コード
+    DdEdge e0,     ///< [in] オペランド1
+    DdEdge e1,     ///< [in] オペランド2
+    DdEdge& result ///< [out] 結果を格納する変数
+  )
+  {
+    auto tag = DdCompTable::op_tag(static_cast<SizeType>(op));
+    return mMgr->comp_table().find(e0, e1, tag, result);
+  }
+
+  /// @brief 演算結果を演算結果テーブルに登録する．
+  void
+  put_result(
+    ZddOpCode op, ///< [in] 演算コード
+    DdEdge e0,    ///< [in] オペランド1
+    DdEdge e1,    ///< [in] オペランド2
+    DdEdge result ///< [in] 結果
+  )
+  {
+    auto tag = DdCompTable::op_tag(static_cast<SizeType>(op));
+    mMgr->comp_table().put(e0, e1, tag, result);
+  }
+
   /// @brief 先頭の変数で分解する．
   static
   SizeType
@@ -63,9 +63,9 @@ ZddProductOp::prod_step(
   }
 
   // 演算結果テーブルを調べる．
-  Apply2Key key{left, right};
-  if ( mTable.count(key) > 0 ) {
-    return mTable.at(key);
+  DdEdge result;
+  if ( find_result(ZddOpCode::Product, left, right, result) ) {
+    return result;
   }
 
   // 見つからなかったので実際に apply 演算を行う．
@@ -74,14 +74,19 @@ ZddProductOp::prod_step(
   DdEdge right0, right1;
   auto top_index = decomp(left, right, left0, left1, right0, right1);
 
-  auto e00 = prod_step(left0, right0);
-  auto e01 = prod_step(left0, right1);
-  auto e10 = prod_step(left1, right0);
-  auto e11 = prod_step(left1, right1);
+  DdEdge e00, e01, e10, e11;
+  par_do([&](){
+    par_do([&](){ e00 = prod_step(left0, right0); },
+	   [&](){ e01 = prod_step(left0, right1); });
+  },
+  [&](){
+    par_do([&](){ e10 = prod_step(left1, right0); },
+	   [&](){ e11 = prod_step(left1, right1); });
+  });
   auto tmp = mCupOp.cup_step(e01, e10);
   auto sum = mCupOp.cup_step(tmp, e11);
-  auto result = new_node(top_index, e00, sum);
-  mTable.emplace(key, result);
+  result = new_node(top_index, e00, sum);
+  put_result(ZddOpCode::Product, left, right, result);
   return result;
 }
 
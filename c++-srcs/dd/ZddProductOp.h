@@ -8,7 +8,6 @@
 /// Copyright (C) 2023 Yusuke Matsunaga
 /// All rights reserved.
 
-#include "Apply2Key.h"
 #include "ZddOpBase.h"
 #include "ZddCupOp.h"
 
@@ -57,9 +56,6 @@ private:
   // CUP 演算
   ZddCupOp mCupOp;
 
-  // 演算結果テーブル
-  std::unordered_map<Apply2Key, DdEdge> mTable;
-
 };
 
 END_NAMESPACE_YM_DD
@@ -0,0 +1,137 @@
+
+/// @file ZddSampler.cc
+/// @brief ZddSampler の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ZddSampler.h"
+#include "ym/Zdd.h"
+#include "DdEdge.h"
+#include "DdNode.h"
+#include "ZddCountOp.h"
+#include <cmath>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+//////////////////////////////////////////////////////////////////////
+// クラス ZddSampler
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+ZddSampler::ZddSampler(
+  const Zdd& zdd,
+  const std::vector<ZddItem>& item_list
+) : mItemList{item_list}
+{
+  zdd._check_valid();
+  if ( zdd.is_zero() ) {
+    throw std::invalid_argument{"zdd is empty"};
+  }
+
+  // レベルから item_list 中の位置への写像
+  std::unordered_map<SizeType, SizeType> pos_map;
+  auto level_list = ZddItem::conv_to_levellist(item_list);
+  for ( SizeType i = 0; i < level_list.size(); ++ i ) {
+    pos_map.emplace(level_list[i], i);
+  }
+
+  auto root = zdd.root();
+  ZddCountOp op(root);
+  auto& node_list = op.node_list();
+  auto log_count = op.log2_count_list();
+  mNodeList.reserve(node_list.size());
+  for ( SizeType i = 0; i < node_list.size(); ++ i ) {
+    auto node = node_list[i];
+    if ( pos_map.count(node->level()) == 0 ) {
+      throw std::invalid_argument{"item_list does not contain the support"};
+    }
+    auto pos = pos_map.at(node->level());
+    auto edge0 = op.edge2int(node->edge0());
+    auto edge1 = op.edge2int(node->edge1());
+    mNodeList.push_back({pos, edge0, edge1, log_count[i]});
+  }
+  mRoot = op.edge2int(root);
+}
+
+// @brief 集合を一つ求める．
+std::vector<ZddItem>
+ZddSampler::sample(
+  std::mt19937& randgen
+) const
+{
+  std::vector<std::uint64_t> row(row_size());
+  sample_row(randgen, row.data());
+  std::vector<ZddItem> ans;
+  for ( SizeType i = 0; i < item_num(); ++ i ) {
+    if ( (row[i / 64] >> (i % 64)) & 1UL ) {
+      ans.push_back(mItemList[i]);
+    }
+  }
+  return ans;
+}
+
+// @brief 集合をまとめて求める．
+std::vector<std::uint64_t>
+ZddSampler::sample_batch(
+  SizeType num,
+  std::mt19937& randgen
+) const
+{
+  auto n = row_size();
+  std::vector<std::uint64_t> ans(num * n, 0UL);
+  for ( SizeType i = 0; i < num; ++ i ) {
+    sample_row(randgen, ans.data() + i * n);
+  }
+  return ans;
+}
+
+// @brief 1つの集合を row に書き込む．
+void
+ZddSampler::sample_row(
+  std::mt19937& randgen,
+  std::uint64_t* row
+) const
+{
+  auto n = row_size();
+  for ( SizeType i = 0; i < n; ++ i ) {
+    row[i] = 0UL;
+  }
+
+  std::uniform_real_distribution<double> rd{0.0, 1.0};
+  auto edge = mRoot;
+  while ( edge > 1 ) {
+    auto& node = mNodeList[edge / 2 - 1];
+    // 1枝を選ぶ確率は c1 / (c0 + c1) = 1 / (1 + 2^(log c0 - log c1))
+    auto l0 = log_count(node.mEdge0);
+    auto l1 = log_count(node.mEdge1);
+    auto p1 = 1.0 / (1.0 + std::exp2(l0 - l1));
+    if ( rd(randgen) < p1 ) {
+      row[node.mPos / 64] |= 1UL << (node.mPos % 64);
+      edge = node.mEdge1;
+    }
+    else {
+      edge = node.mEdge0;
+    }
+  }
+  ASSERT_COND( edge == 1 );
+}
+
+// @brief 枝の要素数の対数を返す．
+double
+ZddSampler::log_count(
+  SizeType edge
+) const
+{
+  if ( edge == 0 ) {
+    return -std::numeric_limits<double>::infinity();
+  }
+  if ( edge == 1 ) {
+    return 0.0;
+  }
+  return mNodeList[edge / 2 - 1].mLogCount;
+}
+
+END_NAMESPACE_YM_DD
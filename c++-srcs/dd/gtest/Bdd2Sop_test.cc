@@ -0,0 +1,120 @@
+
+/// @file Bdd2Sop_test.cc
+/// @brief Bdd2Sop のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include <gtest/gtest.h>
+#include "ym/Bdd2Sop.h"
+#include "ym/BddMgr.h"
+#include "ym/BddLit.h"
+#include "ym/TvFunc.h"
+#include <random>
+
+
+BEGIN_NAMESPACE_YM
+
+class Bdd2SopTest :
+  public ::testing::Test
+{
+public:
+
+  /// @brief ランダムな関数を作る．
+  TvFunc
+  random_func(
+    SizeType ni
+  )
+  {
+    std::uniform_int_distribution<TvFunc::WordType> rd;
+    SizeType nw = ni <= 6 ? 1 : (1UL << (ni - 6));
+    std::vector<TvFunc::WordType> data(nw);
+    for ( auto& w: data ) {
+      w = rd(mRandGen);
+    }
+    return TvFunc::from_raw_data(ni, std::move(data));
+  }
+
+  // 乱数生成器
+  std::mt19937 mRandGen;
+
+};
+
+TEST_F(Bdd2SopTest, isop)
+{
+  SizeType ni = 8;
+  BddMgr mgr;
+  std::vector<BddVar> var_list;
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    var_list.push_back(mgr.variable(i));
+  }
+  for ( SizeType c = 0; c < 20; ++ c ) {
+    auto f = random_func(ni);
+    auto dc = random_func(ni) & random_func(ni);
+    auto f_bdd = mgr.from_tvfunc(f, var_list);
+    auto dc_bdd = mgr.from_tvfunc(dc, var_list);
+    auto cube_list = Bdd2Sop::isop(f_bdd, dc_bdd, var_list);
+
+    // f & ~dc <= cover <= f | dc が成り立つ．
+    auto cover = SopCube::tvfunc(ni, cube_list);
+    EXPECT_TRUE( (f & ~dc).check_containment(cover) );
+    EXPECT_TRUE( cover.check_containment(f | dc) );
+
+    // どのキューブを取り除いても f & ~dc を覆わなくなる．
+    for ( SizeType i = 0; i < cube_list.size(); ++ i ) {
+      auto cover1 = TvFunc::zero(ni);
+      for ( SizeType j = 0; j < cube_list.size(); ++ j ) {
+	if ( j != i ) {
+	  cover1 |= cube_list[j].tvfunc();
+	}
+      }
+      EXPECT_FALSE( (f & ~dc).check_containment(cover1) );
+    }
+  }
+}
+
+TEST_F(Bdd2SopTest, const)
+{
+  BddMgr mgr;
+  std::vector<BddVar> var_list{mgr.variable(0), mgr.variable(1)};
+  EXPECT_TRUE( Bdd2Sop::isop(mgr.zero(), var_list).empty() );
+  auto one_list = Bdd2Sop::isop(mgr.one(), var_list);
+  ASSERT_EQ( 1, one_list.size() );
+  EXPECT_EQ( 0, one_list.front().literal_num() );
+}
+
+TEST_F(Bdd2SopTest, wide)
+{
+  // TvFunc では扱えない入力数
+  SizeType ni = 48;
+  BddMgr mgr;
+  std::vector<BddVar> var_list;
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    var_list.push_back(mgr.variable(i));
+  }
+  // x0 x1 + x2 x3 + ... + x46 x47
+  auto f = mgr.zero();
+  for ( SizeType i = 0; i < ni; i += 2 ) {
+    f |= var_list[i].positive_literal() & var_list[i + 1].positive_literal();
+  }
+  auto cube_list = Bdd2Sop::isop(f, var_list);
+  EXPECT_EQ( ni / 2, cube_list.size() );
+  auto g = mgr.zero();
+  for ( auto& cube: cube_list ) {
+    EXPECT_EQ( 2, cube.literal_num() );
+    g |= mgr.from_expr(cube.expr(), var_list);
+  }
+  EXPECT_EQ( f, g );
+}
+
+TEST_F(Bdd2SopTest, bad_var)
+{
+  BddMgr mgr;
+  auto x0 = mgr.variable(0);
+  auto x1 = mgr.variable(1);
+  auto f = x0.positive_literal() & x1.positive_literal();
+  EXPECT_THROW( Bdd2Sop::isop(f, {x0}), std::invalid_argument );
+}
+
+END_NAMESPACE_YM
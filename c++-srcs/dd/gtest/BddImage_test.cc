@@ -0,0 +1,162 @@
+
+/// @file BddImage_test.cc
+/// @brief BddImage のユニットテスト
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include <gtest/gtest.h>
+#include "ym/BddImage.h"
+#include "ym/Bdd.h"
+#include "ym/BddMgr.h"
+#include "ym/BddVar.h"
+#include <cstdio>
+#include <fstream>
+
+
+BEGIN_NAMESPACE_YM
+
+class BddImageTest :
+public ::testing::Test
+{
+public:
+
+  void
+  SetUp() override
+  {
+    mFilename = ::testing::TempDir() + "BddImage_test.img";
+    const SizeType n = 6;
+    for ( SizeType i = 0; i < n; ++ i ) {
+      mVarList.push_back(mMgr.variable(i));
+    }
+    auto& v = mVarList;
+    mBddList.push_back((v[0] & v[3]) | (v[1] & v[4]) | (v[2] & v[5]));
+    mBddList.push_back(v[0] ^ v[1] ^ ~v[5]);
+    mBddList.push_back(mMgr.zero());
+    mBddList.push_back(~mBddList[0] | v[2]);
+    BddImage::write(mFilename, mBddList);
+  }
+
+  void
+  TearDown() override
+  {
+    std::remove(mFilename.c_str());
+  }
+
+  BddMgr mMgr;
+
+  std::vector<BddVar> mVarList;
+
+  std::vector<Bdd> mBddList;
+
+  std::string mFilename;
+
+};
+
+TEST_F(BddImageTest, header)
+{
+  BddImage image{mFilename};
+  EXPECT_EQ( mBddList.size(), image.root_num() );
+  EXPECT_EQ( mVarList.size(), image.variable_num() );
+  EXPECT_EQ( Bdd::bdd_size(mBddList), image.node_num() );
+  for ( SizeType level = 0; level < image.variable_num(); ++ level ) {
+    EXPECT_EQ( level, image.level_to_varid(level) );
+  }
+}
+
+TEST_F(BddImageTest, eval)
+{
+  BddImage image{mFilename};
+  auto n = mVarList.size();
+  std::vector<bool> inputs(n);
+  for ( SizeType p = 0; p < (1UL << n); ++ p ) {
+    for ( SizeType i = 0; i < n; ++ i ) {
+      inputs[i] = static_cast<bool>((p >> i) & 1);
+    }
+    for ( SizeType pos = 0; pos < mBddList.size(); ++ pos ) {
+      EXPECT_EQ( mBddList[pos].eval(inputs), image.eval(pos, inputs) );
+    }
+  }
+}
+
+TEST_F(BddImageTest, minterm_count)
+{
+  BddImage image{mFilename};
+  for ( SizeType pos = 0; pos < mBddList.size(); ++ pos ) {
+    EXPECT_EQ( mBddList[pos].minterm_count(6),
+	       image.minterm_count(pos, 6) );
+    EXPECT_EQ( mBddList[pos].minterm_count(10),
+	       image.minterm_count(pos, 10) );
+  }
+}
+
+TEST_F(BddImageTest, for_each_path)
+{
+  BddImage image{mFilename};
+  for ( SizeType pos = 0; pos < mBddList.size(); ++ pos ) {
+    // 経路の和は元の関数と等しい．
+    auto bdd = mMgr.zero();
+    image.for_each_path(pos, [&](const std::vector<Literal>& lit_list) {
+      auto cube = mMgr.one();
+      for ( auto lit: lit_list ) {
+	auto var = mVarList[lit.varid()];
+	cube &= lit.is_negative() ? ~var : Bdd{var};
+      }
+      // 経路は互いに排他的
+      EXPECT_TRUE( (bdd & cube).is_zero() );
+      bdd |= cube;
+      return true;
+    });
+    EXPECT_EQ( mBddList[pos], bdd );
+  }
+
+  // 途中で打ち切る．
+  SizeType count = 0;
+  image.for_each_path(0, [&](const std::vector<Literal>&) {
+    ++ count;
+    return false;
+  });
+  EXPECT_EQ( 1, count );
+}
+
+TEST_F(BddImageTest, load_image)
+{
+  BddImage image{mFilename};
+
+  // 変数順の異なるマネージャに読み込む．
+  BddMgr mgr;
+  std::vector<BddVar> var_list;
+  for ( SizeType i = 0; i < mVarList.size(); ++ i ) {
+    var_list.push_back(mgr.variable(i));
+  }
+  mgr.set_variable_order({var_list[5], var_list[4], var_list[3],
+			  var_list[2], var_list[1], var_list[0]});
+  auto bdd_list = mgr.load_image(image);
+  ASSERT_EQ( mBddList.size(), bdd_list.size() );
+  for ( SizeType pos = 0; pos < mBddList.size(); ++ pos ) {
+    EXPECT_EQ( mBddList[pos].to_truth(mVarList),
+	       bdd_list[pos].to_truth(var_list) );
+  }
+
+  // 同じマネージャに読み込むと同じ BDD になる．
+  auto bdd_list2 = mMgr.load_image(image);
+  EXPECT_EQ( mBddList, bdd_list2 );
+}
+
+TEST_F(BddImageTest, bad_file)
+{
+  EXPECT_THROW( BddImage{mFilename + ".none"}, std::invalid_argument );
+
+  // 途中で切れたファイル
+  {
+    std::ifstream s{mFilename, std::ios::binary};
+    std::string buff{std::istreambuf_iterator<char>(s),
+		     std::istreambuf_iterator<char>()};
+    std::ofstream t{mFilename, std::ios::binary};
+    t.write(buff.data(), buff.size() - 8);
+  }
+  EXPECT_THROW( BddImage{mFilename}, std::invalid_argument );
+}
+
+END_NAMESPACE_YM
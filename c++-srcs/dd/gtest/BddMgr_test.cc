@@ -11,6 +11,8 @@
 #include "ym/BddMgr.h"
 #include "ym/BddVar.h"
 #include "ym/Expr.h"
+#include "ym/TvFunc.h"
+#include <random>
 #include "BddTest.h"
 
 
@@ -124,7 +126,62 @@ TEST_F(BddTest, from_truth3)
   std::vector<BddVar> var_list{var2, var1, var0};
   const char* exp_str = "10010101";
   Bdd bdd = mMgr.from_truth(exp_str, var_list);
-  check(bdd, exp_str);
+  EXPECT_EQ( exp_str, bdd.to_truth(var_list) );
+
+  // check() は変数番号 0 を MSB として調べるので
+  // var_list の順に合わせて並べ替えた真理値表と比較する．
+  check(bdd, "10000111");
+}
+
+TEST_F(BddTest, from_tvfunc1)
+{
+  // 入力数が 6 を超える場合も含めて往復の変換を確かめる．
+  const SizeType ni = 10;
+  std::mt19937 randgen;
+  std::uniform_int_distribution<int> rd(0, 1);
+  std::vector<int> values(1 << ni);
+  for ( auto& v: values ) {
+    v = rd(randgen);
+  }
+  TvFunc func{ni, values};
+  std::vector<BddVar> var_list;
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    var_list.push_back(mMgr.variable(i));
+  }
+  auto bdd = mMgr.from_tvfunc(func);
+  for ( SizeType p = 0; p < (1 << ni); p += 7 ) {
+    std::vector<bool> inputs(ni);
+    for ( SizeType i = 0; i < ni; ++ i ) {
+      inputs[i] = static_cast<bool>((p >> i) & 1);
+    }
+    EXPECT_EQ( static_cast<bool>(values[p]), bdd.eval(inputs) );
+  }
+  EXPECT_EQ( func, bdd.to_tvfunc(var_list) );
+  EXPECT_EQ( func.str(), bdd.to_truth({var_list.rbegin(), var_list.rend()}) );
+
+  // 入力と変数の対応が変数順と異なる場合
+  std::vector<BddVar> var_list2{var_list.rbegin(), var_list.rend()};
+  std::swap(var_list2[1], var_list2[8]);
+  auto bdd2 = mMgr.from_tvfunc(func, var_list2);
+  EXPECT_EQ( func, bdd2.to_tvfunc(var_list2) );
+  for ( SizeType p = 0; p < (1 << ni); p += 7 ) {
+    std::vector<bool> inputs(ni);
+    for ( SizeType i = 0; i < ni; ++ i ) {
+      inputs[var_list2[i].id()] = static_cast<bool>((p >> i) & 1);
+    }
+    EXPECT_EQ( static_cast<bool>(values[p]), bdd2.eval(inputs) );
+  }
+}
+
+TEST_F(BddTest, to_tvfunc_bad)
+{
+  auto var0 = mMgr.variable(0);
+  auto var1 = mMgr.variable(1);
+  auto bdd = var0 & var1;
+  EXPECT_THROW( bdd.to_tvfunc({var0}), std::invalid_argument );
+  EXPECT_THROW( bdd.to_tvfunc({var0, var1, var0}), std::invalid_argument );
+  EXPECT_THROW( mMgr.from_tvfunc(TvFunc::zero(2), {var0, var0}),
+		std::invalid_argument );
 }
 
 TEST_F(BddTest, from_expr1)
@@ -240,6 +297,157 @@ TEST_F(BddTest, mgr_var_ordering)
   EXPECT_EQ( exp_o_list, o_list );
 }
 
+TEST_F(BddTest, mgr_var_ordering2)
+{
+  // 変数順を変えても関数は変わらない．
+  const SizeType n = 6;
+  std::vector<BddVar> var_list(n);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    var_list[i] = variable(i);
+  }
+  auto bdd1 = (var_list[0] & var_list[3]) | (var_list[1] ^ var_list[4]);
+  auto bdd2 = bdd1 ^ (var_list[2] & ~var_list[5]);
+  auto str1 = bdd1.to_truth(var_list);
+  auto str2 = bdd2.to_truth(var_list);
+
+  std::vector<BddVar> order_list{var_list[5], var_list[2], var_list[4],
+				 var_list[0], var_list[3], var_list[1]};
+  mMgr.set_variable_order(order_list);
+  EXPECT_EQ( order_list, mMgr.variable_order() );
+  EXPECT_EQ( str1, bdd1.to_truth(var_list) );
+  EXPECT_EQ( str2, bdd2.to_truth(var_list) );
+
+  // 変数順を変えた後の演算も正しく行われる．
+  auto bdd3 = bdd1 & bdd2;
+  auto bdd4 = (var_list[0] & var_list[3]) | (var_list[1] ^ var_list[4]);
+  EXPECT_EQ( bdd1, bdd4 );
+  std::vector<bool> inputs(n);
+  for ( SizeType p = 0; p < (1 << n); ++ p ) {
+    for ( SizeType i = 0; i < n; ++ i ) {
+      inputs[i] = static_cast<bool>((p >> i) & 1);
+    }
+    auto v1 = (inputs[0] && inputs[3]) || (inputs[1] != inputs[4]);
+    auto v2 = v1 != (inputs[2] && !inputs[5]);
+    EXPECT_EQ( v1, bdd1.eval(inputs) );
+    EXPECT_EQ( v1 && v2, bdd3.eval(inputs) );
+  }
+}
+
+TEST_F(BddTest, mgr_dvo_sift1)
+{
+  // x0 x4 + x1 x5 + x2 x6 + x3 x7 は変数番号の順では
+  // 指数サイズになるが sifting で小さくなる．
+  const SizeType n = 4;
+  std::vector<BddVar> var_list(n * 2);
+  for ( SizeType i = 0; i < n * 2; ++ i ) {
+    var_list[i] = variable(i);
+  }
+  auto bdd = mMgr.zero();
+  for ( SizeType i = 0; i < n; ++ i ) {
+    bdd |= var_list[i] & var_list[i + n];
+  }
+  auto str = bdd.to_truth(var_list);
+  auto size0 = bdd.size();
+
+  mMgr.dvo_sift();
+  EXPECT_EQ( str, bdd.to_truth(var_list) );
+  EXPECT_GT( size0, bdd.size() );
+  EXPECT_EQ( n * 2, bdd.size() );
+}
+
+TEST_F(BddTest, mgr_dvo_sift2)
+{
+  // グループ sifting
+  const SizeType n = 4;
+  std::vector<BddVar> var_list(n * 2);
+  for ( SizeType i = 0; i < n * 2; ++ i ) {
+    var_list[i] = variable(i);
+  }
+  auto bdd = mMgr.zero();
+  for ( SizeType i = 0; i < n; ++ i ) {
+    bdd |= var_list[i] & var_list[i + n];
+  }
+  auto str = bdd.to_truth(var_list);
+  auto size0 = bdd.size();
+
+  mMgr.enable_dvo_group();
+  mMgr.dvo_sift();
+  EXPECT_EQ( str, bdd.to_truth(var_list) );
+  EXPECT_GT( size0, bdd.size() );
+}
+
+TEST_F(BddTest, mgr_dvo_sift3)
+{
+  // 増加率と制限時間を指定しても関数は変わらない．
+  const SizeType n = 5;
+  std::vector<BddVar> var_list(n * 2);
+  for ( SizeType i = 0; i < n * 2; ++ i ) {
+    var_list[i] = variable(i);
+  }
+  auto bdd = mMgr.zero();
+  for ( SizeType i = 0; i < n; ++ i ) {
+    bdd |= var_list[i] & var_list[i + n];
+  }
+  auto str = bdd.to_truth(var_list);
+  auto size0 = bdd.size();
+
+  mMgr.set_dvo_max_growth(0.5);
+  EXPECT_EQ( 1.0, mMgr.dvo_max_growth() );
+  mMgr.set_dvo_time_limit(1000);
+  EXPECT_EQ( 1000, mMgr.dvo_time_limit() );
+  mMgr.dvo_sift();
+  EXPECT_EQ( str, bdd.to_truth(var_list) );
+  EXPECT_GE( size0, bdd.size() );
+}
+
+TEST_F(BddTest, mgr_dvo_window)
+{
+  const SizeType n = 4;
+  std::vector<BddVar> var_list(n * 2);
+  for ( SizeType i = 0; i < n * 2; ++ i ) {
+    var_list[i] = variable(i);
+  }
+  auto bdd = mMgr.zero();
+  for ( SizeType i = 0; i < n; ++ i ) {
+    bdd |= var_list[i] & var_list[i + n];
+  }
+  auto str = bdd.to_truth(var_list);
+  auto size0 = bdd.size();
+
+  mMgr.dvo_window(4);
+  EXPECT_EQ( str, bdd.to_truth(var_list) );
+  EXPECT_GT( size0, bdd.size() );
+}
+
+TEST_F(BddTest, mgr_auto_dvo)
+{
+  // ノード数が増えると自動的に sifting が行われる．
+  const SizeType n = 12;
+  std::vector<BddVar> var_list(n * 2);
+  for ( SizeType i = 0; i < n * 2; ++ i ) {
+    var_list[i] = variable(i);
+  }
+  mMgr.enable_auto_dvo();
+  auto bdd = mMgr.zero();
+  for ( SizeType i = 0; i < n; ++ i ) {
+    bdd |= var_list[i] & var_list[i + n];
+  }
+  // 変数番号の順では 2^(n + 1) 程度のノード数になる．
+  EXPECT_GT( SizeType{1} << n, bdd.size() );
+  EXPECT_NE( mMgr.variable_list(), mMgr.variable_order() );
+
+  std::vector<bool> inputs(n * 2, false);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    inputs[i] = true;
+    EXPECT_FALSE( bdd.eval(inputs) );
+    inputs[i + n] = true;
+    EXPECT_TRUE( bdd.eval(inputs) );
+    inputs[i] = false;
+    EXPECT_FALSE( bdd.eval(inputs) );
+    inputs[i + n] = false;
+  }
+}
+
 TEST_F(BddTest, mgr_bdd_size1)
 {
   auto bdd1 = from_truth("1000");
@@ -290,4 +498,78 @@ TEST_F(BddTest, mgr_display2)
   EXPECT_EQ( exp_str, os.str() );
 }
 
+TEST_F(BddTest, mgr_gc1)
+{
+  // 参照されていないノードは garbage_collection() で削除される．
+  const SizeType n = 10;
+  std::vector<BddVar> var_list(n);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    var_list[i] = variable(i);
+  }
+  mMgr.garbage_collection();
+  EXPECT_EQ( n, mMgr.node_num() );
+
+  {
+    auto bdd = mMgr.zero();
+    for ( SizeType i = 0; i < n; ++ i ) {
+      bdd ^= var_list[i];
+    }
+    EXPECT_LT( n, mMgr.node_num() );
+  }
+  mMgr.garbage_collection();
+  EXPECT_EQ( n, mMgr.node_num() );
+}
+
+TEST_F(BddTest, mgr_gc2)
+{
+  // 参照されなくなったノードも GC までは再利用される．
+  const SizeType n = 10;
+  std::vector<BddVar> var_list(n);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    var_list[i] = variable(i);
+  }
+  auto bdd1 = mMgr.one();
+  for ( SizeType i = n; i -- > 0; ) {
+    bdd1 &= var_list[i];
+  }
+  auto str1 = bdd1.to_truth(var_list);
+  mMgr.garbage_collection();
+  auto node_num = mMgr.node_num();
+
+  // bdd1 を解放してから同じ関数を作り直す．
+  bdd1 = mMgr.zero();
+  auto bdd2 = mMgr.one();
+  for ( SizeType i = n; i -- > 0; ) {
+    bdd2 &= var_list[i];
+  }
+  EXPECT_EQ( node_num, mMgr.node_num() );
+
+  mMgr.garbage_collection();
+  EXPECT_EQ( node_num, mMgr.node_num() );
+  EXPECT_EQ( str1, bdd2.to_truth(var_list) );
+}
+
+TEST_F(BddTest, mgr_gc3)
+{
+  // GC を禁止している間は自動的な GC は行われない．
+  mMgr.set_gc_limit(1);
+  EXPECT_EQ( 1, mMgr.gc_limit() );
+  mMgr.disable_gc();
+  auto var0 = variable(0);
+  auto var1 = variable(1);
+  {
+    auto bdd = var0 ^ var1;
+    bdd = var0 & var1;
+  }
+  auto bdd = var0 | var1;
+  EXPECT_LT( 2, mMgr.node_num() );
+  // 明示的に呼んでも GC は行われない．
+  auto n = mMgr.node_num();
+  mMgr.garbage_collection();
+  EXPECT_EQ( n, mMgr.node_num() );
+  mMgr.enable_gc();
+  mMgr.garbage_collection();
+  EXPECT_EQ( 3, mMgr.node_num() );
+}
+
 END_NAMESPACE_YM
@@ -0,0 +1,127 @@
+
+/// @file BddSampler_test.cc
+/// @brief BddSampler のユニットテスト
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include <gtest/gtest.h>
+#include "ym/BddSampler.h"
+#include "ym/Bdd.h"
+#include "ym/BddMgr.h"
+#include "ym/BddVar.h"
+
+
+BEGIN_NAMESPACE_YM
+
+TEST(BddSamplerTest, uniform)
+{
+  // f = x0 x1 + ~x0 ~x1 ~x2 の真となる割当は
+  // (x0, x1, x2) = (1, 1, 0), (1, 1, 1), (0, 0, 0) の3つ
+  BddMgr mgr;
+  auto x0 = mgr.variable(0);
+  auto x1 = mgr.variable(1);
+  auto x2 = mgr.variable(2);
+  auto f = (x0 & x1) | (~x0 & ~x1 & ~x2);
+  BddSampler sampler{f, {x0, x1, x2}};
+  EXPECT_EQ( 3, sampler.variable_num() );
+  EXPECT_EQ( 1, sampler.row_size() );
+
+  std::mt19937 randgen;
+  const SizeType n = 3000;
+  SizeType count[8] = {0};
+  for ( SizeType i = 0; i < n; ++ i ) {
+    auto v = sampler.sample(randgen);
+    ASSERT_EQ( 3, v.size() );
+    EXPECT_TRUE( f.eval(v) );
+    auto pat = v[0] * 1 + v[1] * 2 + v[2] * 4;
+    ++ count[pat];
+  }
+  EXPECT_EQ( n, count[0] + count[3] + count[7] );
+  // 期待値は 1000
+  EXPECT_NEAR( 1000, count[0], 150 );
+  EXPECT_NEAR( 1000, count[3], 150 );
+  EXPECT_NEAR( 1000, count[7], 150 );
+}
+
+TEST(BddSamplerTest, sparse)
+{
+  // 200 変数の AND に1変数の自由度を加えたもの
+  // 元の変数の順序とは逆に並べる．
+  BddMgr mgr;
+  const SizeType nv = 201;
+  std::vector<BddVar> var_list;
+  auto f = mgr.one();
+  for ( SizeType i = 0; i < nv; ++ i ) {
+    auto var = mgr.variable(i);
+    var_list.push_back(var);
+    if ( i < nv - 1 ) {
+      f &= var;
+    }
+  }
+  std::reverse(var_list.begin(), var_list.end());
+  BddSampler sampler{f, var_list};
+  EXPECT_EQ( 4, sampler.row_size() );
+
+  std::mt19937 randgen;
+  const SizeType n = 1000;
+  auto rows = sampler.sample_batch(n, randgen);
+  ASSERT_EQ( n * 4, rows.size() );
+  SizeType n1 = 0;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    auto row = &rows[i * 4];
+    // var_list の 1 〜 200 番目(x199 〜 x0)は 1
+    EXPECT_EQ( ~1UL, row[0] & ~1UL );
+    EXPECT_EQ( ~0UL, row[1] );
+    EXPECT_EQ( ~0UL, row[2] );
+    // 余ったビットは 0
+    EXPECT_EQ( 0UL, row[3] >> 9 );
+    EXPECT_EQ( 0x1FFUL, row[3] & 0x1FFUL );
+    // var_list の 0 番目(x200)は自由
+    if ( row[0] & 1UL ) {
+      ++ n1;
+    }
+  }
+  EXPECT_NEAR( 500, n1, 100 );
+}
+
+TEST(BddSamplerTest, complement)
+{
+  // 否定枝を含む場合
+  BddMgr mgr;
+  const SizeType nv = 10;
+  std::vector<BddVar> var_list;
+  auto f = mgr.zero();
+  for ( SizeType i = 0; i < nv; ++ i ) {
+    auto var = mgr.variable(i);
+    var_list.push_back(var);
+    f ^= var;
+  }
+  f = ~f | (var_list[0] & var_list[1]);
+  BddSampler sampler{f, var_list};
+  std::mt19937 randgen;
+  for ( SizeType i = 0; i < 1000; ++ i ) {
+    auto v = sampler.sample(randgen);
+    EXPECT_TRUE( f.eval(v) );
+  }
+}
+
+TEST(BddSamplerTest, bad_args)
+{
+  BddMgr mgr;
+  auto x0 = mgr.variable(0);
+  auto x1 = mgr.variable(1);
+
+  EXPECT_THROW( (BddSampler{mgr.zero(), {x0}}), std::invalid_argument );
+  EXPECT_THROW( (BddSampler{x0 & x1, {x0}}), std::invalid_argument );
+  EXPECT_THROW( (BddSampler{Bdd::invalid(), {x0}}), std::invalid_argument );
+
+  // 定数1は全ての割当が充足割当
+  BddSampler sampler{mgr.one(), {x0, x1}};
+  std::mt19937 randgen;
+  auto v = sampler.sample(randgen);
+  EXPECT_EQ( 2, v.size() );
+}
+
+END_NAMESPACE_YM
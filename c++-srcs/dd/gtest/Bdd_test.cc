@@ -13,6 +13,8 @@
 #include "ym/BinEnc.h"
 #include "ym/BinDec.h"
 #include "BddTest.h"
+#include <random>
+#include <cmath>
 
 
 BEGIN_NAMESPACE_YM
@@ -969,6 +971,140 @@ TEST_F(BddTest, cofactor_int7_invalid1)
     }, std::invalid_argument );
 }
 
+TEST_F(BddTest, exist1)
+{
+  const char* src_str = "11000110";
+  Bdd bdd = from_truth(src_str);
+
+  BddVarSet var_set{mgr(), {variable(0)}};
+  Bdd bdd1 = bdd.exist(var_set);
+  const char* exp_str = "11101110";
+  check(bdd1, exp_str);
+}
+
+TEST_F(BddTest, exist_int1)
+{
+  const char* src_str = "11000110";
+  Bdd bdd = from_truth(src_str);
+
+  BddVarSet var_set{mgr(), {variable(0)}};
+  Bdd bdd1 = bdd.exist_int(var_set);
+  const char* exp_str = "11101110";
+  check(bdd, exp_str);
+  check(bdd1, exp_str);
+}
+
+TEST_F(BddTest, exist2)
+{
+  const char* src_str = "1001011101101000";
+  Bdd bdd = from_truth(src_str);
+
+  auto var0 = variable(0);
+  auto var2 = variable(2);
+  BddVarSet var_set{mgr(), {var0, var2}};
+  Bdd bdd1 = bdd.exist(var_set);
+  Bdd tmp = bdd.cofactor(var0, false) | bdd.cofactor(var0, true);
+  Bdd exp_bdd = tmp.cofactor(var2, false) | tmp.cofactor(var2, true);
+  EXPECT_EQ( exp_bdd, bdd1 );
+}
+
+TEST_F(BddTest, exist_empty)
+{
+  const char* src_str = "10010111";
+  Bdd bdd = from_truth(src_str);
+
+  BddVarSet var_set{mgr()};
+  Bdd bdd1 = bdd.exist(var_set);
+  EXPECT_EQ( bdd, bdd1 );
+}
+
+TEST_F(BddTest, exist_invalid1)
+{
+  Bdd bdd; // 不正値
+
+  BddVarSet var_set{mgr(), {variable(0)}};
+  EXPECT_THROW( bdd.exist(var_set), std::logic_error );
+}
+
+TEST_F(BddTest, exist_invalid2)
+{
+  const char* src_str = "10010111";
+  Bdd bdd = from_truth(src_str);
+
+  BddMgr mgr2;
+  BddVarSet var_set{mgr2, {mgr2.variable(0)}};
+  EXPECT_THROW( bdd.exist(var_set), std::invalid_argument );
+}
+
+TEST_F(BddTest, forall1)
+{
+  const char* src_str = "11000110";
+  Bdd bdd = from_truth(src_str);
+
+  BddVarSet var_set{mgr(), {variable(0)}};
+  Bdd bdd1 = bdd.forall(var_set);
+  const char* exp_str = "01000100";
+  check(bdd1, exp_str);
+}
+
+TEST_F(BddTest, forall_int1)
+{
+  const char* src_str = "11000110";
+  Bdd bdd = from_truth(src_str);
+
+  BddVarSet var_set{mgr(), {variable(0)}};
+  Bdd bdd1 = bdd.forall_int(var_set);
+  const char* exp_str = "01000100";
+  check(bdd, exp_str);
+  check(bdd1, exp_str);
+}
+
+TEST_F(BddTest, forall2)
+{
+  const char* src_str = "1101011111111000";
+  Bdd bdd = from_truth(src_str);
+
+  auto var1 = variable(1);
+  auto var3 = variable(3);
+  BddVarSet var_set{mgr(), {var1, var3}};
+  Bdd bdd1 = bdd.forall(var_set);
+  Bdd tmp = bdd.cofactor(var1, false) & bdd.cofactor(var1, true);
+  Bdd exp_bdd = tmp.cofactor(var3, false) & tmp.cofactor(var3, true);
+  EXPECT_EQ( exp_bdd, bdd1 );
+}
+
+TEST_F(BddTest, and_exist1)
+{
+  Bdd bdd1 = from_truth("1001011101101000");
+  Bdd bdd2 = from_truth("1110001011010110");
+
+  BddVarSet var_set{mgr(), {variable(1), variable(2)}};
+  Bdd bdd3 = bdd1.and_exist(bdd2, var_set);
+  Bdd exp_bdd = (bdd1 & bdd2).exist(var_set);
+  EXPECT_EQ( exp_bdd, bdd3 );
+}
+
+TEST_F(BddTest, and_exist2)
+{
+  // 量化する変数がない場合は単なる論理積になる．
+  Bdd bdd1 = from_truth("10010111");
+  Bdd bdd2 = from_truth("11100010");
+
+  BddVarSet var_set{mgr()};
+  Bdd bdd3 = bdd1.and_exist(bdd2, var_set);
+  EXPECT_EQ( bdd1 & bdd2, bdd3 );
+}
+
+TEST_F(BddTest, and_exist_invalid1)
+{
+  Bdd bdd1 = from_truth("10010111");
+
+  BddMgr mgr2;
+  Bdd bdd2 = mgr2.variable(0);
+  BddVarSet var_set{mgr(), {variable(0)}};
+  EXPECT_THROW( bdd1.and_exist(bdd2, var_set), std::invalid_argument );
+}
+
 TEST_F(BddTest, support_cup1)
 {
   Bdd lit1 = literal(0);
@@ -1833,4 +1969,205 @@ TEST_F(BddTest, display1)
   EXPECT_EQ( exp_str, os.str() );
 }
 
+TEST_F(BddTest, parallel_apply)
+{
+  // 並列実行の結果を真理値表から求めた期待値と比べる．
+  const SizeType ni = 14;
+  const SizeType n = 1 << ni;
+  std::mt19937 rg{1};
+  std::uniform_int_distribution<int> rd{0, 1};
+  std::string str1(n, '0');
+  std::string str2(n, '0');
+  std::string str3(n, '0');
+  for ( SizeType i = 0; i < n; ++ i ) {
+    str1[i] = rd(rg) ? '1' : '0';
+    str2[i] = rd(rg) ? '1' : '0';
+    str3[i] = rd(rg) ? '1' : '0';
+  }
+  std::string and_str(n, '0');
+  std::string or_str(n, '0');
+  std::string xor_str(n, '0');
+  std::string ite_str(n, '0');
+  for ( SizeType i = 0; i < n; ++ i ) {
+    bool v1 = str1[i] == '1';
+    bool v2 = str2[i] == '1';
+    bool v3 = str3[i] == '1';
+    and_str[i] = (v1 && v2) ? '1' : '0';
+    or_str[i] = (v1 || v2) ? '1' : '0';
+    xor_str[i] = (v1 != v2) ? '1' : '0';
+    ite_str[i] = (v1 ? v2 : v3) ? '1' : '0';
+  }
+
+  mgr().set_thread_num(4);
+  EXPECT_EQ( 4, mgr().thread_num() );
+
+  Bdd bdd1 = from_truth(str1.c_str());
+  Bdd bdd2 = from_truth(str2.c_str());
+  Bdd bdd3 = from_truth(str3.c_str());
+  std::vector<BddVar> var_list(ni);
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    var_list[i] = variable(i);
+  }
+  EXPECT_EQ( and_str, (bdd1 & bdd2).to_truth(var_list) );
+  EXPECT_EQ( or_str, (bdd1 | bdd2).to_truth(var_list) );
+  EXPECT_EQ( xor_str, (bdd1 ^ bdd2).to_truth(var_list) );
+  EXPECT_EQ( ite_str, Bdd::ite(bdd1, bdd2, bdd3).to_truth(var_list) );
+
+  mgr().set_thread_num(1);
+  EXPECT_EQ( 1, mgr().thread_num() );
+}
+
+TEST_F(BddTest, deep_chain)
+{
+  // 再帰の深さが変数の数に比例する演算
+  const SizeType n = 20000;
+  auto even_and = mMgr.one();
+  auto odd_and = mMgr.one();
+  auto even_xor = mMgr.zero();
+  auto odd_xor = mMgr.zero();
+  for ( SizeType i = n; i -- > 0; ) {
+    auto var = variable(i);
+    if ( i % 2 == 0 ) {
+      even_and &= var;
+      even_xor ^= var;
+    }
+    else {
+      odd_and &= var;
+      odd_xor ^= var;
+    }
+  }
+
+  auto and_chain = even_and & odd_and;
+  EXPECT_EQ( n, and_chain.size() );
+  EXPECT_EQ( n, and_chain.support_size() );
+
+  auto or_chain = ~even_and | ~odd_and;
+  EXPECT_EQ( ~and_chain, or_chain );
+
+  auto xor_chain = even_xor ^ odd_xor;
+  EXPECT_EQ( n, xor_chain.size() );
+  EXPECT_EQ( n, xor_chain.support_size() );
+
+  auto ite_chain = Bdd::ite(even_xor, odd_and, odd_xor);
+  EXPECT_EQ( (even_xor & odd_and) | (~even_xor & odd_xor), ite_chain );
+
+  // 深い BDD の解放
+  and_chain = mMgr.zero();
+  or_chain = mMgr.zero();
+  xor_chain = mMgr.zero();
+  ite_chain = mMgr.zero();
+  even_and = mMgr.zero();
+  odd_and = mMgr.zero();
+  even_xor = mMgr.zero();
+  odd_xor = mMgr.zero();
+  mMgr.garbage_collection();
+}
+
+TEST_F(BddTest, minterm_count1)
+{
+  auto var0 = variable(0);
+  auto var1 = variable(1);
+  auto var2 = variable(2);
+
+  EXPECT_EQ( 0.0, mMgr.zero().minterm_count(3) );
+  EXPECT_EQ( 8.0, mMgr.one().minterm_count(3) );
+  EXPECT_EQ( "0", mMgr.zero().minterm_count_str(3) );
+  EXPECT_EQ( "8", mMgr.one().minterm_count_str(3) );
+  EXPECT_EQ( -std::numeric_limits<double>::infinity(),
+	     mMgr.zero().log2_minterm_count(3) );
+  EXPECT_EQ( 3.0, mMgr.one().log2_minterm_count(3) );
+
+  auto f1 = var0 & var1;
+  EXPECT_EQ( 1.0, f1.minterm_count(2) );
+  EXPECT_EQ( 2.0, f1.minterm_count(3) );
+  EXPECT_EQ( "2", f1.minterm_count_str(3) );
+  EXPECT_DOUBLE_EQ( 1.0, f1.log2_minterm_count(3) );
+
+  auto f2 = var0 | var2;
+  EXPECT_EQ( 6.0, f2.minterm_count(3) );
+  EXPECT_EQ( "6", f2.minterm_count_str(3) );
+  EXPECT_EQ( "12", f2.minterm_count_str(4) );
+  EXPECT_DOUBLE_EQ( std::log2(6.0), f2.log2_minterm_count(3) );
+
+  auto f3 = var0 ^ var1 ^ var2;
+  EXPECT_EQ( 4.0, f3.minterm_count(3) );
+  EXPECT_EQ( "4", f3.minterm_count_str(3) );
+}
+
+TEST_F(BddTest, minterm_count2)
+{
+  // 真理値表の1の数と比較する．
+  const SizeType ni = 8;
+  const SizeType ni_exp = 1 << ni;
+  std::mt19937 rg;
+  std::uniform_int_distribution<int> rd{0, 1};
+  for ( SizeType c = 0; c < 20; ++ c ) {
+    std::string str;
+    SizeType n1 = 0;
+    for ( SizeType i = 0; i < ni_exp; ++ i ) {
+      if ( rd(rg) ) {
+	str += '1';
+	++ n1;
+      }
+      else {
+	str += '0';
+      }
+    }
+    auto f = from_truth(str.c_str());
+    EXPECT_EQ( static_cast<double>(n1), f.minterm_count(ni) );
+    EXPECT_EQ( static_cast<double>(n1 * 4), f.minterm_count(ni + 2) );
+    EXPECT_EQ( std::to_string(n1), f.minterm_count_str(ni) );
+    EXPECT_EQ( std::to_string(n1 * 4), f.minterm_count_str(ni + 2) );
+    EXPECT_NEAR( std::log2(n1), f.log2_minterm_count(ni), 1e-9 );
+    auto nf = ~f;
+    EXPECT_EQ( std::to_string(ni_exp - n1), nf.minterm_count_str(ni) );
+  }
+}
+
+TEST_F(BddTest, minterm_count3)
+{
+  // 64 を越える変数
+  const SizeType n = 200;
+  auto and_f = mMgr.one();
+  auto xor_f = mMgr.zero();
+  for ( SizeType i = n; i -- > 0; ) {
+    auto var = variable(i);
+    and_f &= var;
+    xor_f ^= var;
+  }
+
+  EXPECT_EQ( "1", and_f.minterm_count_str(n) );
+  EXPECT_EQ( "72057594037927936", and_f.minterm_count_str(n + 56) );
+  EXPECT_DOUBLE_EQ( 56.0, and_f.log2_minterm_count(n + 56) );
+  EXPECT_DOUBLE_EQ( std::ldexp(1.0, 56), and_f.minterm_count(n + 56) );
+  // ~and_f = 2^200 - 1
+  EXPECT_DOUBLE_EQ( 200.0, (~and_f).log2_minterm_count(n) );
+
+  // 2^199
+  EXPECT_EQ( "803469022129495137770981046170581301261101496891396417650688",
+	     xor_f.minterm_count_str(n) );
+  EXPECT_EQ( "803469022129495137770981046170581301261101496891396417650688",
+	     (~xor_f).minterm_count_str(n) );
+  EXPECT_DOUBLE_EQ( 199.0, xor_f.log2_minterm_count(n) );
+  EXPECT_DOUBLE_EQ( std::ldexp(1.0, 199), xor_f.minterm_count(n) );
+
+  // 2000 変数では double は溢れるが対数は求まる．
+  EXPECT_EQ( std::numeric_limits<double>::infinity(),
+	     mMgr.one().minterm_count(2000) );
+  EXPECT_DOUBLE_EQ( 1999.0, xor_f.log2_minterm_count(2000) );
+}
+
+TEST_F(BddTest, minterm_count_bad)
+{
+  auto f = variable(0) & variable(5);
+  EXPECT_THROW( f.minterm_count(1), std::invalid_argument );
+  EXPECT_THROW( f.log2_minterm_count(1), std::invalid_argument );
+  EXPECT_THROW( f.minterm_count_str(1), std::invalid_argument );
+  // サポートの数以上なら変数番号によらずに数えられる．
+  EXPECT_EQ( "1", f.minterm_count_str(2) );
+
+  Bdd bad;
+  EXPECT_THROW( bad.minterm_count(2), std::invalid_argument );
+}
+
 END_NAMESPACE_YM
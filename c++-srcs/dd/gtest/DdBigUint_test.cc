@@ -0,0 +1,61 @@
+
+/// @file DdBigUint_test.cc
+/// @brief DdBigUint_test の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "DdBigUint.h"
+#include <cmath>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+TEST(DdBigUintTest, constructor)
+{
+  DdBigUint a;
+  EXPECT_TRUE( a.is_zero() );
+  EXPECT_EQ( "0", a.to_string() );
+
+  DdBigUint b{1234567890123456789UL};
+  EXPECT_FALSE( b.is_zero() );
+  EXPECT_TRUE( b.fits_size() );
+  EXPECT_EQ( 1234567890123456789UL, b.to_size() );
+  EXPECT_EQ( "1234567890123456789", b.to_string() );
+}
+
+TEST(DdBigUintTest, add_sub)
+{
+  // 2^64 - 1 + 1 = 2^64
+  DdBigUint a{~0UL};
+  a += DdBigUint{1};
+  EXPECT_FALSE( a.fits_size() );
+  EXPECT_EQ( "18446744073709551616", a.to_string() );
+  EXPECT_EQ( DdBigUint::pow2(64), a );
+
+  a -= DdBigUint{1};
+  EXPECT_TRUE( a.fits_size() );
+  EXPECT_EQ( ~0UL, a.to_size() );
+
+  a -= DdBigUint{~0UL};
+  EXPECT_TRUE( a.is_zero() );
+}
+
+TEST(DdBigUintTest, shift)
+{
+  auto a = DdBigUint::pow2(100);
+  EXPECT_EQ( "1267650600228229401496703205376", a.to_string() );
+  EXPECT_DOUBLE_EQ( std::ldexp(1.0, 100), a.to_double() );
+
+  DdBigUint b{3};
+  b <<= 99;
+  b >>= 99;
+  EXPECT_EQ( DdBigUint{3}, b );
+
+  b >>= 2;
+  EXPECT_TRUE( b.is_zero() );
+}
+
+END_NAMESPACE_YM_DD
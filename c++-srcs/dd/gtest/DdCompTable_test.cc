@@ -0,0 +1,158 @@
+
+/// @file DdCompTable_test.cc
+/// @brief DdCompTable_test の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "DdCompTable.h"
+#include "DdNode.h"
+#include <thread>
+#include <vector>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+TEST(DdCompTableTest, constructor)
+{
+  DdCompTable table{3000};
+
+  // 2のべき乗に切り上げられる．
+  EXPECT_EQ( 4096, table.size() );
+}
+
+TEST(DdCompTableTest, put_find)
+{
+  DdCompTable table;
+
+  DdNode node1{0, DdEdge::zero(), DdEdge::one()};
+  DdNode node2{1, DdEdge::zero(), DdEdge::one()};
+  DdEdge e1{&node1};
+  DdEdge e2{&node2};
+
+  DdEdge result;
+  EXPECT_FALSE( table.find(e1, e2, DdEdge::zero(), result) );
+
+  table.put(e1, e2, DdEdge::zero(), ~e2);
+  ASSERT_TRUE( table.find(e1, e2, DdEdge::zero(), result) );
+  EXPECT_EQ( ~e2, result );
+
+  // オペランドの極性が異なれば別のキーとなる．
+  EXPECT_FALSE( table.find(e1, ~e2, DdEdge::zero(), result) );
+}
+
+TEST(DdCompTableTest, op_tag)
+{
+  DdCompTable table;
+
+  DdNode node1{0, DdEdge::zero(), DdEdge::one()};
+  DdNode node2{1, DdEdge::zero(), DdEdge::one()};
+  DdEdge e1{&node1};
+  DdEdge e2{&node2};
+
+  auto tag1 = DdCompTable::op_tag(1);
+  auto tag2 = DdCompTable::op_tag(2);
+  table.put(e1, e2, tag1, e1);
+  table.put(e1, e2, tag2, e2);
+  table.put(DdCompTable::tag_edge(e1, 1), e2, DdEdge::zero(), ~e1);
+
+  DdEdge result;
+  ASSERT_TRUE( table.find(e1, e2, tag1, result) );
+  EXPECT_EQ( e1, result );
+  ASSERT_TRUE( table.find(e1, e2, tag2, result) );
+  EXPECT_EQ( e2, result );
+  ASSERT_TRUE( table.find(DdCompTable::tag_edge(e1, 1), e2, DdEdge::zero(), result) );
+  EXPECT_EQ( ~e1, result );
+  EXPECT_FALSE( table.find(e1, e2, DdEdge::zero(), result) );
+}
+
+TEST(DdCompTableTest, clear)
+{
+  DdCompTable table;
+
+  DdNode node1{0, DdEdge::zero(), DdEdge::one()};
+  DdEdge e1{&node1};
+
+  table.put(e1, e1, DdEdge::one(), e1);
+  table.clear();
+
+  DdEdge result;
+  EXPECT_FALSE( table.find(e1, e1, DdEdge::one(), result) );
+}
+
+TEST(DdCompTableTest, sweep)
+{
+  DdCompTable table;
+
+  // 参照回数が 0 のノードを含むエントリは削除される．
+  DdNode node1{0, DdEdge::zero(), DdEdge::one()};
+  DdEdge e1{&node1};
+
+  table.put(e1, DdEdge::one(), DdCompTable::op_tag(1), DdEdge::zero());
+  table.sweep();
+
+  DdEdge result;
+  EXPECT_FALSE( table.find(e1, DdEdge::one(), DdCompTable::op_tag(1), result) );
+}
+
+TEST(DdCompTableTest, concurrent_put_find)
+{
+  // 小さなテーブルで衝突させながら複数のスレッドで put() と find() を行う．
+  // 見つかった結果は常にキーに対応したものでなければならない．
+  DdCompTable table{4};
+
+  const SizeType node_num = 16;
+  std::vector<DdNode> node_list;
+  node_list.reserve(node_num);
+  for ( SizeType i = 0; i < node_num; ++ i ) {
+    node_list.push_back(DdNode{i, DdEdge::zero(), DdEdge::one()});
+  }
+  // キーから決まる結果
+  auto result_of = [](SizeType i, SizeType k) {
+    return DdCompTable::op_tag(i * 16 + k + 1);
+  };
+
+  const SizeType thread_num = 4;
+  const SizeType loop_num = 200000;
+  std::vector<SizeType> error_count(thread_num, 0);
+  std::vector<SizeType> hit_count(thread_num, 0);
+  std::vector<std::thread> thread_list;
+  for ( SizeType t = 0; t < thread_num; ++ t ) {
+    thread_list.push_back(std::thread{[&, t]() {
+      for ( SizeType c = 0; c < loop_num; ++ c ) {
+	// 直前に put() したキーを find() する．
+	auto n = c / 2;
+	auto i = (n * 7 + t) % node_num;
+	auto k = (n * 13 + t * 5) % 16;
+	DdEdge e0{&node_list[i]};
+	DdEdge e1{&node_list[(i + k) % node_num]};
+	auto e2 = DdCompTable::op_tag(k + 1);
+	if ( c % 2 == 0 ) {
+	  table.put(e0, e1, e2, result_of(i, k));
+	}
+	else {
+	  DdEdge result;
+	  if ( table.find(e0, e1, e2, result) ) {
+	    ++ hit_count[t];
+	    if ( result != result_of(i, k) ) {
+	      ++ error_count[t];
+	    }
+	  }
+	}
+      }
+    }});
+  }
+  for ( auto& th: thread_list ) {
+    th.join();
+  }
+  SizeType hit_total = 0;
+  for ( SizeType t = 0; t < thread_num; ++ t ) {
+    EXPECT_EQ( 0, error_count[t] );
+    hit_total += hit_count[t];
+  }
+  EXPECT_LT( 0, hit_total );
+}
+
+END_NAMESPACE_YM_DD
@@ -0,0 +1,75 @@
+
+/// @file DdNodePool_test.cc
+/// @brief DdNodePool_test の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "DdNodePool.h"
+
+
+BEGIN_NAMESPACE_YM_DD
+
+TEST(DdNodePoolTest, empty)
+{
+  DdNodePool pool;
+
+  EXPECT_EQ( 0, pool.page_num() );
+  EXPECT_EQ( 0, pool.used_num() );
+  EXPECT_EQ( 0, pool.free_num() );
+  EXPECT_EQ( 0.0, pool.fragmentation() );
+}
+
+TEST(DdNodePoolTest, alloc)
+{
+  DdNodePool pool;
+
+  auto node = pool.alloc(3, DdEdge::zero(), DdEdge::one());
+  EXPECT_EQ( 3, node->level() );
+  EXPECT_EQ( DdEdge::zero(), node->edge0() );
+  EXPECT_EQ( DdEdge::one(), node->edge1() );
+  EXPECT_EQ( 0, node->ref_count() );
+  EXPECT_EQ( 1, pool.page_num() );
+  EXPECT_EQ( 1, pool.used_num() );
+}
+
+TEST(DdNodePoolTest, free)
+{
+  DdNodePool pool;
+
+  auto node1 = pool.alloc(0, DdEdge::zero(), DdEdge::one());
+  auto node2 = pool.alloc(1, DdEdge::zero(), DdEdge::one());
+  pool.free(node1);
+  EXPECT_EQ( 1, pool.used_num() );
+  EXPECT_EQ( 1, pool.free_num() );
+  EXPECT_EQ( 0.5, pool.fragmentation() );
+
+  // 解放したノードが再利用される．
+  auto node3 = pool.alloc(2, DdEdge::one(), DdEdge::zero());
+  EXPECT_EQ( node1, node3 );
+  EXPECT_EQ( 2, node3->level() );
+  EXPECT_EQ( 2, pool.used_num() );
+  EXPECT_EQ( 0, pool.free_num() );
+  EXPECT_NE( node2, node3 );
+}
+
+TEST(DdNodePoolTest, many_pages)
+{
+  DdNodePool pool;
+
+  SizeType n = DdNodePool::PAGE_SIZE * 2 + 1;
+  std::vector<DdNode*> node_list;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    node_list.push_back(pool.alloc(i, DdEdge::zero(), DdEdge::one()));
+  }
+  EXPECT_EQ( 3, pool.page_num() );
+  EXPECT_EQ( n, pool.used_num() );
+  for ( SizeType i = 0; i < n; ++ i ) {
+    EXPECT_EQ( i, node_list[i]->level() );
+  }
+  EXPECT_EQ( 3 * DdNodePool::PAGE_SIZE * sizeof(DdNode), pool.allocated_size() );
+}
+
+END_NAMESPACE_YM_DD
@@ -0,0 +1,124 @@
+/// @file DdWorkerPool_test.cc
+/// @brief DdWorkerPool_test の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "DdWorkerPool.h"
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+BEGIN_NONAMESPACE
+
+// 完全二分木の葉の数を fork_join() を用いて数える．
+SizeType
+count_leaves(
+  DdWorkerPool& pool,
+  SizeType depth
+)
+{
+  if ( depth == 0 ) {
+    return 1;
+  }
+  if ( !pool.can_spawn() ) {
+    return count_leaves(pool, depth - 1) * 2;
+  }
+  SizeType n0 = 0;
+  SizeType n1 = 0;
+  pool.fork_join([&](){ n0 = count_leaves(pool, depth - 1); },
+		 [&](){ n1 = count_leaves(pool, depth - 1); });
+  return n0 + n1;
+}
+
+// 葉に達したら例外を送出する．
+//
+// 他のスレッドがタスクを盗めるように少し待ってから送出する．
+void
+throw_at_leaves(
+  DdWorkerPool& pool,
+  SizeType depth
+)
+{
+  if ( depth == 0 ) {
+    std::this_thread::sleep_for(std::chrono::microseconds{50});
+    throw std::runtime_error{"leaf"};
+  }
+  if ( !pool.can_spawn() ) {
+    throw_at_leaves(pool, depth - 1);
+    return;
+  }
+  pool.fork_join([&](){ throw_at_leaves(pool, depth - 1); },
+		 [&](){ throw_at_leaves(pool, depth - 1); });
+}
+
+END_NONAMESPACE
+
+TEST(DdWorkerPoolTest, constructor)
+{
+  DdWorkerPool pool{4, 3};
+
+  EXPECT_EQ( 4, pool.thread_num() );
+  EXPECT_EQ( 3, pool.spawn_depth() );
+  EXPECT_FALSE( pool.is_active() );
+  EXPECT_TRUE( pool.can_spawn() );
+}
+
+TEST(DdWorkerPoolTest, default_depth)
+{
+  DdWorkerPool pool{8};
+
+  // log2(8) + 4
+  EXPECT_EQ( 7, pool.spawn_depth() );
+}
+
+TEST(DdWorkerPoolTest, fork_join)
+{
+  DdWorkerPool pool{4, 6};
+
+  pool.begin();
+  EXPECT_TRUE( pool.is_active() );
+  auto n = count_leaves(pool, 16);
+  pool.end();
+  EXPECT_FALSE( pool.is_active() );
+
+  EXPECT_EQ( 1 << 16, n );
+}
+
+TEST(DdWorkerPoolTest, repeat)
+{
+  // 並列実行区間を何度も開始/終了できることを確かめる．
+  DdWorkerPool pool{3, 4};
+
+  for ( SizeType i = 0; i < 100; ++ i ) {
+    pool.begin();
+    auto n = count_leaves(pool, 8);
+    pool.end();
+    EXPECT_EQ( 1 << 8, n );
+  }
+}
+
+TEST(DdWorkerPoolTest, exception)
+{
+  // 盗まれたタスクの中で送出された例外も呼び出し側に伝わることを確かめる．
+  DdWorkerPool pool{4, 6};
+
+  for ( SizeType i = 0; i < 20; ++ i ) {
+    pool.begin();
+    EXPECT_THROW( throw_at_leaves(pool, 6), std::runtime_error );
+    pool.end();
+  }
+
+  // 例外の後でも使えることを確かめる．
+  pool.begin();
+  auto n = count_leaves(pool, 12);
+  pool.end();
+  EXPECT_EQ( 1 << 12, n );
+}
+
+END_NAMESPACE_YM_DD
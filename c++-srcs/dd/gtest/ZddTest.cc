@@ -10,6 +10,9 @@
 #include "ym/ZddMgr.h"
 #include "ym/Zdd.h"
 #include "ym/ZddItem.h"
+#include "ym/ZddSampler.h"
+#include <random>
+#include <cmath>
 
 
 BEGIN_NAMESPACE_YM
@@ -558,4 +561,139 @@ TEST(ZddTest, mgr_copy)
   EXPECT_EQ( mgr1, mgr2 );
 }
 
+BEGIN_NONAMESPACE
+
+// ランダムな集合族を作る．
+Zdd
+random_zdd(
+  ZddMgr& mgr,
+  SizeType ni,
+  SizeType nsets,
+  std::mt19937& rg
+)
+{
+  std::uniform_int_distribution<int> rd{0, 2};
+  auto zdd = mgr.zero();
+  for ( SizeType i = 0; i < nsets; ++ i ) {
+    std::vector<ZddItem> item_list;
+    for ( SizeType j = 0; j < ni; ++ j ) {
+      if ( rd(rg) == 0 ) {
+	item_list.push_back(mgr.item(j));
+      }
+    }
+    zdd |= mgr.make_set(item_list);
+  }
+  return zdd;
+}
+
+// 内容を文字列に変換する．
+std::string
+zdd_str(
+  const Zdd& zdd
+)
+{
+  std::ostringstream buf;
+  zdd.display(buf);
+  return buf.str();
+}
+
+END_NONAMESPACE
+
+TEST(ZddTest, parallel_apply)
+{
+  // 同じ演算を逐次実行したものと並列実行したものを比べる．
+  const SizeType ni = 16;
+  const SizeType nsets = 200;
+  ZddMgr mgr1;
+  ZddMgr mgr2;
+  mgr2.set_thread_num(4);
+  EXPECT_EQ( 1, mgr1.thread_num() );
+  EXPECT_EQ( 4, mgr2.thread_num() );
+
+  std::mt19937 rg1{2};
+  auto zdd11 = random_zdd(mgr1, ni, nsets, rg1);
+  auto zdd12 = random_zdd(mgr1, ni, nsets, rg1);
+  std::mt19937 rg2{2};
+  auto zdd21 = random_zdd(mgr2, ni, nsets, rg2);
+  auto zdd22 = random_zdd(mgr2, ni, nsets, rg2);
+
+  EXPECT_EQ( zdd_str(zdd11 | zdd12), zdd_str(zdd21 | zdd22) );
+  EXPECT_EQ( zdd_str(zdd11 & zdd12), zdd_str(zdd21 & zdd22) );
+  EXPECT_EQ( zdd_str(zdd11 - zdd12), zdd_str(zdd21 - zdd22) );
+  auto prod1 = zdd11 * zdd12;
+  auto prod2 = zdd21 * zdd22;
+  EXPECT_EQ( prod1.count(), prod2.count() );
+  EXPECT_EQ( prod1.size(), prod2.size() );
+  EXPECT_EQ( zdd_str(prod1), zdd_str(prod2) );
+}
+
+TEST(ZddTest, count_wide)
+{
+  // 70 要素の全ての部分集合は 2^70 個ある．
+  const SizeType n = 70;
+  ZddMgr mgr;
+  auto zdd = mgr.one();
+  for ( SizeType i = 0; i < n; ++ i ) {
+    auto item = mgr.item(i);
+    zdd = zdd * (mgr.one() | mgr.make_set({item}));
+  }
+
+  EXPECT_EQ( n, zdd.size() );
+  EXPECT_THROW( zdd.count(), std::overflow_error );
+  EXPECT_EQ( "1180591620717411303424", zdd.count_str() );
+  EXPECT_DOUBLE_EQ( std::ldexp(1.0, n), zdd.count_double() );
+  EXPECT_DOUBLE_EQ( 70.0, zdd.log2_count() );
+
+  auto zero = mgr.zero();
+  EXPECT_EQ( "0", zero.count_str() );
+  EXPECT_EQ( -std::numeric_limits<double>::infinity(), zero.log2_count() );
+  auto one = mgr.one();
+  EXPECT_EQ( "1", one.count_str() );
+  EXPECT_EQ( 0.0, one.log2_count() );
+}
+
+TEST(ZddTest, sampler)
+{
+  // {{a, b}, {c}, {}} から一様に選ぶ．
+  ZddMgr mgr;
+  auto a = mgr.item(0);
+  auto b = mgr.item(1);
+  auto c = mgr.item(2);
+  auto zdd = mgr.make_set({a, b}) | mgr.make_set({c}) | mgr.one();
+  ZddSampler sampler{zdd, {a, b, c}};
+  EXPECT_EQ( 3, sampler.item_num() );
+  EXPECT_EQ( 1, sampler.row_size() );
+
+  std::mt19937 randgen;
+  const SizeType n = 3000;
+  auto rows = sampler.sample_batch(n, randgen);
+  ASSERT_EQ( n, rows.size() );
+  SizeType count[8] = {0};
+  for ( auto row: rows ) {
+    ASSERT_TRUE( row < 8 );
+    ++ count[row];
+  }
+  EXPECT_EQ( n, count[0] + count[3] + count[4] );
+  EXPECT_NEAR( 1000, count[0], 150 );
+  EXPECT_NEAR( 1000, count[3], 150 );
+  EXPECT_NEAR( 1000, count[4], 150 );
+
+  for ( SizeType i = 0; i < 100; ++ i ) {
+    auto item_list = sampler.sample(randgen);
+    if ( item_list.size() == 2 ) {
+      EXPECT_EQ( a, item_list[0] );
+      EXPECT_EQ( b, item_list[1] );
+    }
+    else if ( item_list.size() == 1 ) {
+      EXPECT_EQ( c, item_list[0] );
+    }
+    else {
+      EXPECT_EQ( 0, item_list.size() );
+    }
+  }
+
+  EXPECT_THROW( (ZddSampler{mgr.zero(), {a, b, c}}), std::invalid_argument );
+  EXPECT_THROW( (ZddSampler{zdd, {a, b}}), std::invalid_argument );
+}
+
 END_NAMESPACE_YM
@@ -0,0 +1,136 @@
+
+/// @file chain_test.cc
+/// @brief chain_test の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/Bdd.h"
+#include "ym/BddMgr.h"
+#include "ym/Timer.h"
+#include <iomanip>
+
+
+BEGIN_NAMESPACE_YM
+
+// 変数の数が非常に多い(=BDD が非常に深い)場合の
+// apply 演算と参照回数の処理のストレステスト
+//
+// 使い方: chain_test [変数の数]
+
+BEGIN_NONAMESPACE
+
+// 計測結果を出力する．
+void
+print_result(
+  const char* title,
+  const Bdd& bdd,
+  const BddMgr& mgr,
+  const Timer& timer
+)
+{
+  std::cout << std::left << std::setw(12) << title
+	    << ": size = " << std::setw(8) << bdd.size()
+	    << " node_num = " << std::setw(8) << mgr.node_num()
+	    << " time = " << timer.get_time() << "ms"
+	    << std::endl;
+}
+
+END_NONAMESPACE
+
+int
+chain_test(
+  int argc,
+  char** argv
+)
+{
+  SizeType n = 20000;
+  if ( argc > 1 ) {
+    n = atoi(argv[1]);
+  }
+  if ( n < 2 ) {
+    std::cerr << "n should be greater than 1" << std::endl;
+    return 1;
+  }
+
+  BddMgr mgr;
+  std::vector<Bdd> var_list(n);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    var_list[i] = mgr.variable(i);
+  }
+
+  // 偶数番目と奇数番目の変数の積(和)を下から作る．
+  // ここまでは各演算の再帰は浅い．
+  Timer timer;
+  timer.start();
+  auto even_and = mgr.one();
+  auto odd_and = mgr.one();
+  auto even_xor = mgr.zero();
+  auto odd_xor = mgr.zero();
+  for ( SizeType i = n; i -- > 0; ) {
+    if ( i % 2 == 0 ) {
+      even_and &= var_list[i];
+      even_xor ^= var_list[i];
+    }
+    else {
+      odd_and &= var_list[i];
+      odd_xor ^= var_list[i];
+    }
+  }
+  timer.stop();
+  print_result("build", even_xor, mgr, timer);
+
+  // 以下の演算は再帰の深さが変数の数に比例する．
+  timer.reset();
+  timer.start();
+  auto and_chain = even_and & odd_and;
+  timer.stop();
+  print_result("and_chain", and_chain, mgr, timer);
+
+  timer.reset();
+  timer.start();
+  auto or_chain = ~even_and | ~odd_and;
+  timer.stop();
+  print_result("or_chain", or_chain, mgr, timer);
+
+  timer.reset();
+  timer.start();
+  auto xor_chain = even_xor ^ odd_xor;
+  timer.stop();
+  print_result("xor_chain", xor_chain, mgr, timer);
+
+  timer.reset();
+  timer.start();
+  auto ite_chain = Bdd::ite(even_xor, odd_and, odd_xor);
+  timer.stop();
+  print_result("ite_chain", ite_chain, mgr, timer);
+
+  // 深い BDD をまとめて解放する．
+  timer.reset();
+  timer.start();
+  and_chain = mgr.zero();
+  or_chain = mgr.zero();
+  xor_chain = mgr.zero();
+  ite_chain = mgr.zero();
+  even_and = mgr.zero();
+  odd_and = mgr.zero();
+  even_xor = mgr.zero();
+  odd_xor = mgr.zero();
+  timer.stop();
+  print_result("release", and_chain, mgr, timer);
+
+  return 0;
+}
+
+END_NAMESPACE_YM
+
+
+int
+main(
+  int argc,
+  char** argv
+)
+{
+  return YM_NAMESPACE::chain_test(argc, argv);
+}
@@ -10,6 +10,8 @@
 #include "WeakDivision.h"
 #include "ym/TvFunc.h"
 #include "ym/Tv2Sop.h"
+#include "ym/BddMgr.h"
+#include "ym/Bdd2Sop.h"
 
 
 BEGIN_NAMESPACE_YM_SOP
@@ -18,6 +20,12 @@ BEGIN_NAMESPACE_YM_SOP
 // クラス BoolDivision
 //////////////////////////////////////////////////////////////////////
 
+BEGIN_NONAMESPACE
+
+// 真理値表を用いる最大の変数の数
+// これを超えたら BDD を用いる．
+const SizeType TV_MAX_NI = 16;
+
 inline
 SizeType
 calc_lit(
@@ -29,21 +37,69 @@ calc_lit(
   return q.literal_num() + d.literal_num() + r.literal_num();
 }
 
-// @brief 除算を行う．
-std::pair<SopCover, SopCover>
-BoolDivision::divide(
+// 真理値表を用いて q と r を求める．
+void
+tv_divide(
   const SopCover& f,
-  const SopCover& d
+  const SopCover& d,
+  std::vector<SopCube>& q_list,
+  std::vector<SopCube>& r_list
 )
 {
   auto ni = f.variable_num();
   auto f_func = f.tvfunc();
   auto d_func = d.tvfunc();
   // ~d をドントケアにして q を求める．
-  auto q_list = Tv2Sop::isop(f_func, ~d_func);
+  q_list = Tv2Sop::isop(f_func, ~d_func);
   auto q_func = SopCube::tvfunc(ni, q_list);
   // d & q をドントケアにして r を求める．
-  auto r_list = Tv2Sop::isop(f_func, d_func & q_func);
+  r_list = Tv2Sop::isop(f_func, d_func & q_func);
+}
+
+// BDD を用いて q と r を求める．
+void
+bdd_divide(
+  const SopCover& f,
+  const SopCover& d,
+  std::vector<SopCube>& q_list,
+  std::vector<SopCube>& r_list
+)
+{
+  auto ni = f.variable_num();
+  BddMgr mgr;
+  std::vector<BddVar> var_list;
+  var_list.reserve(ni);
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    var_list.push_back(mgr.variable(i));
+  }
+  auto f_bdd = mgr.from_expr(f.expr(), var_list);
+  auto d_bdd = mgr.from_expr(d.expr(), var_list);
+  // ~d をドントケアにして q を求める．
+  q_list = Bdd2Sop::isop(f_bdd, ~d_bdd, var_list);
+  auto q_bdd = mgr.from_expr(SopCover{ni, q_list}.expr(), var_list);
+  // d & q をドントケアにして r を求める．
+  r_list = Bdd2Sop::isop(f_bdd, d_bdd & q_bdd, var_list);
+}
+
+END_NONAMESPACE
+
+// @brief 除算を行う．
+std::pair<SopCover, SopCover>
+BoolDivision::divide(
+  const SopCover& f,
+  const SopCover& d
+)
+{
+  auto ni = f.variable_num();
+  std::vector<SopCube> q_list;
+  std::vector<SopCube> r_list;
+  if ( ni <= TV_MAX_NI ) {
+    tv_divide(f, d, q_list, r_list);
+  }
+  else {
+    // 真理値表が大きくなりすぎるので BDD を用いる．
+    bdd_divide(f, d, q_list, r_list);
+  }
   auto q = SopCover(ni, q_list);
   auto r = SopCover(ni, r_list);
   // 安全策で WeakDivision の結果も求めておく．
@@ -8,6 +8,7 @@
 
 #include <gtest/gtest.h>
 #include "BoolDivision.h"
+#include "ym/BddMgr.h"
 
 
 BEGIN_NAMESPACE_YM_SOP
@@ -76,4 +77,37 @@ TEST_F(BoolDivisionTest, test2)
   std::cout << std::endl;
 }
 
+TEST_F(BoolDivisionTest, wide)
+{
+  // TvFunc では扱えない変数の数
+  SizeType nv = 40;
+  std::vector<Literal> x;
+  for ( SizeType i = 0; i < nv; ++ i ) {
+    x.push_back(Literal{i, false});
+  }
+  // f = (x0 + x1)(x2 + x3) + x4 x39
+  auto cover1 = SopCover{nv, { {x[0], x[2]},
+			       {x[0], x[3]},
+			       {x[1], x[2]},
+			       {x[1], x[3]},
+			       {x[4], x[39]} }};
+  auto cover2 = SopCover{nv, { {x[2]}, {x[3]} }};
+
+  auto p = BoolDivision::divide(cover1, cover2);
+  auto& q = p.first;
+  auto& r = p.second;
+
+  BddMgr mgr;
+  std::vector<BddVar> var_list;
+  for ( SizeType i = 0; i < nv; ++ i ) {
+    var_list.push_back(mgr.variable(i));
+  }
+  auto f_bdd = mgr.from_expr(cover1.expr(), var_list);
+  auto d_bdd = mgr.from_expr(cover2.expr(), var_list);
+  auto q_bdd = mgr.from_expr(q.expr(), var_list);
+  auto r_bdd = mgr.from_expr(r.expr(), var_list);
+  EXPECT_EQ( f_bdd, (q_bdd & d_bdd) | r_bdd );
+  EXPECT_EQ( 2, q.cube_num() );
+}
+
 END_NAMESPACE_YM_SOP
@@ -0,0 +1,252 @@
+
+/// @file NpnCache.cc
+/// @brief NpnCache の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/NpnCache.h"
+#include "npn/NpnMgr.h"
+#include "npn/NpnTable.h"
+#include <atomic>
+#include <thread>
+
+
+BEGIN_NAMESPACE_YM_LOGIC
+
+//////////////////////////////////////////////////////////////////////
+// クラス NpnCache
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+NpnCache::NpnCache(
+  SizeType max_size
+) : mMaxSize{max_size}
+{
+}
+
+// @brief 正規形を返す．
+TvFunc
+NpnCache::cannonical(
+  const TvFunc& func
+)
+{
+  return find(func).mCfunc;
+}
+
+// @brief 正規化マップを返す．
+NpnMap
+NpnCache::cannonical_map(
+  const TvFunc& func
+)
+{
+  return find(func).mCmap;
+}
+
+// @brief 複数の関数の正規形を返す．
+std::vector<TvFunc>
+NpnCache::cannonical(
+  const std::vector<TvFunc>& func_list,
+  SizeType thread_num
+)
+{
+  auto entry_list = find_list(func_list, thread_num);
+  std::vector<TvFunc> ans_list;
+  ans_list.reserve(entry_list.size());
+  for ( auto& entry: entry_list ) {
+    ans_list.push_back(std::move(entry.mCfunc));
+  }
+  return ans_list;
+}
+
+// @brief 複数の関数の正規化マップを返す．
+std::vector<NpnMap>
+NpnCache::cannonical_map(
+  const std::vector<TvFunc>& func_list,
+  SizeType thread_num
+)
+{
+  auto entry_list = find_list(func_list, thread_num);
+  std::vector<NpnMap> ans_list;
+  ans_list.reserve(entry_list.size());
+  for ( auto& entry: entry_list ) {
+    ans_list.push_back(entry.mCmap);
+  }
+  return ans_list;
+}
+
+// @brief 内容をクリアする．
+void
+NpnCache::clear()
+{
+  mHash.clear();
+  mEntryList.clear();
+  mHitNum = 0;
+  mMissNum = 0;
+}
+
+// @brief 1つの関数の結果を探す．
+const NpnCache::Entry&
+NpnCache::find(
+  const TvFunc& func
+)
+{
+  auto entry = get(func);
+  if ( entry != nullptr ) {
+    ++ mHitNum;
+    return *entry;
+  }
+  ++ mMissNum;
+  return put(calc(func));
+}
+
+// @brief 複数の関数の結果を探す．
+std::vector<NpnCache::Entry>
+NpnCache::find_list(
+  const std::vector<TvFunc>& func_list,
+  SizeType thread_num
+)
+{
+  auto n = func_list.size();
+  std::vector<Entry> ans_list(n);
+
+  // 記録されていない関数を重複なしに集める．
+  // miss_map は関数をキーにして miss_list 中の位置を保持する．
+  std::unordered_map<TvFunc, SizeType> miss_map;
+  std::vector<const TvFunc*> miss_list;
+  // func_list の要素ごとの miss_list 中の位置
+  std::vector<SizeType> pos_list(n, 0);
+  std::vector<bool> hit_list(n, false);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    auto& func = func_list[i];
+    auto entry = get(func);
+    if ( entry != nullptr ) {
+      ++ mHitNum;
+      ans_list[i] = *entry;
+      hit_list[i] = true;
+      continue;
+    }
+    auto p = miss_map.find(func);
+    if ( p != miss_map.end() ) {
+      // 同じ関数が既に現れている．
+      ++ mHitNum;
+      pos_list[i] = p->second;
+    }
+    else {
+      auto pos = miss_list.size();
+      miss_map.emplace(func, pos);
+      miss_list.push_back(&func);
+      pos_list[i] = pos;
+    }
+  }
+
+  // 記録されていない関数の計算を行う．
+  auto nm = miss_list.size();
+  mMissNum += nm;
+  std::vector<Entry> miss_entry_list(nm);
+  if ( thread_num == 0 ) {
+    thread_num = std::thread::hardware_concurrency();
+  }
+  if ( thread_num > nm ) {
+    thread_num = nm;
+  }
+  if ( thread_num <= 1 ) {
+    for ( SizeType j = 0; j < nm; ++ j ) {
+      miss_entry_list[j] = calc(*miss_list[j]);
+    }
+  }
+  else {
+    // 次に処理する関数の番号を共有して
+    // 各スレッドが1つずつ取り出して処理する．
+    std::atomic<SizeType> next{0};
+    auto worker = [&]() {
+      for ( ; ; ) {
+	auto j = next.fetch_add(1);
+	if ( j >= nm ) {
+	  break;
+	}
+	miss_entry_list[j] = calc(*miss_list[j]);
+      }
+    };
+    std::vector<std::thread> thread_list;
+    thread_list.reserve(thread_num - 1);
+    for ( SizeType t = 1; t < thread_num; ++ t ) {
+      thread_list.emplace_back(worker);
+    }
+    // 呼び出し側のスレッドも処理に加わる．
+    worker();
+    for ( auto& th: thread_list ) {
+      th.join();
+    }
+  }
+
+  for ( SizeType i = 0; i < n; ++ i ) {
+    if ( !hit_list[i] ) {
+      ans_list[i] = miss_entry_list[pos_list[i]];
+    }
+  }
+  for ( auto& entry: miss_entry_list ) {
+    put(std::move(entry));
+  }
+  return ans_list;
+}
+
+// @brief 計算結果を登録する．
+const NpnCache::Entry&
+NpnCache::put(
+  Entry&& entry
+)
+{
+  if ( mMaxSize > 0 ) {
+    while ( mHash.size() >= mMaxSize ) {
+      // 最も古い記録を捨てる．
+      auto& last = mEntryList.back();
+      mHash.erase(last.mFunc);
+      mEntryList.pop_back();
+    }
+  }
+  mEntryList.push_front(std::move(entry));
+  auto p = mEntryList.begin();
+  mHash.emplace(p->mFunc, p);
+  return *p;
+}
+
+// @brief 記録を探す．
+const NpnCache::Entry*
+NpnCache::get(
+  const TvFunc& func
+)
+{
+  auto p = mHash.find(func);
+  if ( p == mHash.end() ) {
+    return nullptr;
+  }
+  auto q = p->second;
+  if ( q != mEntryList.begin() ) {
+    // 先頭に移動する．
+    mEntryList.splice(mEntryList.begin(), mEntryList, q);
+  }
+  return &(*q);
+}
+
+// @brief 1つの関数の正規形を計算する．
+NpnCache::Entry
+NpnCache::calc(
+  const TvFunc& func
+)
+{
+  if ( NpnTable::is_supported(func) ) {
+    return Entry{func,
+		 NpnTable::cannonical(func),
+		 NpnTable::cannonical_map(func)};
+  }
+  NpnMgr mgr;
+  auto cfunc = mgr.cannonical(func);
+  std::vector<NpnMap> cmap_list;
+  mgr.all_cmap(cmap_list);
+  ASSERT_COND( !cmap_list.empty() );
+  return Entry{func, cfunc, cmap_list.front()};
+}
+
+END_NAMESPACE_YM_LOGIC
@@ -98,6 +98,12 @@ NpnMgr::cannonical(
 {
   mMaxList.clear();
   mTvmax_count = 0;
+  mNormalizeTime = 0;
+  mRefineTime = 0;
+  mTvmaxTime = 0;
+  if ( mProfile ) {
+    mLapTime = std::chrono::steady_clock::now();
+  }
 
   // まず独立な変数を取り除く
   mXmap0 = func.shrink_map();
@@ -168,6 +174,7 @@ NpnMgr::cannonical(
     auto map = igpart.to_npnmap();
     add_map(map);
     auto func2 = func1.xform(map);
+    lap(mNormalizeTime);
     if ( debug ) {
       std::cout << "  resolved" << std::endl;
       if ( ni0 < 10 ) {
@@ -178,6 +185,8 @@ NpnMgr::cannonical(
     return func2;
   }
 
+  lap(mNormalizeTime);
+
   // 入力の等価グループは iinfo に入っている．
   // 以降は等価グループごとに極性と順序を考えればよい．
   // 極性に関しては
@@ -237,6 +246,8 @@ NpnMgr::cannonical(
 	      << std::endl;
   }
 
+  lap(mRefineTime);
+
   // 残りはすべて展開して真理値ベクタが最大となるものを探す．
   mMaxFunc = TvFunc::zero(ni0);
   mMaxList.clear();
@@ -267,6 +278,7 @@ NpnMgr::cannonical(
     std::vector<bool> w1_mark(ni0, false);
     tvmax_recur(func2, igpart1, w1_mark);
   }
+  lap(mTvmaxTime);
 
   if ( debug ) {
     if ( ni0 < 10 ) {
@@ -389,6 +401,19 @@ NpnMgr::tvmax_count() const
   return mTvmax_count;
 }
 
+// @brief 時間計測の区切りをつける．
+void
+NpnMgr::lap(
+  std::uint64_t& time
+)
+{
+  if ( mProfile ) {
+    auto now = std::chrono::steady_clock::now();
+    time += std::chrono::duration_cast<std::chrono::nanoseconds>(now - mLapTime).count();
+    mLapTime = now;
+  }
+}
+
 void
 NpnMgr::add_map(
   const NpnMap& map
@@ -0,0 +1,125 @@
+
+/// @file NpnSignature.cc
+/// @brief NpnSignature の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/NpnSignature.h"
+#include <algorithm>
+
+
+BEGIN_NAMESPACE_YM_LOGIC
+
+//////////////////////////////////////////////////////////////////////
+// クラス NpnSignature
+//////////////////////////////////////////////////////////////////////
+
+// @brief 関数を指定したコンストラクタ
+NpnSignature::NpnSignature(
+  const TvFunc& func
+)
+{
+  if ( func.is_invalid() ) {
+    return;
+  }
+
+  auto ni = func.input_num();
+  std::vector<int> w1(ni);
+  std::vector<int> w2(ni * ni, 0);
+  int w0 = func.walsh_012(w1.data(), w2.data());
+
+  // 0次の係数が非負になるように出力の極性を決める．
+  bool oinv = w0 < 0;
+  if ( oinv ) {
+    w0 = -w0;
+    for ( auto& w: w1 ) {
+      w = -w;
+    }
+  }
+
+  // サポート変数を求める．
+  std::vector<SizeType> sup_list;
+  std::vector<SizeType> dummy_list;
+  for ( SizeType var = 0; var < ni; ++ var ) {
+    if ( func.check_sup(var) ) {
+      sup_list.push_back(var);
+    }
+    else {
+      dummy_list.push_back(var);
+    }
+  }
+  auto ns = sup_list.size();
+
+  // サポート変数ごとのキーを作る．
+  std::vector<std::vector<int>> key_array(ni);
+  for ( auto var: sup_list ) {
+    auto& key = key_array[var];
+    key.reserve(ns);
+    key.push_back(std::abs(w1[var]));
+    std::vector<int> tmp;
+    tmp.reserve(ns - 1);
+    for ( auto var2: sup_list ) {
+      if ( var2 != var ) {
+	tmp.push_back(std::abs(w2[var * ni + var2]));
+      }
+    }
+    std::sort(tmp.begin(), tmp.end(), std::greater<int>());
+    key.insert(key.end(), tmp.begin(), tmp.end());
+  }
+
+  // キーの降順に並べる．
+  // 同じキーの場合は元の順番を保つ．
+  std::stable_sort(sup_list.begin(), sup_list.end(),
+		   [&](SizeType a, SizeType b) {
+		     return key_array[a] > key_array[b];
+		   });
+
+  // 極性と変数順が一意に決まるか調べる．
+  mUnique = w0 != 0;
+  for ( SizeType k = 0; k < ns && mUnique; ++ k ) {
+    auto var = sup_list[k];
+    if ( w1[var] == 0 ) {
+      mUnique = false;
+    }
+    else if ( k > 0 && key_array[var] == key_array[sup_list[k - 1]] ) {
+      mUnique = false;
+    }
+  }
+
+  mData.reserve(3 + ns * ns);
+  mData.push_back(ni);
+  mData.push_back(ns);
+  mData.push_back(w0);
+  for ( auto var: sup_list ) {
+    auto& key = key_array[var];
+    mData.insert(mData.end(), key.begin(), key.end());
+  }
+
+  // 準正規形への変換マップを作る．
+  mXmap.resize(ni);
+  SizeType pos = 0;
+  for ( auto var: sup_list ) {
+    mXmap.set_imap(var, pos, w1[var] < 0);
+    ++ pos;
+  }
+  for ( auto var: dummy_list ) {
+    mXmap.set_imap(var, pos, false);
+    ++ pos;
+  }
+  mXmap.set_oinv(oinv);
+}
+
+// @brief ハッシュ値を返す．
+SizeType
+NpnSignature::hash() const
+{
+  SizeType ans = 0;
+  for ( auto v: mData ) {
+    ans = ans * 1048583 + v;
+  }
+  return ans;
+}
+
+END_NAMESPACE_YM_LOGIC
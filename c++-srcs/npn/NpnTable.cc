@@ -0,0 +1,259 @@
+
+/// @file NpnTable.cc
+/// @brief NpnTable の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "npn/NpnTable.h"
+#include "npn/NpnMgr.h"
+#include <algorithm>
+
+
+BEGIN_NAMESPACE_YM_LOGIC
+
+BEGIN_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// 表の要素のエンコーディング
+//
+// 64ビットの符号なし整数に以下の情報を詰め込む．
+// - [0:15]  正規形の真理値表
+// - [16:18] 正規形の入力数
+// - [19]    出力の反転属性
+// - [20 + i * 4 : 20 + i * 4 + 2] i 番目の入力の変換先(7 で削除)
+// - [20 + i * 4 + 3]              i 番目の入力の反転属性
+//////////////////////////////////////////////////////////////////////
+
+using CodeType = std::uint64_t;
+
+const SizeType NI_SHIFT = 16;
+const SizeType OINV_SHIFT = 19;
+const SizeType IMAP_SHIFT = 20;
+const CodeType BAD_VAR = 7;
+
+// まだ値が設定されていないことを表す値
+const CodeType NO_CODE = ~0ULL;
+
+// 関数の真理値表を取り出す．
+inline
+SizeType
+func_bits(
+  const TvFunc& func
+)
+{
+  return static_cast<SizeType>(func.raw_data(0));
+}
+
+// 正規形と正規化マップを符号化する．
+CodeType
+encode(
+  const TvFunc& cfunc,
+  const NpnMap& cmap
+)
+{
+  CodeType code = func_bits(cfunc);
+  code |= static_cast<CodeType>(cfunc.input_num()) << NI_SHIFT;
+  if ( cmap.oinv() ) {
+    code |= 1ULL << OINV_SHIFT;
+  }
+  for ( SizeType i = 0; i < cmap.input_num(); ++ i ) {
+    auto imap = cmap.imap(i);
+    CodeType vcode = BAD_VAR;
+    if ( !imap.is_invalid() ) {
+      vcode = imap.var();
+      if ( imap.inv() ) {
+	vcode |= 8;
+      }
+    }
+    code |= vcode << (IMAP_SHIFT + i * 4);
+  }
+  return code;
+}
+
+// 正規形の入力数を取り出す．
+inline
+SizeType
+decode_ni(
+  CodeType code
+)
+{
+  return (code >> NI_SHIFT) & 7;
+}
+
+// 正規形を取り出す．
+TvFunc
+decode_func(
+  CodeType code
+)
+{
+  auto ni = decode_ni(code);
+  std::vector<TvFunc::WordType> data{code & 0xFFFFULL};
+  return TvFunc::from_raw_data(ni, std::move(data));
+}
+
+// 正規化マップを取り出す．
+NpnMap
+decode_map(
+  SizeType ni,
+  CodeType code
+)
+{
+  NpnMap cmap(ni, decode_ni(code));
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    auto vcode = (code >> (IMAP_SHIFT + i * 4)) & 15;
+    auto var = vcode & 7;
+    if ( var == BAD_VAR ) {
+      cmap.set_imap(i, NpnVmap::invalid());
+    }
+    else {
+      cmap.set_imap(i, var, (vcode & 8) != 0);
+    }
+  }
+  cmap.set_oinv(((code >> OINV_SHIFT) & 1) != 0);
+  return cmap;
+}
+
+// xmap と cmap の合成を求める．
+//
+// NpnMap::operator*() と異なり，cmap で削除される入力は
+// 削除されるものとして扱う．
+NpnMap
+compose(
+  const NpnMap& xmap,
+  const NpnMap& cmap
+)
+{
+  auto ni = xmap.input_num();
+  NpnMap ans(ni, cmap.input_num2());
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    auto imap1 = xmap.imap(i);
+    auto imap2 = cmap.imap(imap1.var());
+    if ( imap2.is_invalid() ) {
+      ans.set_imap(i, NpnVmap::invalid());
+    }
+    else {
+      ans.set_imap(i, imap2.var(), imap1.inv() ^ imap2.inv());
+    }
+  }
+  ans.set_oinv(xmap.oinv() ^ cmap.oinv());
+  return ans;
+}
+
+// ni 入力の全てのNPN変換のリストを作る．
+std::vector<NpnMap>
+all_xmap(
+  SizeType ni
+)
+{
+  std::vector<NpnMap> map_list;
+  std::vector<SizeType> perm(ni);
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    perm[i] = i;
+  }
+  do {
+    for ( SizeType pol = 0; pol < (1U << ni); ++ pol ) {
+      for ( bool oinv: {false, true} ) {
+	NpnMap xmap(ni);
+	for ( SizeType i = 0; i < ni; ++ i ) {
+	  xmap.set_imap(i, perm[i], ((pol >> i) & 1) != 0);
+	}
+	xmap.set_oinv(oinv);
+	map_list.push_back(xmap);
+      }
+    }
+  } while ( std::next_permutation(perm.begin(), perm.end()) );
+  return map_list;
+}
+
+// ni 入力の全ての関数の表を作る．
+std::vector<CodeType>
+make_table(
+  SizeType ni
+)
+{
+  SizeType nf = 1UL << (1UL << ni);
+  std::vector<CodeType> table(nf, NO_CODE);
+  auto xmap_list = all_xmap(ni);
+  for ( SizeType f = 0; f < nf; ++ f ) {
+    if ( table[f] != NO_CODE ) {
+      continue;
+    }
+    // f をこの同値類の代表関数とする．
+    std::vector<TvFunc::WordType> data{f};
+    auto func = TvFunc::from_raw_data(ni, std::move(data));
+    NpnMgr mgr;
+    auto cfunc = mgr.cannonical(func);
+    std::vector<NpnMap> cmap_list;
+    mgr.all_cmap(cmap_list);
+    ASSERT_COND( !cmap_list.empty() );
+    auto& cmap = cmap_list.front();
+    table[f] = encode(cfunc, cmap);
+
+    // g = func.xform(xmap) ならば g.xform(~xmap * cmap) = cfunc となる．
+    for ( auto& xmap: xmap_list ) {
+      auto g = func.xform(xmap);
+      auto& code = table[func_bits(g)];
+      if ( code == NO_CODE ) {
+	code = encode(cfunc, compose(xmap.inverse(), cmap));
+      }
+    }
+  }
+  return table;
+}
+
+// 入力数ごとの表を返す．
+const std::vector<CodeType>&
+get_table(
+  SizeType ni
+)
+{
+  static std::vector<std::vector<CodeType>> table_list = []() {
+    std::vector<std::vector<CodeType>> table_list;
+    for ( SizeType ni = 0; ni <= NpnTable::MAX_NI; ++ ni ) {
+      table_list.push_back(make_table(ni));
+    }
+    return table_list;
+  }();
+  return table_list[ni];
+}
+
+// 関数の表の要素を返す．
+CodeType
+get_code(
+  const TvFunc& func
+)
+{
+  if ( !NpnTable::is_supported(func) ) {
+    throw std::invalid_argument{"NpnTable: input_num() is too large"};
+  }
+  return get_table(func.input_num())[func_bits(func)];
+}
+
+END_NONAMESPACE
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス NpnTable
+//////////////////////////////////////////////////////////////////////
+
+// @brief 正規形を返す．
+TvFunc
+NpnTable::cannonical(
+  const TvFunc& func
+)
+{
+  return decode_func(get_code(func));
+}
+
+// @brief 正規化マップを返す．
+NpnMap
+NpnTable::cannonical_map(
+  const TvFunc& func
+)
+{
+  return decode_map(func.input_num(), get_code(func));
+}
+
+END_NAMESPACE_YM_LOGIC
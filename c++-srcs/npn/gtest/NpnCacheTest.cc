@@ -0,0 +1,117 @@
+
+/// @file NpnCacheTest.cc
+/// @brief NpnCache のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "ym/NpnCache.h"
+#include "ym/TvFunc.h"
+#include <random>
+
+
+BEGIN_NAMESPACE_YM_LOGIC
+
+class NpnCacheTest :
+  public ::testing::Test
+{
+public:
+
+  /// @brief ランダムな関数を作る．
+  TvFunc
+  random_func(
+    SizeType ni
+  )
+  {
+    std::uniform_int_distribution<int> rd(0, 1);
+    SizeType np = 1 << ni;
+    std::vector<int> values(np);
+    for ( SizeType p = 0; p < np; ++ p ) {
+      values[p] = rd(mRandGen);
+    }
+    return TvFunc{ni, values};
+  }
+
+  // 乱数生成器
+  std::mt19937 mRandGen;
+
+};
+
+TEST_F(NpnCacheTest, single)
+{
+  NpnCache cache;
+  for ( SizeType i = 0; i < 20; ++ i ) {
+    auto func = random_func(5);
+    auto cmap = cache.cannonical_map(func);
+    EXPECT_EQ( func.npn_cannonical_map(), cmap );
+    EXPECT_EQ( func.xform(cmap), cache.cannonical(func) );
+  }
+  EXPECT_EQ( 20, cache.miss_num() );
+  EXPECT_EQ( 20, cache.hit_num() );
+  EXPECT_EQ( 20, cache.size() );
+}
+
+TEST_F(NpnCacheTest, batch)
+{
+  // 重複を含むリストを作る．
+  std::vector<TvFunc> base_list;
+  for ( SizeType i = 0; i < 30; ++ i ) {
+    base_list.push_back(random_func(6));
+  }
+  std::vector<TvFunc> func_list;
+  std::uniform_int_distribution<SizeType> rd(0, base_list.size() - 1);
+  for ( SizeType i = 0; i < 200; ++ i ) {
+    func_list.push_back(base_list[rd(mRandGen)]);
+  }
+
+  NpnCache cache;
+  auto cmap_list = cache.cannonical_map(func_list, 4);
+  ASSERT_EQ( func_list.size(), cmap_list.size() );
+  for ( SizeType i = 0; i < func_list.size(); ++ i ) {
+    EXPECT_EQ( func_list[i].npn_cannonical_map(), cmap_list[i] );
+  }
+  EXPECT_EQ( cache.size(), cache.miss_num() );
+  EXPECT_EQ( func_list.size(), cache.hit_num() + cache.miss_num() );
+
+  // 2回目は全て記録されている．
+  auto miss_num = cache.miss_num();
+  auto cfunc_list = cache.cannonical(func_list, 4);
+  EXPECT_EQ( miss_num, cache.miss_num() );
+  for ( SizeType i = 0; i < func_list.size(); ++ i ) {
+    EXPECT_EQ( func_list[i].xform(cmap_list[i]), cfunc_list[i] );
+  }
+}
+
+TEST_F(NpnCacheTest, max_size)
+{
+  std::vector<TvFunc> func_list;
+  for ( SizeType i = 0; i < 10; ++ i ) {
+    func_list.push_back(random_func(4));
+  }
+
+  NpnCache cache{4};
+  EXPECT_EQ( 4, cache.max_size() );
+  auto cmap_list = cache.cannonical_map(func_list, 2);
+  EXPECT_EQ( 4, cache.size() );
+  for ( SizeType i = 0; i < func_list.size(); ++ i ) {
+    EXPECT_EQ( func_list[i].npn_cannonical_map(), cmap_list[i] );
+  }
+
+  // 最後の4つが残っている．
+  auto miss_num = cache.miss_num();
+  for ( SizeType i = 6; i < 10; ++ i ) {
+    cache.cannonical_map(func_list[i]);
+  }
+  EXPECT_EQ( miss_num, cache.miss_num() );
+  cache.cannonical_map(func_list[0]);
+  EXPECT_EQ( miss_num + 1, cache.miss_num() );
+  EXPECT_EQ( 4, cache.size() );
+
+  cache.clear();
+  EXPECT_EQ( 0, cache.size() );
+  EXPECT_EQ( 0, cache.miss_num() );
+}
+
+END_NAMESPACE_YM_LOGIC
@@ -0,0 +1,137 @@
+
+/// @file NpnSignatureTest.cc
+/// @brief NpnSignature のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "ym/NpnSignature.h"
+#include "ym/TvFunc.h"
+#include <random>
+
+
+BEGIN_NAMESPACE_YM_LOGIC
+
+class NpnSignatureTest :
+  public ::testing::Test
+{
+public:
+
+  /// @brief ランダムな関数を作る．
+  TvFunc
+  random_func(
+    SizeType ni
+  )
+  {
+    std::uniform_int_distribution<int> rd(0, 1);
+    SizeType np = 1 << ni;
+    std::vector<int> values(np);
+    for ( SizeType p = 0; p < np; ++ p ) {
+      values[p] = rd(mRandGen);
+    }
+    return TvFunc{ni, values};
+  }
+
+  /// @brief ランダムなNPN変換を作る．
+  NpnMap
+  random_map(
+    SizeType ni
+  )
+  {
+    std::vector<SizeType> perm(ni);
+    for ( SizeType i = 0; i < ni; ++ i ) {
+      perm[i] = i;
+    }
+    std::shuffle(perm.begin(), perm.end(), mRandGen);
+    std::uniform_int_distribution<int> rd(0, 1);
+    NpnMap xmap(ni);
+    for ( SizeType i = 0; i < ni; ++ i ) {
+      xmap.set_imap(i, perm[i], rd(mRandGen) == 1);
+    }
+    xmap.set_oinv(rd(mRandGen) == 1);
+    return xmap;
+  }
+
+  // 乱数生成器
+  std::mt19937 mRandGen;
+
+};
+
+TEST_F(NpnSignatureTest, invalid)
+{
+  NpnSignature sig;
+  EXPECT_FALSE( sig.is_valid() );
+  EXPECT_EQ( NpnSignature{TvFunc::invalid()}, sig );
+}
+
+TEST_F(NpnSignatureTest, simple)
+{
+  auto x0 = TvFunc::posi_literal(3, 0);
+  auto x1 = TvFunc::posi_literal(3, 1);
+  auto x2 = TvFunc::posi_literal(3, 2);
+
+  NpnSignature sig_and{x0 & x1};
+  NpnSignature sig_or{x0 | x2};
+  NpnSignature sig_xor{x1 ^ x2};
+  EXPECT_EQ( 3, sig_and.input_num() );
+  EXPECT_EQ( 2, sig_and.support_num() );
+  EXPECT_EQ( 4, sig_and.walsh_0() );
+  // AND と OR は NPN同値
+  EXPECT_EQ( sig_and, sig_or );
+  EXPECT_NE( sig_and, sig_xor );
+
+  // 準正規形では独立な変数が後ろに来る．
+  auto f = x1 ^ x2;
+  auto g = sig_xor.semi_cannonical(f);
+  EXPECT_TRUE( g.check_sup(0) );
+  EXPECT_TRUE( g.check_sup(1) );
+  EXPECT_FALSE( g.check_sup(2) );
+}
+
+TEST_F(NpnSignatureTest, invariance)
+{
+  for ( SizeType ni: {4, 6, 9} ) {
+    for ( SizeType i = 0; i < 50; ++ i ) {
+      auto f = random_func(ni);
+      NpnSignature sig_f{f};
+      auto f_rep = sig_f.semi_cannonical(f);
+      EXPECT_EQ( f.xform(sig_f.semi_cannonical_map()), f_rep );
+      EXPECT_EQ( sig_f, NpnSignature{f_rep} );
+
+      for ( SizeType j = 0; j < 10; ++ j ) {
+	auto xmap = random_map(ni);
+	auto g = f.xform(xmap);
+	NpnSignature sig_g{g};
+	EXPECT_EQ( sig_f, sig_g );
+	EXPECT_EQ( sig_f.hash(), sig_g.hash() );
+      }
+    }
+  }
+}
+
+TEST_F(NpnSignatureTest, unique_rep)
+{
+  SizeType ni = 8;
+  SizeType n = 0;
+  for ( SizeType i = 0; i < 50; ++ i ) {
+    auto f = random_func(ni);
+    NpnSignature sig_f{f};
+    if ( !sig_f.is_unique() ) {
+      continue;
+    }
+    ++ n;
+    // この場合は NPN同値な関数の準正規形は一致する．
+    auto f_rep = sig_f.semi_cannonical(f);
+    for ( SizeType j = 0; j < 10; ++ j ) {
+      auto g = f.xform(random_map(ni));
+      NpnSignature sig_g{g};
+      EXPECT_TRUE( sig_g.is_unique() );
+      EXPECT_EQ( f_rep, sig_g.semi_cannonical(g) );
+    }
+  }
+  EXPECT_LT( 0, n );
+}
+
+END_NAMESPACE_YM_LOGIC
@@ -0,0 +1,51 @@
+
+/// @file NpnTableTest.cc
+/// @brief NpnTable のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "npn/NpnTable.h"
+#include "npn/NpnMgr.h"
+#include "ym/TvFunc.h"
+
+
+BEGIN_NAMESPACE_YM_LOGIC
+
+class NpnTableTest :
+  public ::testing::TestWithParam<SizeType>
+{
+};
+
+TEST_P(NpnTableTest, all_func)
+{
+  SizeType ni = GetParam();
+  SizeType nf = 1UL << (1UL << ni);
+  for ( SizeType f = 0; f < nf; ++ f ) {
+    std::vector<TvFunc::WordType> data{f};
+    auto func = TvFunc::from_raw_data(ni, std::move(data));
+    ASSERT_TRUE( NpnTable::is_supported(func) );
+
+    NpnMgr mgr;
+    auto cfunc0 = mgr.cannonical(func);
+    auto cfunc = NpnTable::cannonical(func);
+    EXPECT_EQ( cfunc0, cfunc ) << func;
+
+    auto cmap = NpnTable::cannonical_map(func);
+    EXPECT_EQ( cfunc, func.xform(cmap) ) << func;
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(NpnTable, NpnTableTest,
+			 ::testing::Range<SizeType>(0, NpnTable::MAX_NI + 1));
+
+TEST(NpnTableTest, not_supported)
+{
+  auto func = TvFunc::posi_literal(NpnTable::MAX_NI + 1, 0);
+  EXPECT_FALSE( NpnTable::is_supported(func) );
+  EXPECT_THROW( NpnTable::cannonical(func), std::invalid_argument );
+}
+
+END_NAMESPACE_YM_LOGIC
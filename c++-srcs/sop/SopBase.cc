@@ -7,6 +7,7 @@
 /// All rights reserved.
 
 #include "ym/SopBase.h"
+#include "SopKernel.h"
 
 
 BEGIN_NAMESPACE_YM_SOP
@@ -15,25 +16,6 @@ BEGIN_NAMESPACE_YM_SOP
 // クラス SopBase
 //////////////////////////////////////////////////////////////////////
 
-BEGIN_NONAMESPACE
-
-// 表引きを使ってリテラル数の計算を行う．
-inline
-int
-_count(
-  SopPatWord pat
-)
-{
-  static const int table[] = {
-    // utils/gen_litcount_tbl.py で生成
-#include "sop/litcount_tbl.h"
-  };
-
-  return table[pat];
-}
-
-END_NONAMESPACE
-
 // @brief ビットベクタ上のリテラル数を数える．
 SizeType
 SopBase::_literal_num(
@@ -41,30 +23,7 @@ SopBase::_literal_num(
   const Chunk& chunk
 ) const
 {
-  // 8 ビットごとに区切って表引きで計算する．
-  SizeType ans = 0;
-  auto begin = _cube(chunk);
-  auto end = _cube(chunk, cube_num);
-  for ( auto p = begin; p != end; ++ p ) {
-    auto pat = *p;
-    auto p1 = pat & 0xFFUL;
-    ans += _count(p1);
-    auto p2 = (pat >> 8) & 0xFFUL;
-    ans += _count(p2);
-    auto p3 = (pat >> 16) & 0xFFUL;
-    ans += _count(p3);
-    auto p4 = (pat >> 24) & 0xFFUL;
-    ans += _count(p4);
-    auto p5 = (pat >> 32) & 0xFFUL;
-    ans += _count(p5);
-    auto p6 = (pat >> 40) & 0xFFUL;
-    ans += _count(p6);
-    auto p7 = (pat >> 48) & 0xFFUL;
-    ans += _count(p7);
-    auto p8 = (pat >> 56);
-    ans += _count(p8);
-  }
-  return ans;
+  return SopKernel::literal_num(chunk.data(), _cube_size() * cube_num);
 }
 
 // @brief キューブのリテラル数を返す．
@@ -73,26 +32,11 @@ SopBase::_cube_literal_num(
   Cube src_cube
 ) const
 {
+  // ワード数が少ないので1ワードずつ数える．
   SizeType ans = 0;
   auto end = _cube_end(src_cube);
   for ( auto p = src_cube; p != end; ++ p ) {
-    auto pat = *p;
-    auto p1 = pat & 0xFFUL;
-    ans += _count(p1);
-    auto p2 = (pat >> 8) & 0xFFUL;
-    ans += _count(p2);
-    auto p3 = (pat >> 16) & 0xFFUL;
-    ans += _count(p3);
-    auto p4 = (pat >> 24) & 0xFFUL;
-    ans += _count(p4);
-    auto p5 = (pat >> 32) & 0xFFUL;
-    ans += _count(p5);
-    auto p6 = (pat >> 40) & 0xFFUL;
-    ans += _count(p6);
-    auto p7 = (pat >> 48) & 0xFFUL;
-    ans += _count(p7);
-    auto p8 = (pat >> 56);
-    ans += _count(p8);
+    ans += SopKernel::literal_num(*p);
   }
   return ans;
 }
@@ -0,0 +1,152 @@
+#ifndef SOPCOMPLEMENT_H
+#define SOPCOMPLEMENT_H
+
+/// @file SopComplement.h
+/// @brief SopComplement のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "SopUrp.h"
+#include "SopSorter.h"
+
+
+BEGIN_NAMESPACE_YM_SOP
+
+//////////////////////////////////////////////////////////////////////
+/// @class SopComplement SopComplement.h "SopComplement.h"
+/// @brief SopCover の否定を求めるためのクラス
+///
+/// unate recursive paradigm に基づいて否定を計算する．
+/// - 共通キューブをくくりだす．
+/// - 最も binate な変数で Shannon 展開して再帰する．
+/// - unate な変数で展開した場合には片側のリテラルを省略する．
+///
+/// 作業領域は再帰の深さごとに確保して使い回すので，
+/// 再帰呼び出しごとのメモリ確保は(領域が足りない場合を除いて)行わない．
+//////////////////////////////////////////////////////////////////////
+class SopComplement :
+  public SopUrp
+{
+public:
+
+  /// @brief コンストラクタ
+  SopComplement(
+    SizeType var_num ///< [in] 変数の数
+  ) : SopUrp{var_num},
+      mFrameList(var_num + 1),
+      mSorter{var_num}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~SopComplement() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 否定を求める．
+  /// @return 結果のキューブ数を返す．
+  SizeType
+  complement(
+    SizeType cube_num,  ///< [in] キューブ数
+    const Chunk& chunk, ///< [in] 対象のビットベクタ
+    Chunk& dst_chunk    ///< [out] 結果を格納するビットベクタ
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  // 再帰の深さごとの作業領域
+  struct Frame
+  {
+    // 共通キューブ
+    Chunk mCc;
+
+    // コファクター
+    Chunk mCof;
+
+    // 負のコファクターの否定
+    Chunk mRes0;
+
+    // 正のコファクターの否定
+    Chunk mRes1;
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 否定を求める再帰関数
+  /// @return 結果のキューブ数を返す．
+  ///
+  /// src の内容は破壊される．
+  SizeType
+  _compl_recur(
+    SizeType depth,    ///< [in] 再帰の深さ
+    SizeType cube_num, ///< [in] キューブ数
+    Chunk& src,        ///< [in] 対象のビットベクタ
+    Chunk& dst         ///< [out] 結果を格納するビットベクタ
+  );
+
+  /// @brief 共通キューブを求める．
+  /// @return 共通キューブが空でなければ true を返す．
+  bool
+  _common_cube(
+    SizeType cube_num, ///< [in] キューブ数
+    const Chunk& src,  ///< [in] 対象のビットベクタ
+    Chunk& cc          ///< [out] 結果を格納するビットベクタ
+  );
+
+  /// @brief Shannon 展開の結果をマージする．
+  /// @return 結果のキューブ数を返す．
+  ///
+  /// res0 と res1 はソートされる．
+  SizeType
+  _merge(
+    SizeType var,   ///< [in] 展開に用いた変数
+    SopPat upat,    ///< [in] var の極性 (_select_var() 参照)
+    SizeType num0,  ///< [in] res0 のキューブ数
+    Chunk& res0,    ///< [in] 負のコファクターの否定
+    SizeType num1,  ///< [in] res1 のキューブ数
+    Chunk& res1,    ///< [in] 正のコファクターの否定
+    Chunk& dst      ///< [out] 結果を格納するビットベクタ
+  );
+
+  /// @brief キューブの否定を dst の pos 番目以降に書き込む．
+  /// @return 書き込んだキューブ数を返す．
+  SizeType
+  _cube_complement(
+    Cube cube,    ///< [in] 対象のキューブ
+    Chunk& dst,   ///< [out] 結果を格納するビットベクタ
+    SizeType pos  ///< [in] 書き込み開始位置
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 再帰の深さごとの作業領域
+  // 展開のたびに変数が1つずつ減るので深さは変数の数で抑えられる．
+  std::vector<Frame> mFrameList;
+
+  // ソート用のオブジェクト
+  SopSorter mSorter;
+
+};
+
+END_NAMESPACE_YM_SOP
+
+#endif // SOPCOMPLEMENT_H
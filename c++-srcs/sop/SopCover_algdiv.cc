@@ -8,6 +8,7 @@
 
 #include "ym/SopCover.h"
 #include "ym/SopCube.h"
+#include "SopKernel.h"
 
 
 BEGIN_NAMESPACE_YM_SOP
@@ -175,16 +176,8 @@ SopCover::_algdiv(
 {
   auto num1 = cube_num();
   auto dst_chunk = _new_chunk(num1);
-  auto dst_list = _cube_list(dst_chunk);
-  auto cube1_list = _cube_list(chunk(), 0, num1);
-  auto cube2 = _cube(chunk2);
-  for ( auto cube1: cube1_list ) {
-    auto dst_cube = dst_list.back();
-    if ( _cube_algdiv(dst_cube, cube1, cube2) ) {
-      dst_list.inc();
-    }
-  }
-  dst_num = dst_list.num();
+  dst_num = SopKernel::algdiv(dst_chunk.data(), chunk().data(), num1,
+			      _cube_size(), chunk2.data());
   return dst_chunk;
 }
 
@@ -195,25 +188,13 @@ SopCover::_algdiv(
   SizeType& dst_num
 ) const
 {
-  auto varid = lit.varid();
-  auto inv = lit.is_negative();
-  auto blk = _block_pos(varid);
-  auto sft = _shift_num(varid);
-  auto pat1 = _get_mask(varid, inv);
-  auto mask = 3UL << sft;
-  auto nmask = ~mask;
-
+  // リテラルを1つのキューブとして一括して割る．
+  auto lit_chunk = _new_chunk(1);
+  _cube_set_literal(_dst_cube(lit_chunk), lit);
   auto num1 = cube_num();
   auto dst_chunk = _new_chunk(num1);
-  auto dst_list = _cube_list(dst_chunk);
-  auto cube1_list = _cube_list(chunk(), 0, num1);
-  for ( auto cube1: cube1_list ) {
-    auto dst_cube = dst_list.back();
-    if ( _cube_algdiv(dst_cube, cube1, lit) ) {
-      dst_list.inc();
-    }
-  }
-  dst_num = dst_list.num();
+  dst_num = SopKernel::algdiv(dst_chunk.data(), chunk().data(), num1,
+			      _cube_size(), lit_chunk.data());
   return dst_chunk;
 }
 
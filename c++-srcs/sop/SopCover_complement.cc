@@ -0,0 +1,246 @@
+
+/// @file SopCover_complement.cc
+/// @brief SopCover の complement 関係の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/SopCover.h"
+#include "SopComplement.h"
+
+
+BEGIN_NAMESPACE_YM_SOP
+
+//////////////////////////////////////////////////////////////////////
+// クラス SopCover
+//////////////////////////////////////////////////////////////////////
+
+// @brief 否定を計算する．
+SopCover
+SopCover::complement() const
+{
+  SopComplement op{variable_num()};
+  Chunk dst_chunk;
+  auto dst_num = op.complement(cube_num(), chunk(), dst_chunk);
+  dst_chunk.resize(_cube_size() * dst_num);
+  return SopCover{variable_num(), dst_num, std::move(dst_chunk)};
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス SopComplement
+//////////////////////////////////////////////////////////////////////
+
+// @brief 否定を求める．
+SizeType
+SopComplement::complement(
+  SizeType cube_num,
+  const Chunk& chunk,
+  Chunk& dst_chunk
+)
+{
+  // _compl_recur() は入力を破壊するのでコピーしておく．
+  Chunk src(chunk.begin(), chunk.begin() + _cube_size() * cube_num);
+  return _compl_recur(0, cube_num, src, dst_chunk);
+}
+
+// @brief 否定を求める再帰関数
+SizeType
+SopComplement::_compl_recur(
+  SizeType depth,
+  SizeType cube_num,
+  Chunk& src,
+  Chunk& dst
+)
+{
+  if ( cube_num == 0 ) {
+    // 結果は tautology
+    _reserve(dst, 1);
+    auto dst_cube = _dst_cube(dst);
+    std::fill(dst_cube, dst_cube + _cube_size(), SOP_ALL1);
+    return 1;
+  }
+
+  // 空のキューブ(universal cube)があるかチェックする．
+  if ( _has_null_cube(cube_num, src) ) {
+    // 結果は空
+    return 0;
+  }
+
+  if ( cube_num == 1 ) {
+    // キューブに対する否定
+    return _cube_complement(_cube(src), dst, 0);
+  }
+
+  auto& frame = mFrameList[depth];
+
+  // 共通キューブ cc をくくりだす．
+  // f = cc & q ならば ~f = ~cc | ~q となる．
+  bool has_cc = _common_cube(cube_num, src, frame.mCc);
+  if ( has_cc ) {
+    auto cc = _cube(frame.mCc);
+    auto cc_end = _cube_end(cc);
+    for ( auto dst_cube = _dst_cube(src), dst_end = _dst_cube(src, cube_num);
+	  dst_cube != dst_end; ) {
+      for ( auto cc_p = cc; cc_p != cc_end; ++ cc_p, ++ dst_cube ) {
+	*dst_cube |= ~*cc_p;
+      }
+    }
+    if ( _has_null_cube(cube_num, src) ) {
+      // q は tautology なので ~cc が答となる．
+      return _cube_complement(cc, dst, 0);
+    }
+  }
+
+  SopPat upat;
+  auto var = _select_var(cube_num, src, upat);
+
+  // 負のコファクターの否定
+  auto cof_num0 = _cofactor(cube_num, src, Literal{var, true}, frame.mCof);
+  auto num0 = _compl_recur(depth + 1, cof_num0, frame.mCof, frame.mRes0);
+
+  // 正のコファクターの否定
+  auto cof_num1 = _cofactor(cube_num, src, Literal{var, false}, frame.mCof);
+  auto num1 = _compl_recur(depth + 1, cof_num1, frame.mCof, frame.mRes1);
+
+  auto dst_num = _merge(var, upat, num0, frame.mRes0, num1, frame.mRes1, dst);
+  if ( has_cc ) {
+    dst_num += _cube_complement(_cube(frame.mCc), dst, dst_num);
+  }
+  return dst_num;
+}
+
+// @brief 共通キューブを求める．
+bool
+SopComplement::_common_cube(
+  SizeType cube_num,
+  const Chunk& src,
+  Chunk& cc
+)
+{
+  _reserve(cc, 1);
+  auto dst_cube = _dst_cube(cc);
+  auto dst_end = dst_cube + _cube_size();
+  auto src_list = _cube_list(src, 0, cube_num);
+  auto src_iter = src_list.begin();
+  auto src_end = src_list.end();
+
+  // 最初のキューブをコピーする．
+  _cube_copy(dst_cube, *src_iter);
+
+  // 2番目以降のキューブとの共通部分を求める．
+  for ( ++ src_iter; src_iter != src_end; ++ src_iter ) {
+    auto src_p = *src_iter;
+    SopPatWord tmp = SOP_ALL1;
+    for ( auto dst_p = dst_cube; dst_p != dst_end; ++ dst_p, ++ src_p ) {
+      *dst_p |= *src_p;
+      tmp &= *dst_p;
+    }
+    if ( tmp == SOP_ALL1 ) {
+      // 空になった．
+      return false;
+    }
+  }
+  return true;
+}
+
+// @brief Shannon 展開の結果をマージする．
+SizeType
+SopComplement::_merge(
+  SizeType var,
+  SopPat upat,
+  SizeType num0,
+  Chunk& res0,
+  SizeType num1,
+  Chunk& res1,
+  Chunk& dst
+)
+{
+  // 共通なキューブを見つけるためにソートする．
+  num0 = mSorter.sort(num0, res0);
+  num1 = mSorter.sort(num1, res1);
+
+  // ~f = ~x & ~f0 | x & ~f1 だが，
+  // ~f0 と ~f1 に共通なキューブはリテラルを付けずに加える．
+  // さらに f が x に関して正(負)の unate ならば
+  // ~f1 (~f0) は ~f0 (~f1) に含まれるのでリテラルは不要となる．
+  _reserve(dst, num0 + num1);
+  Literal lit0{var, true};
+  Literal lit1{var, false};
+  bool need0 = upat != SopPat::_0;
+  bool need1 = upat != SopPat::_1;
+  auto dst_list = _cube_list(dst);
+  auto add_cube = [&](Cube cube, bool need_lit, Literal lit) {
+    auto dst_cube = dst_list.back();
+    _cube_copy(dst_cube, cube);
+    if ( need_lit ) {
+      _cube_product_int(dst_cube, lit);
+    }
+    dst_list.inc();
+  };
+  SizeType i0 = 0;
+  SizeType i1 = 0;
+  while ( i0 < num0 && i1 < num1 ) {
+    auto cube0 = _cube(res0, i0);
+    auto cube1 = _cube(res1, i1);
+    // ソート結果は _cube_compare() の降順に並んでいる．
+    auto res = _cube_compare(cube0, cube1);
+    if ( res > 0 ) {
+      add_cube(cube0, need0, lit0);
+      ++ i0;
+    }
+    else if ( res < 0 ) {
+      add_cube(cube1, need1, lit1);
+      ++ i1;
+    }
+    else {
+      add_cube(cube0, false, lit0);
+      ++ i0;
+      ++ i1;
+    }
+  }
+  for ( ; i0 < num0; ++ i0 ) {
+    add_cube(_cube(res0, i0), need0, lit0);
+  }
+  for ( ; i1 < num1; ++ i1 ) {
+    add_cube(_cube(res1, i1), need1, lit1);
+  }
+  return dst_list.num();
+}
+
+// @brief キューブの否定を dst の pos 番目以降に書き込む．
+SizeType
+SopComplement::_cube_complement(
+  Cube cube,
+  Chunk& dst,
+  SizeType pos
+)
+{
+  // ド・モルガンの法則により各リテラルの否定の和となる．
+  auto nv = variable_num();
+  _reserve(dst, pos + nv);
+  auto dst_list = _cube_list(dst, pos * _cube_size());
+  auto cube_end = _cube_end(cube);
+  SizeType base = 0;
+  for ( auto p = cube; p != cube_end; ++ p, base += 32 ) {
+    auto word = *p;
+    if ( word == SOP_ALL1 ) {
+      continue;
+    }
+    auto end = std::min(base + 32, nv);
+    for ( SizeType var = base; var < end; ++ var ) {
+      auto pat = static_cast<SopPat>((word >> _shift_num(var)) & 3ULL);
+      if ( pat == SopPat::_X ) {
+	continue;
+      }
+      auto dst_cube = dst_list.back();
+      std::fill(dst_cube, dst_cube + _cube_size(), SOP_ALL1);
+      _cube_set_literal(dst_cube, var, pat == SopPat::_1);
+      dst_list.inc();
+    }
+  }
+  return dst_list.num();
+}
+
+END_NAMESPACE_YM_SOP
@@ -0,0 +1,291 @@
+
+/// @file SopCover_minimize.cc
+/// @brief SopCover の minimize 関係の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/SopCover.h"
+#include "SopMinimizer.h"
+
+
+BEGIN_NAMESPACE_YM_SOP
+
+//////////////////////////////////////////////////////////////////////
+// クラス SopCover
+//////////////////////////////////////////////////////////////////////
+
+// @brief 2段論理最小化を行う．
+SopCover
+SopCover::minimize() const
+{
+  return minimize(SopCover{variable_num()});
+}
+
+// @brief ドントケアを用いて2段論理最小化を行う．
+SopCover
+SopCover::minimize(
+  const SopCover& dc
+) const
+{
+  _check_size(dc);
+  SopMinimizer op{variable_num()};
+  Chunk dst_chunk;
+  auto dst_num = op.minimize(cube_num(), chunk(),
+			     dc.cube_num(), dc.chunk(),
+			     dst_chunk);
+  return SopCover{variable_num(), dst_num, std::move(dst_chunk)};
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス SopMinimizer
+//////////////////////////////////////////////////////////////////////
+
+// @brief 最小化を行う．
+SizeType
+SopMinimizer::minimize(
+  SizeType f_num,
+  const Chunk& f,
+  SizeType d_num,
+  const Chunk& d,
+  Chunk& dst
+)
+{
+  auto cs = _cube_size();
+  mFNum = f_num;
+  mF.assign(f.begin(), f.begin() + cs * f_num);
+  mDNum = d_num;
+  mD.assign(d.begin(), d.begin() + cs * d_num);
+
+  if ( mFNum == 0 ) {
+    dst.clear();
+    return 0;
+  }
+
+  // EXPAND で用いるためにオンセットとドントケアの和を作っておく．
+  mFDNum = mFNum + mDNum;
+  mFD.assign(mF.begin(), mF.end());
+  mFD.insert(mFD.end(), mD.begin(), mD.end());
+
+  _expand();
+  _irredundant();
+
+  auto best_cost = _cost();
+  auto best_num = mFNum;
+  Chunk best_f(mF.begin(), mF.begin() + cs * mFNum);
+  for ( ; ; ) {
+    _reduce();
+    _expand();
+    _irredundant();
+    auto cost = _cost();
+    if ( cost >= best_cost ) {
+      break;
+    }
+    best_cost = cost;
+    best_num = mFNum;
+    best_f.assign(mF.begin(), mF.begin() + cs * mFNum);
+  }
+  dst = std::move(best_f);
+  return best_num;
+}
+
+// @brief EXPAND を行う．
+void
+SopMinimizer::_expand()
+{
+  auto nc = mFNum;
+  mAlive.assign(nc, true);
+
+  // リテラル数の少ない(大きな)キューブから順に拡大する．
+  std::vector<std::pair<SizeType, SizeType>> order;
+  order.reserve(nc);
+  for ( SizeType i = 0; i < nc; ++ i ) {
+    order.push_back({_cube_literal_num(_cube(mF, i)), i});
+  }
+  std::sort(order.begin(), order.end());
+
+  for ( auto& p: order ) {
+    auto i = p.second;
+    if ( !mAlive[i] ) {
+      continue;
+    }
+    auto cube = _dst_cube(mF, i);
+    _expand_cube(cube);
+    // 拡大したキューブに包含されるキューブを取り除く．
+    for ( SizeType j = 0; j < nc; ++ j ) {
+      if ( j != i && mAlive[j] &&
+	   _cube_check_containment(cube, _cube(mF, j)) ) {
+	mAlive[j] = false;
+      }
+    }
+  }
+  _compact();
+}
+
+// @brief 1つのキューブを拡大する．
+void
+SopMinimizer::_expand_cube(
+  DstCube cube
+)
+{
+  // 取り除く候補のリテラルを，取り除くことで
+  // 覆える可能性のあるキューブ数の多い順に並べる．
+  auto nv = variable_num();
+  std::vector<std::pair<SizeType, SizeType>> cand_list;
+  for ( SizeType var = 0; var < nv; ++ var ) {
+    auto pat = _get_pat(cube, var);
+    if ( pat == SopPat::_X ) {
+      continue;
+    }
+    auto blk = _block_pos(var);
+    SizeType score = 0;
+    for ( SizeType j = 0; j < mFNum; ++ j ) {
+      if ( mAlive[j] && _word_pat(mF[j * _cube_size() + blk], var) != pat ) {
+	++ score;
+      }
+    }
+    cand_list.push_back({score, var});
+  }
+  std::stable_sort(cand_list.begin(), cand_list.end(),
+		   [](const std::pair<SizeType, SizeType>& a,
+		      const std::pair<SizeType, SizeType>& b) {
+		     return a.first > b.first;
+		   });
+
+  // オンセットとドントケアの和に覆われる限りリテラルを取り除く．
+  // cube 自体は覆われているので，リテラルを反転させたキューブが
+  // 覆われるかを調べればよい．
+  for ( auto& p: cand_list ) {
+    auto var = p.second;
+    auto dst_p = cube + _block_pos(var);
+    auto old_word = *dst_p;
+    auto mask = 3ULL << _shift_num(var);
+    *dst_p ^= mask;
+    bool covered = mTautology.check_covering(mFDNum, mFD, cube);
+    *dst_p = covered ? (old_word | mask) : old_word;
+  }
+}
+
+// @brief IRREDUNDANT を行う．
+void
+SopMinimizer::_irredundant()
+{
+  auto nc = mFNum;
+  mAlive.assign(nc, true);
+
+  // リテラル数の多い(小さな)キューブから順に調べる．
+  std::vector<std::pair<SizeType, SizeType>> order;
+  order.reserve(nc);
+  for ( SizeType i = 0; i < nc; ++ i ) {
+    order.push_back({_cube_literal_num(_cube(mF, i)), i});
+  }
+  std::sort(order.begin(), order.end(),
+	    [](const std::pair<SizeType, SizeType>& a,
+	       const std::pair<SizeType, SizeType>& b) {
+	      return a > b;
+	    });
+
+  for ( auto& p: order ) {
+    auto i = p.second;
+    auto n = _gather_others(i);
+    if ( mTautology.check_covering(n, mTmp, _cube(mF, i)) ) {
+      mAlive[i] = false;
+    }
+  }
+  _compact();
+}
+
+// @brief REDUCE を行う．
+void
+SopMinimizer::_reduce()
+{
+  auto nc = mFNum;
+  mAlive.assign(nc, true);
+
+  // リテラル数の少ない(大きな)キューブから順に縮小する．
+  std::vector<std::pair<SizeType, SizeType>> order;
+  order.reserve(nc);
+  for ( SizeType i = 0; i < nc; ++ i ) {
+    order.push_back({_cube_literal_num(_cube(mF, i)), i});
+  }
+  std::sort(order.begin(), order.end());
+
+  auto nv = variable_num();
+  for ( auto& p: order ) {
+    auto i = p.second;
+    auto n = _gather_others(i);
+    auto cube = _dst_cube(mF, i);
+    // 他のキューブとドントケアで覆われない部分は
+    // cube & ~G_c (G_c は G の cube によるコファクター) で表される．
+    // ~G_c を含む最小のキューブ(sccc)がリテラル x を含むことと
+    // G_c の ~x によるコファクターが tautology であることは等価となる．
+    auto cof_num = _cofactor(n, mTmp, cube, mCof);
+    if ( mTautology.check(cof_num, mCof) ) {
+      // 全て他のキューブで覆われている．
+      mAlive[i] = false;
+      continue;
+    }
+    if ( cof_num == 0 || _has_null_cube(cof_num, mCof) ) {
+      continue;
+    }
+    // G_c に現れる変数のみを調べればよい．
+    // G_c は cube の変数に依存しないので積は空にならない．
+    SopPat upat;
+    _select_var(cof_num, mCof, upat);
+    for ( SizeType var = 0; var < nv; ++ var ) {
+      if ( _p_count(var) == 0 && _n_count(var) == 0 ) {
+	continue;
+      }
+      for ( auto inv: {false, true} ) {
+	auto lit = Literal{var, inv};
+	auto num1 = _cofactor(cof_num, mCof, ~lit, mCof1);
+	if ( mTautology.check(num1, mCof1) ) {
+	  _cube_set_literal(cube, lit);
+	  break;
+	}
+      }
+    }
+  }
+  _compact();
+}
+
+// @brief mF のうち pos 番目以外のキューブとドントケアを mTmp に集める．
+SizeType
+SopMinimizer::_gather_others(
+  SizeType pos
+)
+{
+  _reserve(mTmp, mFNum + mDNum);
+  auto dst_list = _cube_list(mTmp);
+  for ( SizeType i = 0; i < mFNum; ++ i ) {
+    if ( i != pos && mAlive[i] ) {
+      _cube_copy(dst_list.back(), _cube(mF, i));
+      dst_list.inc();
+    }
+  }
+  for ( auto cube: _cube_list(mD, 0, mDNum) ) {
+    _cube_copy(dst_list.back(), cube);
+    dst_list.inc();
+  }
+  return dst_list.num();
+}
+
+// @brief mF から mAlive が false のキューブを取り除く．
+void
+SopMinimizer::_compact()
+{
+  SizeType wpos = 0;
+  for ( SizeType i = 0; i < mFNum; ++ i ) {
+    if ( mAlive[i] ) {
+      if ( wpos < i ) {
+	_cube_copy(_dst_cube(mF, wpos), _cube(mF, i));
+      }
+      ++ wpos;
+    }
+  }
+  mFNum = wpos;
+}
+
+END_NAMESPACE_YM_SOP
@@ -9,6 +9,7 @@
 #include "ym/SopCover.h"
 #include "ym/SopCube.h"
 #include "SopSorter.h"
+#include "SopKernel.h"
 
 
 BEGIN_NAMESPACE_YM_SOP
@@ -102,20 +103,15 @@ SopCover::_product(
 {
   // 単純には答の積項数は2つの積項数の積だが
   // 相反するリテラルを含む積は数えない．
+  // 右辺のキューブごとに左辺の全てのキューブとの積を一括して求める．
   SizeType num1 = cube_num();
+  auto cs = _cube_size();
   auto dst_chunk = _new_chunk(num1 * num2);
-  auto dst_list = _cube_list(dst_chunk);
-  auto cube1_list = _cube_list(chunk(), 0, num1);
-  auto cube2_list = _cube_list(chunk2, 0, num2);
-  for ( auto cube1: cube1_list ) {
-    for ( auto cube2: cube2_list ) {
-      auto dst_cube = dst_list.back();
-      if ( _cube_product(dst_cube, cube1, cube2) ) {
-	dst_list.inc();
-      }
-    }
+  dst_num = 0;
+  for ( auto cube2: _cube_list(chunk2, 0, num2) ) {
+    dst_num += SopKernel::product(dst_chunk.data() + cs * dst_num,
+				  chunk().data(), num1, cs, &*cube2);
   }
-  dst_num = dst_list.num();
   SopSorter sorter{variable_num()};
   sorter.sort(dst_num, dst_chunk);
   return dst_chunk;
@@ -128,25 +124,13 @@ SopCover::_product(
   SizeType& dst_num
 ) const
 {
-  auto varid = lit.varid();
-  auto inv = lit.is_negative();
-  auto blk = _block_pos(varid);
-  auto pat1 = _get_mask(varid, inv);
-  auto npat1 = _get_mask(varid, !inv);
-
-  // 単純には答の積項数は2つの積項数の積だが
-  // 相反するリテラルを含む積は数えない．
+  // リテラルを1つのキューブとして一括して掛け合わせる．
+  auto lit_chunk = _new_chunk(1);
+  _cube_set_literal(_dst_cube(lit_chunk), lit);
   SizeType num1 = cube_num();
   auto dst_chunk = _new_chunk(num1);
-  auto dst_list = _cube_list(dst_chunk);
-  auto cube1_list = _cube_list(chunk(), 0, num1);
-  for ( auto cube1: cube1_list ) {
-    auto dst_cube = dst_list.back();
-    if ( _cube_product(dst_cube, cube1, lit) ) {
-      dst_list.inc();
-    }
-  }
-  dst_num = dst_list.num();
+  dst_num = SopKernel::product(dst_chunk.data(), chunk().data(), num1,
+			       _cube_size(), lit_chunk.data());
   // 同じ位置にパタンが足されるだけなので
   // 順序関係は変わらない．
   return dst_chunk;
@@ -0,0 +1,62 @@
+
+/// @file SopCover_scc.cc
+/// @brief SopCover の scc 関係の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/SopCover.h"
+
+
+BEGIN_NAMESPACE_YM_SOP
+
+//////////////////////////////////////////////////////////////////////
+// クラス SopCover
+//////////////////////////////////////////////////////////////////////
+
+// @brief 単一キューブ包含(single cube containment)を取り除く．
+SopCover
+SopCover::scc() const
+{
+  SopCover ans{*this};
+  ans.scc_int();
+  return ans;
+}
+
+// @brief 単一キューブ包含(single cube containment)を取り除き自身に代入する．
+SopCover&
+SopCover::scc_int()
+{
+  // キューブ A が B を包含するならば A のワードは B のワードを
+  // ビットごとに包含するので，辞書式順序でも A は B より大きい．
+  // _sort() はワードの昇順に並べるので，
+  // あるキューブを包含するキューブは必ずそれよりも後ろにある．
+  // また，重複したキューブは _sort() で取り除かれている．
+  //
+  // 取り除かれたキューブを包含するキューブは後ろに残っているので，
+  // 後ろのキューブは全て調べる必要がある．
+  // 結果は先頭から詰めていくので順序は保たれる．
+  SizeType nc = cube_num();
+  SizeType wpos = 0;
+  for ( SizeType i = 0; i < nc; ++ i ) {
+    auto cube = _cube(mChunk, i);
+    bool contained = false;
+    for ( auto cube1: _cube_list(mChunk, i + 1, nc) ) {
+      if ( _cube_check_containment(cube1, cube) ) {
+	contained = true;
+	break;
+      }
+    }
+    if ( !contained ) {
+      if ( wpos < i ) {
+	_cube_copy(_dst_cube(mChunk, wpos), cube);
+      }
+      ++ wpos;
+    }
+  }
+  mCubeNum = wpos;
+  return *this;
+}
+
+END_NAMESPACE_YM_SOP
@@ -64,7 +64,8 @@ SopSorter::sort(
 )
 {
   // もとのカバーと同じ大きさのバッファを確保する．
-  mTmpChunk = _new_chunk(cube_num);
+  // 同じオブジェクトで繰り返しソートする場合は領域を再利用する．
+  mTmpChunk.resize(_cube_size() * cube_num, SOP_ALL1);
   return sort_sub(chunk, 0, cube_num);
 }
 
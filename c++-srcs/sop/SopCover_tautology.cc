@@ -0,0 +1,186 @@
+
+/// @file SopCover_tautology.cc
+/// @brief SopCover の tautology 関係の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/SopCover.h"
+#include "ym/SopCube.h"
+#include "SopTautology.h"
+#include <cmath>
+
+
+BEGIN_NAMESPACE_YM_SOP
+
+//////////////////////////////////////////////////////////////////////
+// クラス SopCover
+//////////////////////////////////////////////////////////////////////
+
+// @brief トートロジーの時 true を返す．
+bool
+SopCover::is_tautology() const
+{
+  SopTautology op{variable_num()};
+  return op.check(cube_num(), chunk());
+}
+
+// @brief キューブを覆っている時 true を返す．
+bool
+SopCover::check_covering(
+  const SopCube& cube
+) const
+{
+  _check_size(cube);
+  SopTautology op{variable_num()};
+  return op.check_covering(cube_num(), chunk(), _cube(cube.chunk()));
+}
+
+// @brief オペランドのキューブに包含されている時 true を返す．
+bool
+SopCover::check_containment(
+  const SopCube& right
+) const
+{
+  _check_size(right);
+  auto cube2 = _cube(right.chunk());
+  for ( auto cube1: _cube_list(chunk(), 0, cube_num()) ) {
+    if ( !_cube_check_containment(cube2, cube1) ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// @brief オペランドのカバーに包含されている時 true を返す．
+bool
+SopCover::check_containment(
+  const SopCover& right
+) const
+{
+  _check_size(right);
+  SopTautology op{variable_num()};
+  for ( auto cube: _cube_list(chunk(), 0, cube_num()) ) {
+    if ( !op.check_covering(right.cube_num(), right.chunk(), cube) ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス SopTautology
+//////////////////////////////////////////////////////////////////////
+
+// @brief トートロジー判定を行う再帰関数
+bool
+SopTautology::_taut_recur(
+  SizeType depth,
+  SizeType cube_num,
+  const Chunk& src
+)
+{
+  if ( cube_num == 0 ) {
+    return false;
+  }
+  if ( _has_null_cube(cube_num, src) ) {
+    return true;
+  }
+  if ( !_check_minterm_num(cube_num, src) ) {
+    // 最小項の数が足りない．
+    return false;
+  }
+
+  SopPat upat;
+  auto var = _select_var(cube_num, src, upat);
+  if ( upat != SopPat::_X ) {
+    // 空のキューブを含まない unate cover は tautology ではない．
+    return false;
+  }
+
+  auto& cof = mFrameList[depth];
+
+  // f が x に関して正の unate ならば f が tautology であることと
+  // f の負のコファクター(x を含むキューブを除いたもの)が
+  // tautology であることは等価となる．
+  auto red_num = _unate_reduction(cube_num, src, cof);
+  if ( red_num < cube_num ) {
+    return _taut_recur(depth + 1, red_num, cof);
+  }
+
+  auto num0 = _cofactor(cube_num, src, Literal{var, true}, cof);
+  if ( !_taut_recur(depth + 1, num0, cof) ) {
+    return false;
+  }
+  auto num1 = _cofactor(cube_num, src, Literal{var, false}, cof);
+  return _taut_recur(depth + 1, num1, cof);
+}
+
+// @brief 最小項の数が tautology となり得るか調べる．
+bool
+SopTautology::_check_minterm_num(
+  SizeType cube_num,
+  const Chunk& src
+) const
+{
+  // リテラル数 k のキューブは全体の 2^-k の最小項を覆う．
+  // キューブ間の重なりを無視した和が 1 未満なら tautology ではない．
+  // 2のべき乗の和なので丸め誤差は加算1回当たり 2^-53 以下となる．
+  double sum = 0.0;
+  for ( auto cube: _cube_list(src, 0, cube_num) ) {
+    sum += std::ldexp(1.0, -static_cast<int>(_cube_literal_num(cube)));
+    if ( sum >= 1.0 ) {
+      return true;
+    }
+  }
+  return sum + std::ldexp(static_cast<double>(cube_num), -52) >= 1.0;
+}
+
+// @brief unate な変数のリテラルを含むキューブを取り除く．
+SizeType
+SopTautology::_unate_reduction(
+  SizeType cube_num,
+  const Chunk& src,
+  Chunk& dst
+)
+{
+  // unate な変数の位置を 00 にしたマスクを作る．
+  auto nv = variable_num();
+  mMask.assign(_cube_size(), SOP_ALL1);
+  bool found = false;
+  for ( SizeType var = 0; var < nv; ++ var ) {
+    if ( (_p_count(var) > 0) != (_n_count(var) > 0) ) {
+      auto blk = _block_pos(var);
+      mMask[blk] &= ~(3ULL << _shift_num(var));
+      found = true;
+    }
+  }
+  if ( !found ) {
+    return cube_num;
+  }
+
+  // マスクの位置にリテラルを持たないキューブのみを残す．
+  _reserve(dst, cube_num);
+  auto dst_list = _cube_list(dst);
+  auto mask = _cube(mMask);
+  auto mask_end = _cube_end(mask);
+  for ( auto cube: _cube_list(src, 0, cube_num) ) {
+    bool has_unate = false;
+    auto p = cube;
+    for ( auto q = mask; q != mask_end; ++ p, ++ q ) {
+      if ( (*p | *q) != SOP_ALL1 ) {
+	has_unate = true;
+	break;
+      }
+    }
+    if ( !has_unate ) {
+      _cube_copy(dst_list.back(), cube);
+      dst_list.inc();
+    }
+  }
+  return dst_list.num();
+}
+
+END_NAMESPACE_YM_SOP
@@ -0,0 +1,623 @@
+
+/// @file SopKernel.cc
+/// @brief SopKernel の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "SopKernel.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SOPKERNEL_X86 1
+#include <immintrin.h>
+#else
+#define SOPKERNEL_X86 0
+#endif
+
+
+BEGIN_NAMESPACE_YM_SOP
+
+BEGIN_NONAMESPACE
+
+// 各変数の下位ビットの位置が1のマスク
+const SopPatWord MASK1 = 0x5555555555555555ULL;
+
+// ワード中にコンフリクト(00 のパタン)があるか調べる．
+inline
+bool
+word_check_conflict(
+  SopPatWord word
+)
+{
+  return ((word | (word >> 1)) & MASK1) != MASK1;
+}
+
+// ワードごとの判定結果のビットからキューブごとの判定結果を求める．
+//
+// キューブを構成する全てのワードのビットが1のキューブのみ，
+// そのワードの位置のビットを1にする．
+// cube_size は 2 のべき乗でなければならない．
+inline
+unsigned int
+cube_lane_mask(
+  unsigned int word_mask,
+  SizeType cube_size
+)
+{
+  // キューブの先頭のビットに全てのビットの論理積を集める．
+  auto tmp = word_mask;
+  for ( SizeType s = 1; s < cube_size; s <<= 1 ) {
+    tmp &= tmp >> s;
+  }
+  unsigned int head = 0U;
+  for ( SizeType pos = 0; pos < 8; pos += cube_size ) {
+    head |= 1U << pos;
+  }
+  tmp &= head;
+  // 先頭のビットをキューブ全体に広げる．
+  for ( SizeType s = 1; s < cube_size; s <<= 1 ) {
+    tmp |= tmp << s;
+  }
+  return tmp;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// 64ビットワードごとの実装
+//
+// ベクタ命令版の端数の処理にも用いる．
+// 結果を書き込んだ領域の末尾を返す．
+//////////////////////////////////////////////////////////////////////
+
+SizeType
+literal_num_scalar(
+  const SopPatWord* vec,
+  SizeType n
+)
+{
+  SizeType ans = 0;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    ans += SopKernel::literal_num(vec[i]);
+  }
+  return ans;
+}
+
+SopPatWord*
+product_sub(
+  SopPatWord* dst,
+  const SopPatWord* src,
+  SizeType cube_num,
+  SizeType cube_size,
+  const SopPatWord* cube
+)
+{
+  for ( SizeType i = 0; i < cube_num; ++ i, src += cube_size ) {
+    bool ok = true;
+    for ( SizeType k = 0; k < cube_size; ++ k ) {
+      auto tmp = src[k] & cube[k];
+      if ( word_check_conflict(tmp) ) {
+	ok = false;
+	break;
+      }
+      dst[k] = tmp;
+    }
+    if ( ok ) {
+      dst += cube_size;
+    }
+  }
+  return dst;
+}
+
+SopPatWord*
+algdiv_sub(
+  SopPatWord* dst,
+  const SopPatWord* src,
+  SizeType cube_num,
+  SizeType cube_size,
+  const SopPatWord* cube
+)
+{
+  for ( SizeType i = 0; i < cube_num; ++ i, src += cube_size ) {
+    bool ok = true;
+    for ( SizeType k = 0; k < cube_size; ++ k ) {
+      auto pat1 = src[k];
+      auto pat2 = cube[k];
+      if ( (pat1 & ~pat2) != SOP_ALL0 ) {
+	ok = false;
+	break;
+      }
+      dst[k] = pat1 | ~pat2;
+    }
+    if ( ok ) {
+      dst += cube_size;
+    }
+  }
+  return dst;
+}
+
+SizeType
+product_scalar(
+  SopPatWord* dst,
+  const SopPatWord* src,
+  SizeType cube_num,
+  SizeType cube_size,
+  const SopPatWord* cube
+)
+{
+  auto end = product_sub(dst, src, cube_num, cube_size, cube);
+  return (end - dst) / cube_size;
+}
+
+SizeType
+algdiv_scalar(
+  SopPatWord* dst,
+  const SopPatWord* src,
+  SizeType cube_num,
+  SizeType cube_size,
+  const SopPatWord* cube
+)
+{
+  auto end = algdiv_sub(dst, src, cube_num, cube_size, cube);
+  return (end - dst) / cube_size;
+}
+
+#if SOPKERNEL_X86
+
+//////////////////////////////////////////////////////////////////////
+// POPCNT 命令による実装
+//
+// ベクタ命令版でワード数が少ない場合に用いる．
+//////////////////////////////////////////////////////////////////////
+
+__attribute__((target("popcnt")))
+SizeType
+literal_num_popcnt(
+  const SopPatWord* vec,
+  SizeType n
+)
+{
+  SizeType ans = 0;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    auto word = vec[i];
+    ans += __builtin_popcountll((word ^ (word >> 1)) & MASK1);
+  }
+  return ans;
+}
+
+//////////////////////////////////////////////////////////////////////
+// AVX2 による実装
+//
+// 256 ビットのベクタに 4 / cube_size 個のキューブを詰めて処理する．
+// 条件を満たすキューブのみを並べ替えで前に詰めて書き込む．
+//////////////////////////////////////////////////////////////////////
+
+__attribute__((target("avx2")))
+inline
+__m256i
+popcount256(
+  __m256i v
+)
+{
+  const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+					  1, 2, 2, 3, 2, 3, 3, 4,
+					  0, 1, 1, 2, 1, 2, 2, 3,
+					  1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i low_mask = _mm256_set1_epi8(0x0F);
+  auto lo = _mm256_and_si256(v, low_mask);
+  auto hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+  auto cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+			     _mm256_shuffle_epi8(lookup, hi));
+  return _mm256_sad_epu8(cnt, _mm256_setzero_si256());
+}
+
+__attribute__((target("avx2,popcnt")))
+SizeType
+literal_num_avx2(
+  const SopPatWord* vec,
+  SizeType n
+)
+{
+  auto vmask1 = _mm256_set1_epi64x(static_cast<long long>(MASK1));
+  auto acc = _mm256_setzero_si256();
+  SizeType i = 0;
+  for ( ; i + 4 <= n; i += 4 ) {
+    auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(vec + i));
+    auto lits = _mm256_and_si256(_mm256_xor_si256(v, _mm256_srli_epi64(v, 1)),
+				 vmask1);
+    acc = _mm256_add_epi64(acc, popcount256(lits));
+  }
+  SizeType ans = _mm256_extract_epi64(acc, 0) + _mm256_extract_epi64(acc, 1)
+    + _mm256_extract_epi64(acc, 2) + _mm256_extract_epi64(acc, 3);
+  return ans + literal_num_popcnt(vec + i, n - i);
+}
+
+// 判定結果のマスクに従ってベクタの内容を詰めて書き込む．
+//
+// 選ばれたワードを VPERMD で前に詰めてからベクタ全体を書き込む．
+// dst は読み込み済みの位置を越えないので，余分に書き込んだ部分は
+// 後で上書きされるか使われない．
+__attribute__((target("avx2,popcnt")))
+inline
+SopPatWord*
+compress_store256(
+  SopPatWord* dst,
+  __m256i v,
+  unsigned int mask
+)
+{
+  // mask ごとの 32 ビット単位の並べ替え表
+  static const std::uint32_t perm_table[16][8] = {
+    {0, 1, 2, 3, 4, 5, 6, 7}, {0, 1, 2, 3, 4, 5, 6, 7},
+    {2, 3, 0, 1, 4, 5, 6, 7}, {0, 1, 2, 3, 4, 5, 6, 7},
+    {4, 5, 0, 1, 2, 3, 6, 7}, {0, 1, 4, 5, 2, 3, 6, 7},
+    {2, 3, 4, 5, 0, 1, 6, 7}, {0, 1, 2, 3, 4, 5, 6, 7},
+    {6, 7, 0, 1, 2, 3, 4, 5}, {0, 1, 6, 7, 2, 3, 4, 5},
+    {2, 3, 6, 7, 0, 1, 4, 5}, {0, 1, 2, 3, 6, 7, 4, 5},
+    {4, 5, 6, 7, 0, 1, 2, 3}, {0, 1, 4, 5, 6, 7, 2, 3},
+    {2, 3, 4, 5, 6, 7, 0, 1}, {0, 1, 2, 3, 4, 5, 6, 7}
+  };
+  auto idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(perm_table[mask]));
+  v = _mm256_permutevar8x32_epi32(v, idx);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+  return dst + __builtin_popcount(mask);
+}
+
+// キューブを並べたベクタを作る．
+__attribute__((target("avx2")))
+inline
+__m256i
+broadcast_cube256(
+  const SopPatWord* cube,
+  SizeType cube_size
+)
+{
+  alignas(32) SopPatWord buf[4];
+  for ( SizeType k = 0; k < 4; ++ k ) {
+    buf[k] = cube[k % cube_size];
+  }
+  return _mm256_load_si256(reinterpret_cast<const __m256i*>(buf));
+}
+
+__attribute__((target("avx2,popcnt")))
+SizeType
+product_avx2(
+  SopPatWord* dst,
+  const SopPatWord* src,
+  SizeType cube_num,
+  SizeType cube_size,
+  const SopPatWord* cube
+)
+{
+  if ( 4 % cube_size != 0 ) {
+    return product_scalar(dst, src, cube_num, cube_size, cube);
+  }
+  auto n = 4 / cube_size;
+  auto vcube = broadcast_cube256(cube, cube_size);
+  auto vmask1 = _mm256_set1_epi64x(static_cast<long long>(MASK1));
+  auto dst_p = dst;
+  SizeType i = 0;
+  for ( ; i + n <= cube_num; i += n, src += 4 ) {
+    auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    v = _mm256_and_si256(v, vcube);
+    auto tmp = _mm256_and_si256(_mm256_or_si256(v, _mm256_srli_epi64(v, 1)),
+				vmask1);
+    auto ok = _mm256_cmpeq_epi64(tmp, vmask1);
+    unsigned int mask = _mm256_movemask_pd(_mm256_castsi256_pd(ok));
+    mask = cube_lane_mask(mask, cube_size);
+    dst_p = compress_store256(dst_p, v, mask);
+  }
+  dst_p = product_sub(dst_p, src, cube_num - i, cube_size, cube);
+  return (dst_p - dst) / cube_size;
+}
+
+__attribute__((target("avx2,popcnt")))
+SizeType
+algdiv_avx2(
+  SopPatWord* dst,
+  const SopPatWord* src,
+  SizeType cube_num,
+  SizeType cube_size,
+  const SopPatWord* cube
+)
+{
+  if ( 4 % cube_size != 0 ) {
+    return algdiv_scalar(dst, src, cube_num, cube_size, cube);
+  }
+  auto n = 4 / cube_size;
+  auto vcube = broadcast_cube256(cube, cube_size);
+  auto vncube = _mm256_xor_si256(vcube, _mm256_set1_epi64x(-1LL));
+  auto vzero = _mm256_setzero_si256();
+  auto dst_p = dst;
+  SizeType i = 0;
+  for ( ; i + n <= cube_num; i += n, src += 4 ) {
+    auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    auto ok = _mm256_cmpeq_epi64(_mm256_andnot_si256(vcube, v), vzero);
+    unsigned int mask = _mm256_movemask_pd(_mm256_castsi256_pd(ok));
+    mask = cube_lane_mask(mask, cube_size);
+    dst_p = compress_store256(dst_p, _mm256_or_si256(v, vncube), mask);
+  }
+  dst_p = algdiv_sub(dst_p, src, cube_num - i, cube_size, cube);
+  return (dst_p - dst) / cube_size;
+}
+
+//////////////////////////////////////////////////////////////////////
+// AVX-512 による実装
+//
+// 512 ビットのベクタに 8 / cube_size 個のキューブを詰めて処理する．
+// 条件を満たすキューブのみを VPCOMPRESSQ で詰めて書き込む．
+//////////////////////////////////////////////////////////////////////
+
+__attribute__((target("avx512f,avx512vpopcntdq")))
+SizeType
+literal_num_avx512(
+  const SopPatWord* vec,
+  SizeType n
+)
+{
+  auto vmask1 = _mm512_set1_epi64(static_cast<long long>(MASK1));
+  auto acc = _mm512_setzero_si512();
+  SizeType i = 0;
+  for ( ; i + 8 <= n; i += 8 ) {
+    auto v = _mm512_loadu_si512(vec + i);
+    auto lits = _mm512_and_si512(_mm512_xor_si512(v, _mm512_srli_epi64(v, 1)),
+				 vmask1);
+    acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(lits));
+  }
+  if ( i < n ) {
+    // 読み込まなかった要素は 0 なのでリテラルとは数えられない．
+    __mmask8 k = static_cast<__mmask8>((1U << (n - i)) - 1U);
+    auto v = _mm512_maskz_loadu_epi64(k, vec + i);
+    auto lits = _mm512_and_si512(_mm512_xor_si512(v, _mm512_srli_epi64(v, 1)),
+				 vmask1);
+    acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(lits));
+  }
+  return _mm512_reduce_add_epi64(acc);
+}
+
+// キューブを並べたベクタを作る．
+__attribute__((target("avx512f")))
+inline
+__m512i
+broadcast_cube512(
+  const SopPatWord* cube,
+  SizeType cube_size
+)
+{
+  alignas(64) SopPatWord buf[8];
+  for ( SizeType k = 0; k < 8; ++ k ) {
+    buf[k] = cube[k % cube_size];
+  }
+  return _mm512_load_si512(buf);
+}
+
+__attribute__((target("avx512f,popcnt")))
+SizeType
+product_avx512(
+  SopPatWord* dst,
+  const SopPatWord* src,
+  SizeType cube_num,
+  SizeType cube_size,
+  const SopPatWord* cube
+)
+{
+  if ( 8 % cube_size != 0 ) {
+    return product_scalar(dst, src, cube_num, cube_size, cube);
+  }
+  auto n = 8 / cube_size;
+  auto vcube = broadcast_cube512(cube, cube_size);
+  auto vmask1 = _mm512_set1_epi64(static_cast<long long>(MASK1));
+  auto dst_p = dst;
+  SizeType i = 0;
+  for ( ; i + n <= cube_num; i += n, src += 8 ) {
+    auto v = _mm512_and_si512(_mm512_loadu_si512(src), vcube);
+    auto tmp = _mm512_and_si512(_mm512_or_si512(v, _mm512_srli_epi64(v, 1)),
+				vmask1);
+    unsigned int mask = _mm512_cmpeq_epi64_mask(tmp, vmask1);
+    mask = cube_lane_mask(mask, cube_size);
+    _mm512_mask_compressstoreu_epi64(dst_p, static_cast<__mmask8>(mask), v);
+    dst_p += __builtin_popcount(mask);
+  }
+  dst_p = product_sub(dst_p, src, cube_num - i, cube_size, cube);
+  return (dst_p - dst) / cube_size;
+}
+
+__attribute__((target("avx512f,popcnt")))
+SizeType
+algdiv_avx512(
+  SopPatWord* dst,
+  const SopPatWord* src,
+  SizeType cube_num,
+  SizeType cube_size,
+  const SopPatWord* cube
+)
+{
+  if ( 8 % cube_size != 0 ) {
+    return algdiv_scalar(dst, src, cube_num, cube_size, cube);
+  }
+  auto n = 8 / cube_size;
+  auto vcube = broadcast_cube512(cube, cube_size);
+  auto vncube = _mm512_xor_si512(vcube, _mm512_set1_epi64(-1LL));
+  auto dst_p = dst;
+  SizeType i = 0;
+  for ( ; i + n <= cube_num; i += n, src += 8 ) {
+    auto v = _mm512_loadu_si512(src);
+    // (v & ~cube) == 0 のワードのビットが1になる．
+    unsigned int mask = _mm512_testn_epi64_mask(v, vncube);
+    mask = cube_lane_mask(mask, cube_size);
+    _mm512_mask_compressstoreu_epi64(dst_p, static_cast<__mmask8>(mask),
+				     _mm512_or_si512(v, vncube));
+    dst_p += __builtin_popcount(mask);
+  }
+  dst_p = algdiv_sub(dst_p, src, cube_num - i, cube_size, cube);
+  return (dst_p - dst) / cube_size;
+}
+
+#endif // SOPKERNEL_X86
+
+// ベクタ命令を用いる最小のワード数
+// これより短い場合には準備のコストの方が大きい．
+const SizeType VECTOR_MIN = 8;
+
+// 実装ごとの関数の組
+//
+// mSmallLiteralNum は VECTOR_MIN より短い場合に用いる．
+struct Kernel
+{
+  SopKernel::Impl mImpl;
+  SizeType (*mLiteralNum)(const SopPatWord*, SizeType);
+  SizeType (*mSmallLiteralNum)(const SopPatWord*, SizeType);
+  SizeType (*mProduct)(SopPatWord*, const SopPatWord*, SizeType, SizeType,
+		       const SopPatWord*);
+  SizeType (*mAlgdiv)(SopPatWord*, const SopPatWord*, SizeType, SizeType,
+		      const SopPatWord*);
+};
+
+Kernel
+get_kernel(
+  SopKernel::Impl impl
+)
+{
+  switch ( impl ) {
+#if SOPKERNEL_X86
+  case SopKernel::Impl::Avx512:
+    return Kernel{impl, literal_num_avx512, literal_num_popcnt,
+		  product_avx512, algdiv_avx512};
+  case SopKernel::Impl::Avx2:
+    return Kernel{impl, literal_num_avx2, literal_num_popcnt,
+		  product_avx2, algdiv_avx2};
+#endif
+  default:
+    break;
+  }
+  return Kernel{SopKernel::Impl::Scalar, literal_num_scalar, literal_num_scalar,
+		product_scalar, algdiv_scalar};
+}
+
+// 使える実装のうち最も速いものを選ぶ．
+Kernel
+best_kernel()
+{
+  for ( auto impl: {SopKernel::Impl::Avx512,
+		    SopKernel::Impl::Avx2} ) {
+    if ( SopKernel::is_supported(impl) ) {
+      return get_kernel(impl);
+    }
+  }
+  return get_kernel(SopKernel::Impl::Scalar);
+}
+
+// 現在の実装
+Kernel&
+cur_kernel()
+{
+  static Kernel kernel = best_kernel();
+  return kernel;
+}
+
+END_NONAMESPACE
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス SopKernel
+//////////////////////////////////////////////////////////////////////
+
+// @brief ワード列中のリテラル数を数える．
+SizeType
+SopKernel::literal_num(
+  const SopPatWord* vec,
+  SizeType n
+)
+{
+  auto& kernel = cur_kernel();
+  if ( n < VECTOR_MIN ) {
+    return (*kernel.mSmallLiteralNum)(vec, n);
+  }
+  return (*kernel.mLiteralNum)(vec, n);
+}
+
+// @brief キューブ列の各キューブと1つのキューブの積を求める．
+SizeType
+SopKernel::product(
+  SopPatWord* dst,
+  const SopPatWord* src,
+  SizeType cube_num,
+  SizeType cube_size,
+  const SopPatWord* cube
+)
+{
+  return (*cur_kernel().mProduct)(dst, src, cube_num, cube_size, cube);
+}
+
+// @brief キューブ列の各キューブを1つのキューブで割った商を求める．
+SizeType
+SopKernel::algdiv(
+  SopPatWord* dst,
+  const SopPatWord* src,
+  SizeType cube_num,
+  SizeType cube_size,
+  const SopPatWord* cube
+)
+{
+  return (*cur_kernel().mAlgdiv)(dst, src, cube_num, cube_size, cube);
+}
+
+// @brief 現在用いている実装を返す．
+SopKernel::Impl
+SopKernel::impl()
+{
+  return cur_kernel().mImpl;
+}
+
+// @brief 用いる実装を設定する．
+void
+SopKernel::set_impl(
+  Impl impl
+)
+{
+  if ( !is_supported(impl) ) {
+    throw std::invalid_argument{"SopKernel: not supported"};
+  }
+  cur_kernel() = get_kernel(impl);
+}
+
+// @brief 実装が使えるか調べる．
+bool
+SopKernel::is_supported(
+  Impl impl
+)
+{
+  switch ( impl ) {
+  case Impl::Scalar:
+    return true;
+#if SOPKERNEL_X86
+  case Impl::Avx2:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+  case Impl::Avx512:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512f") &&
+      __builtin_cpu_supports("avx512vpopcntdq") &&
+      __builtin_cpu_supports("popcnt");
+#endif
+  default:
+    break;
+  }
+  return false;
+}
+
+// @brief 実装の名前を返す．
+const char*
+SopKernel::impl_name(
+  Impl impl
+)
+{
+  switch ( impl ) {
+  case Impl::Scalar: return "scalar";
+  case Impl::Avx2:   return "avx2";
+  case Impl::Avx512: return "avx512";
+  }
+  return "";
+}
+
+END_NAMESPACE_YM_SOP
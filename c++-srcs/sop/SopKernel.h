@@ -0,0 +1,145 @@
+#ifndef SOPKERNEL_H
+#define SOPKERNEL_H
+
+/// @file SopKernel.h
+/// @brief SopKernel のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "ym/SopBase.h"
+
+
+BEGIN_NAMESPACE_YM_SOP
+
+//////////////////////////////////////////////////////////////////////
+/// @class SopKernel SopKernel.h "SopKernel.h"
+/// @brief キューブのビットベクタを一括して処理する関数群
+///
+/// ワード列やキューブ列を対象とする関数は実行時に CPU の機能を調べて
+/// 以下の実装の中から使えるものを選ぶ．
+/// - Avx512: AVX-512 の 512 ビット演算とマスク付きの圧縮ストアを用いる．
+/// - Avx2:   AVX2 の 256 ビット演算を用いる．
+/// - Scalar: 64 ビットワードごとの演算を用いる．
+///
+/// product(), algdiv() では1つのベクタ中に複数のキューブを詰めて
+/// 処理するので，キューブサイズがベクタのワード数の約数の場合のみ
+/// ベクタ命令を用いる．それ以外の場合は Scalar と同じ処理を行う．
+//////////////////////////////////////////////////////////////////////
+class SopKernel
+{
+public:
+
+  /// @brief 実装の種類
+  enum class Impl {
+    Scalar,
+    Avx2,
+    Avx512
+  };
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 1ワード中のリテラル数を数える．
+  ///
+  /// 01 と 10 のパタンがリテラルを表す．
+  static
+  int
+  literal_num(
+    SopPatWord word ///< [in] 対象のワード
+  )
+  {
+    const SopPatWord mask1 = 0x5555555555555555ULL;
+    auto lits = (word ^ (word >> 1)) & mask1;
+#if defined(__POPCNT__)
+    return __builtin_popcountll(lits);
+#else
+    const SopPatWord mask2 = 0x3333333333333333ULL;
+    const SopPatWord mask4 = 0x0F0F0F0F0F0F0F0FULL;
+    lits = (lits & mask2) + ((lits >> 2) & mask2);
+    lits = (lits & mask4) + ((lits >> 4) & mask4);
+    return static_cast<int>((lits * 0x0101010101010101ULL) >> 56);
+#endif
+  }
+
+  /// @brief ワード列中のリテラル数を数える．
+  static
+  SizeType
+  literal_num(
+    const SopPatWord* vec, ///< [in] ワード列の先頭
+    SizeType n             ///< [in] ワード数
+  );
+
+  /// @brief キューブ列の各キューブと1つのキューブの積を求める．
+  /// @return 結果のキューブ数を返す．
+  ///
+  /// 積が空になるキューブは結果に含めない．
+  /// dst には cube_num 個のキューブを格納できる領域が必要となる．
+  /// 結果より後ろの領域の内容は不定となる．
+  /// dst と src は同じでもよい．
+  static
+  SizeType
+  product(
+    SopPatWord* dst,       ///< [out] 結果を格納する領域の先頭
+    const SopPatWord* src, ///< [in] キューブ列の先頭
+    SizeType cube_num,     ///< [in] キューブ数
+    SizeType cube_size,    ///< [in] キューブのワード数
+    const SopPatWord* cube ///< [in] 掛け合わせるキューブ
+  );
+
+  /// @brief キューブ列の各キューブを1つのキューブで割った商を求める．
+  /// @return 結果のキューブ数を返す．
+  ///
+  /// 割り切れないキューブは結果に含めない．
+  /// dst には cube_num 個のキューブを格納できる領域が必要となる．
+  /// 結果より後ろの領域の内容は不定となる．
+  /// dst と src は同じでもよい．
+  static
+  SizeType
+  algdiv(
+    SopPatWord* dst,       ///< [out] 結果を格納する領域の先頭
+    const SopPatWord* src, ///< [in] キューブ列の先頭
+    SizeType cube_num,     ///< [in] キューブ数
+    SizeType cube_size,    ///< [in] キューブのワード数
+    const SopPatWord* cube ///< [in] 除数のキューブ
+  );
+
+  /// @brief 現在用いている実装を返す．
+  static
+  Impl
+  impl();
+
+  /// @brief 用いる実装を設定する．
+  ///
+  /// 使えない実装を指定した場合には std::invalid_argument 例外を送出する．
+  /// 主に性能評価とテストのための関数
+  static
+  void
+  set_impl(
+    Impl impl ///< [in] 実装の種類
+  );
+
+  /// @brief 実装が使えるか調べる．
+  static
+  bool
+  is_supported(
+    Impl impl ///< [in] 実装の種類
+  );
+
+  /// @brief 実装の名前を返す．
+  static
+  const char*
+  impl_name(
+    Impl impl ///< [in] 実装の種類
+  );
+
+};
+
+END_NAMESPACE_YM_SOP
+
+#endif // SOPKERNEL_H
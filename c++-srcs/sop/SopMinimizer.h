@@ -0,0 +1,170 @@
+#ifndef SOPMINIMIZER_H
+#define SOPMINIMIZER_H
+
+/// @file SopMinimizer.h
+/// @brief SopMinimizer のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "SopUrp.h"
+#include "SopTautology.h"
+
+
+BEGIN_NAMESPACE_YM_SOP
+
+//////////////////////////////////////////////////////////////////////
+/// @class SopMinimizer SopMinimizer.h "SopMinimizer.h"
+/// @brief Espresso 風の2段論理最小化を行うクラス
+///
+/// EXPAND, IRREDUNDANT, REDUCE をコストが減らなくなるまで繰り返す．
+/// コストは (キューブ数, リテラル数) の辞書式順序で比較する．
+///
+/// オフセットは大きくなりやすいので求めない．
+/// - EXPAND ではキューブがオンセットとドントケアの和に覆われるかを
+///   トートロジー判定で調べる．
+/// - REDUCE では否定を含む最小のキューブ(sccc)の各リテラルを
+///   コファクターのトートロジー判定で求める．
+/// 真理値表も用いないので変数の数に制限はない．
+//////////////////////////////////////////////////////////////////////
+class SopMinimizer :
+  public SopUrp
+{
+public:
+
+  /// @brief コンストラクタ
+  SopMinimizer(
+    SizeType var_num ///< [in] 変数の数
+  ) : SopUrp{var_num},
+      mTautology{var_num}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~SopMinimizer() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 最小化を行う．
+  /// @return 結果のキューブ数を返す．
+  SizeType
+  minimize(
+    SizeType f_num,   ///< [in] オンセットのキューブ数
+    const Chunk& f,   ///< [in] オンセットのビットベクタ
+    SizeType d_num,   ///< [in] ドントケアのキューブ数
+    const Chunk& d,   ///< [in] ドントケアのビットベクタ
+    Chunk& dst        ///< [out] 結果を格納するビットベクタ
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief EXPAND を行う．
+  ///
+  /// 各キューブをオンセットとドントケアの和に覆われる範囲で極大に拡大し，
+  /// 拡大したキューブに包含されるキューブを取り除く．
+  void
+  _expand();
+
+  /// @brief 1つのキューブを拡大する．
+  void
+  _expand_cube(
+    DstCube cube ///< [in] 対象のキューブ
+  );
+
+  /// @brief IRREDUNDANT を行う．
+  ///
+  /// 他のキューブとドントケアで覆われるキューブを取り除く．
+  void
+  _irredundant();
+
+  /// @brief REDUCE を行う．
+  ///
+  /// 各キューブを，他のキューブとドントケアで覆われない部分を
+  /// 含む最小のキューブに縮小する．
+  void
+  _reduce();
+
+  /// @brief mF のうち pos 番目以外のキューブとドントケアを mTmp に集める．
+  /// @return mTmp のキューブ数を返す．
+  SizeType
+  _gather_others(
+    SizeType pos ///< [in] 除外するキューブ番号
+  );
+
+  /// @brief mF から mAlive が false のキューブを取り除く．
+  void
+  _compact();
+
+  /// @brief 現在のコストを返す．
+  std::pair<SizeType, SizeType>
+  _cost() const
+  {
+    return {mFNum, _literal_num(mFNum, mF)};
+  }
+
+  /// @brief 変数のパタンを返す．
+  static
+  SopPat
+  _word_pat(
+    SopPatWord word, ///< [in] 対象のワード
+    SizeType var     ///< [in] 変数番号
+  )
+  {
+    return static_cast<SopPat>((word >> _shift_num(var)) & 3ULL);
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // トートロジー判定を行うためのオブジェクト
+  SopTautology mTautology;
+
+  // 元のオンセットとドントケアの和のキューブ数
+  SizeType mFDNum{0};
+
+  // 元のオンセットとドントケアの和
+  // 最小化の途中でもカバーとドントケアの和はこれに等しい．
+  Chunk mFD;
+
+  // 現在のカバーのキューブ数
+  SizeType mFNum{0};
+
+  // 現在のカバー
+  Chunk mF;
+
+  // ドントケアのキューブ数
+  SizeType mDNum{0};
+
+  // ドントケア
+  Chunk mD;
+
+  // mF の各キューブが生きているかを表すフラグ
+  std::vector<bool> mAlive;
+
+  // 作業用のビットベクタ
+  Chunk mTmp;
+
+  // REDUCE 用のコファクター
+  Chunk mCof;
+
+  // REDUCE 用のコファクターのコファクター
+  Chunk mCof1;
+
+};
+
+END_NAMESPACE_YM_SOP
+
+#endif // SOPMINIMIZER_H
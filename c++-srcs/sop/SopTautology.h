@@ -0,0 +1,131 @@
+#ifndef SOPTAUTOLOGY_H
+#define SOPTAUTOLOGY_H
+
+/// @file SopTautology.h
+/// @brief SopTautology のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "SopUrp.h"
+
+
+BEGIN_NAMESPACE_YM_SOP
+
+//////////////////////////////////////////////////////////////////////
+/// @class SopTautology SopTautology.h "SopTautology.h"
+/// @brief SopCover のトートロジー判定を行うためのクラス
+///
+/// unate recursive paradigm に基づいて判定する．
+/// - 空のキューブを含んでいたら tautology
+/// - 最小項の数の和が足りなければ tautology ではない．
+/// - unate な変数のリテラルを含むキューブは取り除く(unate reduction)．
+/// - 最も binate な変数で Shannon 展開して再帰する．
+///
+/// 作業領域は再帰の深さごとに確保して使い回す．
+//////////////////////////////////////////////////////////////////////
+class SopTautology :
+  public SopUrp
+{
+public:
+
+  /// @brief コンストラクタ
+  SopTautology(
+    SizeType var_num ///< [in] 変数の数
+  ) : SopUrp{var_num},
+      mFrameList(var_num + 1)
+  {
+  }
+
+  /// @brief デストラクタ
+  ~SopTautology() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief トートロジーの時 true を返す．
+  bool
+  check(
+    SizeType cube_num, ///< [in] キューブ数
+    const Chunk& chunk ///< [in] 対象のビットベクタ
+  )
+  {
+    return _taut_recur(0, cube_num, chunk);
+  }
+
+  /// @brief カバーがキューブを覆っている時 true を返す．
+  ///
+  /// カバーのキューブによるコファクターがトートロジーか調べる．
+  bool
+  check_covering(
+    SizeType cube_num,  ///< [in] キューブ数
+    const Chunk& chunk, ///< [in] 対象のビットベクタ
+    Cube cube           ///< [in] キューブ
+  )
+  {
+    auto num = _cofactor(cube_num, chunk, cube, mRoot);
+    return _taut_recur(0, num, mRoot);
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief トートロジー判定を行う再帰関数
+  bool
+  _taut_recur(
+    SizeType depth,    ///< [in] 再帰の深さ
+    SizeType cube_num, ///< [in] キューブ数
+    const Chunk& src   ///< [in] 対象のビットベクタ
+  );
+
+  /// @brief 最小項の数が tautology となり得るか調べる．
+  /// @return 各キューブの最小項数の和が全体の最小項数以上なら true を返す．
+  ///
+  /// false の場合は tautology ではない．
+  bool
+  _check_minterm_num(
+    SizeType cube_num, ///< [in] キューブ数
+    const Chunk& src   ///< [in] 対象のビットベクタ
+  ) const;
+
+  /// @brief unate な変数のリテラルを含むキューブを取り除く．
+  /// @return 結果のキューブ数を返す．
+  ///
+  /// _select_var() の直後に呼ばなければならない．
+  SizeType
+  _unate_reduction(
+    SizeType cube_num, ///< [in] キューブ数
+    const Chunk& src,  ///< [in] 対象のビットベクタ
+    Chunk& dst         ///< [out] 結果を格納するビットベクタ
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 再帰の深さごとの作業領域
+  // 展開(もしくは unate reduction)のたびに変数が1つ以上減るので
+  // 深さは変数の数で抑えられる．
+  std::vector<Chunk> mFrameList;
+
+  // check_covering() 用のコファクター
+  Chunk mRoot;
+
+  // unate reduction 用のマスク
+  Chunk mMask;
+
+};
+
+END_NAMESPACE_YM_SOP
+
+#endif // SOPTAUTOLOGY_H
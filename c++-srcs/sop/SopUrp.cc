@@ -0,0 +1,122 @@
+
+/// @file SopUrp.cc
+/// @brief SopUrp の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "SopUrp.h"
+
+
+BEGIN_NAMESPACE_YM_SOP
+
+//////////////////////////////////////////////////////////////////////
+// クラス SopUrp
+//////////////////////////////////////////////////////////////////////
+
+// @brief 展開に用いる変数を選ぶ．
+SizeType
+SopUrp::_select_var(
+  SizeType cube_num,
+  const Chunk& src,
+  SopPat& upat
+)
+{
+  auto nv = variable_num();
+  std::fill(mPCount.begin(), mPCount.end(), 0);
+  std::fill(mNCount.begin(), mNCount.end(), 0);
+  for ( auto cube: _cube_list(src, 0, cube_num) ) {
+    auto cube_end = _cube_end(cube);
+    SizeType base = 0;
+    for ( auto p = cube; p != cube_end; ++ p, base += 32 ) {
+      // リテラルを含まないワードは飛ばす．
+      auto word = *p;
+      if ( word == SOP_ALL1 ) {
+	continue;
+      }
+      // 01 のパタンが正のリテラル，10 のパタンが負のリテラルを表す．
+      // 各パタンの下位ビットの位置を求めてリテラルのみを走査する．
+      auto p_bits = word & ~(word >> 1) & 0x5555555555555555ULL;
+      auto n_bits = (word >> 1) & ~word & 0x5555555555555555ULL;
+      for ( ; p_bits; p_bits &= p_bits - 1 ) {
+	auto pos = __builtin_ctzll(p_bits);
+	++ mPCount[base + 31 - pos / 2];
+      }
+      for ( ; n_bits; n_bits &= n_bits - 1 ) {
+	auto pos = __builtin_ctzll(n_bits);
+	++ mNCount[base + 31 - pos / 2];
+      }
+    }
+  }
+
+  // max(min(p_count[v], n_count[v])) となる v を求める．
+  SizeType max_c = 0;
+  SizeType max_v = nv;
+  for ( SizeType var = 0; var < nv; ++ var ) {
+    auto c = std::min(mPCount[var], mNCount[var]);
+    if ( max_c < c ) {
+      max_c = c;
+      max_v = var;
+    }
+  }
+  if ( max_v < nv ) {
+    upat = SopPat::_X;
+    return max_v;
+  }
+
+  // unate cover だった．
+  // 最もリテラル数の多い変数を選ぶ．
+  for ( SizeType var = 0; var < nv; ++ var ) {
+    auto c = mPCount[var] + mNCount[var];
+    if ( max_c < c ) {
+      max_c = c;
+      max_v = var;
+    }
+  }
+  ASSERT_COND( max_v < nv );
+  upat = mPCount[max_v] > 0 ? SopPat::_1 : SopPat::_0;
+  return max_v;
+}
+
+// @brief リテラルによるコファクターを求める．
+SizeType
+SopUrp::_cofactor(
+  SizeType cube_num,
+  const Chunk& src,
+  Literal lit,
+  Chunk& dst
+)
+{
+  _reserve(dst, cube_num);
+  auto dst_list = _cube_list(dst);
+  for ( auto cube: _cube_list(src, 0, cube_num) ) {
+    auto dst_cube = dst_list.back();
+    if ( _cube_cofactor(dst_cube, cube, lit) ) {
+      dst_list.inc();
+    }
+  }
+  return dst_list.num();
+}
+
+// @brief キューブによるコファクターを求める．
+SizeType
+SopUrp::_cofactor(
+  SizeType cube_num,
+  const Chunk& src,
+  Cube cube,
+  Chunk& dst
+)
+{
+  _reserve(dst, cube_num);
+  auto dst_list = _cube_list(dst);
+  for ( auto src_cube: _cube_list(src, 0, cube_num) ) {
+    auto dst_cube = dst_list.back();
+    if ( _cube_cofactor(dst_cube, src_cube, cube) ) {
+      dst_list.inc();
+    }
+  }
+  return dst_list.num();
+}
+
+END_NAMESPACE_YM_SOP
@@ -0,0 +1,149 @@
+#ifndef SOPURP_H
+#define SOPURP_H
+
+/// @file SopUrp.h
+/// @brief SopUrp のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "ym/SopBase.h"
+
+
+BEGIN_NAMESPACE_YM_SOP
+
+//////////////////////////////////////////////////////////////////////
+/// @class SopUrp SopUrp.h "SopUrp.h"
+/// @brief unate recursive paradigm に基づく処理の基底クラス
+///
+/// SopComplement, SopTautology に共通な下請け関数を提供する．
+//////////////////////////////////////////////////////////////////////
+class SopUrp :
+  public SopBase
+{
+public:
+
+  /// @brief コンストラクタ
+  SopUrp(
+    SizeType var_num ///< [in] 変数の数
+  ) : SopBase{var_num},
+      mPCount(var_num),
+      mNCount(var_num)
+  {
+  }
+
+  /// @brief デストラクタ
+  ~SopUrp() = default;
+
+
+protected:
+  //////////////////////////////////////////////////////////////////////
+  // 継承クラスで用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 空のキューブ(universal cube)を含む時 true を返す．
+  bool
+  _has_null_cube(
+    SizeType cube_num, ///< [in] キューブ数
+    const Chunk& src   ///< [in] 対象のビットベクタ
+  ) const
+  {
+    for ( auto cube: _cube_list(src, 0, cube_num) ) {
+      if ( _cube_check_null(cube) ) {
+	return true;
+      }
+    }
+    return false;
+  }
+
+  /// @brief 展開に用いる変数を選ぶ．
+  /// @return 変数番号を返す．
+  ///
+  /// binate な変数がある場合は min(正リテラル数, 負リテラル数) が
+  /// 最大の変数を選ぶ．
+  /// 全ての変数が unate の場合はリテラル数が最大の変数を選ぶ．
+  /// src は少なくとも1つのリテラルを含んでいなければならない．
+  SizeType
+  _select_var(
+    SizeType cube_num, ///< [in] キューブ数
+    const Chunk& src,  ///< [in] 対象のビットベクタ
+    SopPat& upat       ///< [out] unate な場合の極性
+                       ///<  - SopPat::_1: 正のリテラルのみ
+                       ///<  - SopPat::_0: 負のリテラルのみ
+                       ///<  - SopPat::_X: binate
+  );
+
+  /// @brief 正のリテラル数を返す．
+  ///
+  /// 直前の _select_var() で数えた値を返す．
+  SizeType
+  _p_count(
+    SizeType var ///< [in] 変数番号
+  ) const
+  {
+    return mPCount[var];
+  }
+
+  /// @brief 負のリテラル数を返す．
+  ///
+  /// 直前の _select_var() で数えた値を返す．
+  SizeType
+  _n_count(
+    SizeType var ///< [in] 変数番号
+  ) const
+  {
+    return mNCount[var];
+  }
+
+  /// @brief リテラルによるコファクターを求める．
+  /// @return 結果のキューブ数を返す．
+  SizeType
+  _cofactor(
+    SizeType cube_num, ///< [in] キューブ数
+    const Chunk& src,  ///< [in] 対象のビットベクタ
+    Literal lit,       ///< [in] リテラル
+    Chunk& dst         ///< [out] 結果を格納するビットベクタ
+  );
+
+  /// @brief キューブによるコファクターを求める．
+  /// @return 結果のキューブ数を返す．
+  SizeType
+  _cofactor(
+    SizeType cube_num, ///< [in] キューブ数
+    const Chunk& src,  ///< [in] 対象のビットベクタ
+    Cube cube,         ///< [in] キューブ
+    Chunk& dst         ///< [out] 結果を格納するビットベクタ
+  );
+
+  /// @brief dst が cube_num 個のキューブを格納できるようにする．
+  void
+  _reserve(
+    Chunk& dst,       ///< [in] 対象のビットベクタ
+    SizeType cube_num ///< [in] キューブ数
+  ) const
+  {
+    auto size = _cube_size() * cube_num;
+    if ( dst.size() < size ) {
+      dst.resize(size, SOP_ALL1);
+    }
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 変数ごとの正のリテラル数
+  std::vector<SizeType> mPCount;
+
+  // 変数ごとの負のリテラル数
+  std::vector<SizeType> mNCount;
+
+};
+
+END_NAMESPACE_YM_SOP
+
+#endif // SOPURP_H
@@ -2548,6 +2548,344 @@ TEST_F(SopTest, cofactor_int_lit_bad)
   EXPECT_THROW( cover1.cofactor_int(lit100), std::out_of_range );
 }
 
+BEGIN_NONAMESPACE
+
+// ランダムなカバーを作る．
+//
+// var_map[i] を i 番目の変数として用いる．
+std::vector<std::vector<Literal>>
+random_cover(
+  const std::vector<SizeType>& var_map,
+  SizeType cube_num,
+  std::mt19937& rg
+)
+{
+  std::uniform_int_distribution<int> rd(0, 3);
+  std::vector<std::vector<Literal>> cube_list(cube_num);
+  for ( auto& lits: cube_list ) {
+    for ( auto var: var_map ) {
+      // 1/2 の確率でリテラルを含まない．
+      auto r = rd(rg);
+      if ( r < 2 ) {
+	lits.push_back(Literal{var, r == 1});
+      }
+    }
+  }
+  return cube_list;
+}
+
+END_NONAMESPACE
+
+TEST_F(SopTest, complement1)
+{
+  auto cover1 = SopCover{nv, { { lit0, ~lit2},
+			       { lit1, ~lit3} }};
+
+  auto cover2 = cover1.complement();
+  EXPECT_EQ( ~cover1.tvfunc(), cover2.tvfunc() );
+}
+
+TEST_F(SopTest, complement2)
+{
+  // 空のカバーの否定は tautology
+  auto cover1 = SopCover{nv};
+  auto cover2 = cover1.complement();
+  ASSERT_EQ( 1, cover2.cube_num() );
+  EXPECT_EQ( 0, cover2.literal_num() );
+
+  // tautology の否定は空
+  auto cover3 = cover2.complement();
+  EXPECT_EQ( 0, cover3.cube_num() );
+
+  // キューブの否定はリテラルの否定の和
+  auto cover4 = SopCover{nv, { { lit0, ~lit5, lit9} }};
+  auto cover5 = cover4.complement();
+  EXPECT_EQ( 3, cover5.cube_num() );
+  EXPECT_EQ( 3, cover5.literal_num() );
+  EXPECT_EQ( ~cover4.tvfunc(), cover5.tvfunc() );
+}
+
+TEST_F(SopTest, complement3)
+{
+  // x0 + ~x0 の否定は空
+  auto cover1 = SopCover{nv, { { lit0, lit1},
+			       { lit0, ~lit1},
+			       {~lit0} }};
+  auto cover2 = cover1.complement();
+  EXPECT_EQ( 0, cover2.cube_num() );
+}
+
+TEST_F(SopTest, complement_random)
+{
+  std::mt19937 rg;
+  std::vector<SizeType> var_map(nv);
+  for ( SizeType i = 0; i < nv; ++ i ) {
+    var_map[i] = i;
+  }
+  for ( SizeType cube_num: {2, 5, 10, 20, 40} ) {
+    for ( SizeType c = 0; c < 20; ++ c ) {
+      auto cover1 = SopCover{nv, random_cover(var_map, cube_num, rg)};
+      auto cover2 = cover1.complement();
+      EXPECT_EQ( ~cover1.tvfunc(), cover2.tvfunc() );
+    }
+  }
+}
+
+TEST_F(SopTest, complement_wide)
+{
+  // 2ワードにまたがるキューブで試す．
+  SizeType nv2 = 40;
+  std::vector<SizeType> var_map2(nv);
+  std::vector<SizeType> rev_map(nv2);
+  for ( SizeType i = 0; i < nv; ++ i ) {
+    var_map2[i] = i < 5 ? i : i + 30;
+    rev_map[var_map2[i]] = i;
+  }
+  std::mt19937 rg;
+  for ( SizeType c = 0; c < 20; ++ c ) {
+    auto cube_list = random_cover(var_map2, 20, rg);
+    auto cover1 = SopCover{nv2, cube_list};
+    auto cover2 = cover1.complement();
+    // cover2 を nv 変数の関数に戻して比較する．
+    for ( auto& lits: cube_list ) {
+      for ( auto& lit: lits ) {
+	lit = Literal{rev_map[lit.varid()], lit.is_negative()};
+      }
+    }
+    auto func1 = SopCover{nv, cube_list}.tvfunc();
+    auto lits_list = cover2.literal_list();
+    for ( auto& lits: lits_list ) {
+      for ( auto& lit: lits ) {
+	lit = Literal{rev_map[lit.varid()], lit.is_negative()};
+      }
+    }
+    auto func2 = SopCover{nv, lits_list}.tvfunc();
+    EXPECT_EQ( ~func1, func2 );
+  }
+}
+
+TEST_F(SopTest, is_tautology1)
+{
+  // 空のカバーは tautology ではない．
+  EXPECT_FALSE( SopCover{nv}.is_tautology() );
+
+  // 空のキューブを含むカバーは tautology
+  auto cover1 = SopCover{nv, { {}, { lit0, lit1} }};
+  EXPECT_TRUE( cover1.is_tautology() );
+
+  auto cover2 = SopCover{nv, { { lit0, lit1},
+			       { lit0, ~lit1},
+			       {~lit0} }};
+  EXPECT_TRUE( cover2.is_tautology() );
+
+  auto cover3 = SopCover{nv, { { lit0, lit1},
+			       {~lit0, ~lit1} }};
+  EXPECT_FALSE( cover3.is_tautology() );
+}
+
+TEST_F(SopTest, is_tautology_random)
+{
+  std::mt19937 rg;
+  SizeType nv = 6;
+  std::vector<SizeType> var_map(nv);
+  for ( SizeType i = 0; i < nv; ++ i ) {
+    var_map[i] = i;
+  }
+  SizeType n_taut = 0;
+  for ( SizeType cube_num: {5, 10, 20, 40} ) {
+    for ( SizeType c = 0; c < 50; ++ c ) {
+      auto cover1 = SopCover{nv, random_cover(var_map, cube_num, rg)};
+      auto exp_val = cover1.tvfunc().is_one();
+      EXPECT_EQ( exp_val, cover1.is_tautology() );
+      if ( exp_val ) {
+	++ n_taut;
+      }
+    }
+  }
+  // tautology になる場合も調べられていることを確認する．
+  EXPECT_LT( 0, n_taut );
+}
+
+TEST_F(SopTest, check_covering1)
+{
+  auto cover1 = SopCover{nv, { { lit0, lit1},
+			       {~lit0, lit2} }};
+  // consensus
+  EXPECT_TRUE( cover1.check_covering(SopCube{nv, {lit1, lit2}}) );
+  EXPECT_FALSE( cover1.check_covering(SopCube{nv, {lit1}}) );
+
+  EXPECT_THROW( cover1.check_covering(SopCube{nv + 1}), std::invalid_argument );
+}
+
+TEST_F(SopTest, check_containment1)
+{
+  auto cover1 = SopCover{nv, { { lit0, lit1},
+			       {~lit0, lit2} }};
+  auto cover2 = SopCover{nv, { { lit1, lit2},
+			       { lit0, lit1, lit3} }};
+  EXPECT_TRUE( cover2.check_containment(cover1) );
+  EXPECT_FALSE( cover1.check_containment(cover2) );
+
+  EXPECT_TRUE( cover2.check_containment(SopCube{nv, {lit1}}) );
+  EXPECT_FALSE( cover2.check_containment(SopCube{nv, {lit0}}) );
+}
+
+TEST_F(SopTest, check_containment_random)
+{
+  std::mt19937 rg;
+  std::vector<SizeType> var_map(nv);
+  for ( SizeType i = 0; i < nv; ++ i ) {
+    var_map[i] = i;
+  }
+  for ( SizeType c = 0; c < 100; ++ c ) {
+    auto cover1 = SopCover{nv, random_cover(var_map, 20, rg)};
+    auto cover2 = SopCover{nv, random_cover(var_map, 2, rg)};
+    auto func1 = cover1.tvfunc();
+    auto func2 = cover2.tvfunc();
+    EXPECT_EQ( func2.check_containment(func1), cover2.check_containment(cover1) );
+    for ( SizeType i = 0; i < cover2.cube_num(); ++ i ) {
+      auto cube = cover2.get_cube(i);
+      EXPECT_EQ( cube.tvfunc().check_containment(func1), cover1.check_covering(cube) );
+    }
+  }
+}
+
+TEST_F(SopTest, scc1)
+{
+  auto cover1 = SopCover{nv, { { lit0},
+			       { lit0, lit1},
+			       { lit0, ~lit2},
+			       { lit1, lit2},
+			       { lit1, lit2, lit3} }};
+  auto cover2 = cover1.scc();
+  EXPECT_EQ( 2, cover2.cube_num() );
+  EXPECT_EQ( (SopCover{nv, { {lit0}, {lit1, lit2} }}), cover2 );
+
+  cover1.scc_int();
+  EXPECT_EQ( cover2, cover1 );
+}
+
+TEST_F(SopTest, scc_random)
+{
+  std::mt19937 rg;
+  std::vector<SizeType> var_map(nv);
+  for ( SizeType i = 0; i < nv; ++ i ) {
+    var_map[i] = i;
+  }
+  for ( SizeType c = 0; c < 100; ++ c ) {
+    auto cover1 = SopCover{nv, random_cover(var_map, 40, rg)};
+    auto cover2 = cover1.scc();
+    EXPECT_EQ( cover1.tvfunc(), cover2.tvfunc() );
+    // 他のキューブに包含されるキューブは残っていない．
+    auto n = cover2.cube_num();
+    for ( SizeType i1 = 0; i1 < n; ++ i1 ) {
+      auto cube1 = cover2.get_cube(i1);
+      for ( SizeType i2 = 0; i2 < n; ++ i2 ) {
+	if ( i2 != i1 ) {
+	  EXPECT_FALSE( cube1.check_containment(cover2.get_cube(i2)) );
+	}
+      }
+    }
+    // 元のキューブは残ったキューブのいずれかに包含されている．
+    for ( SizeType i1 = 0; i1 < cover1.cube_num(); ++ i1 ) {
+      auto cube1 = cover1.get_cube(i1);
+      bool found = false;
+      for ( SizeType i2 = 0; i2 < n; ++ i2 ) {
+	if ( cube1.check_containment(cover2.get_cube(i2)) ) {
+	  found = true;
+	  break;
+	}
+      }
+      EXPECT_TRUE( found );
+    }
+  }
+}
+
+TEST_F(SopTest, minimize1)
+{
+  auto cover1 = SopCover{nv, { { lit0,  lit1},
+			       { lit0, ~lit1},
+			       {~lit0,  lit1, lit2} }};
+  auto cover2 = cover1.minimize();
+  EXPECT_EQ( (SopCover{nv, { {lit0}, {lit1, lit2} }}), cover2 );
+
+  // 空のカバーと tautology
+  EXPECT_EQ( 0, SopCover{nv}.minimize().cube_num() );
+  auto cover3 = SopCover{nv, { { lit0}, {~lit0} }}.minimize();
+  EXPECT_EQ( 1, cover3.cube_num() );
+  EXPECT_EQ( 0, cover3.literal_num() );
+}
+
+TEST_F(SopTest, minimize_dc)
+{
+  auto cover1 = SopCover{nv, { { lit0, lit1} }};
+  auto dc = SopCover{nv, { { lit0, ~lit1} }};
+  auto cover2 = cover1.minimize(dc);
+  EXPECT_EQ( (SopCover{nv, { {lit0} }}), cover2 );
+
+  EXPECT_THROW( cover1.minimize(SopCover{nv + 1}), std::invalid_argument );
+}
+
+TEST_F(SopTest, minimize_random)
+{
+  std::mt19937 rg;
+  std::vector<SizeType> var_map(nv);
+  for ( SizeType i = 0; i < nv; ++ i ) {
+    var_map[i] = i;
+  }
+  for ( SizeType cube_num: {5, 20, 40} ) {
+    for ( SizeType c = 0; c < 20; ++ c ) {
+      auto cover1 = SopCover{nv, random_cover(var_map, cube_num, rg)};
+      auto cover2 = cover1.minimize();
+      EXPECT_EQ( cover1.tvfunc(), cover2.tvfunc() );
+      auto cover3 = cover1.scc();
+      EXPECT_LE( cover2.cube_num(), cover3.cube_num() );
+
+      auto dc = SopCover{nv, random_cover(var_map, 3, rg)};
+      auto cover4 = cover1.minimize(dc);
+      auto func1 = cover1.tvfunc();
+      auto func_dc = dc.tvfunc();
+      auto func4 = cover4.tvfunc();
+      EXPECT_TRUE( (func1 & ~func_dc).check_containment(func4) );
+      EXPECT_TRUE( func4.check_containment(func1 | func_dc) );
+    }
+  }
+}
+
+TEST_F(SopTest, minimize_wide)
+{
+  // 2ワードにまたがるキューブで試す．
+  SizeType nv2 = 40;
+  std::vector<SizeType> var_map2(nv);
+  std::vector<SizeType> rev_map(nv2);
+  for ( SizeType i = 0; i < nv; ++ i ) {
+    var_map2[i] = i < 5 ? i : i + 30;
+    rev_map[var_map2[i]] = i;
+  }
+  std::mt19937 rg;
+  for ( SizeType c = 0; c < 20; ++ c ) {
+    auto cube_list = random_cover(var_map2, 20, rg);
+    auto cover1 = SopCover{nv2, cube_list};
+    auto cover2 = cover1.minimize();
+    EXPECT_LE( cover2.cube_num(), cover1.cube_num() );
+    // nv 変数の関数に戻して比較する．
+    for ( auto& lits: cube_list ) {
+      for ( auto& lit: lits ) {
+	lit = Literal{rev_map[lit.varid()], lit.is_negative()};
+      }
+    }
+    auto func1 = SopCover{nv, cube_list}.tvfunc();
+    auto lits_list = cover2.literal_list();
+    for ( auto& lits: lits_list ) {
+      for ( auto& lit: lits ) {
+	lit = Literal{rev_map[lit.varid()], lit.is_negative()};
+      }
+    }
+    auto func2 = SopCover{nv, lits_list}.tvfunc();
+    EXPECT_EQ( func1, func2 );
+  }
+}
+
 // ソートのテスト
 TEST_F(SopTest, sort1)
 {
@@ -0,0 +1,217 @@
+/// @file SopKernelTest.cc
+/// @brief SopKernel のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "SopKernel.h"
+#include "ym/SopCover.h"
+#include "ym/SopCube.h"
+#include <random>
+
+
+BEGIN_NAMESPACE_YM_SOP
+
+class SopKernelTest :
+  public ::testing::TestWithParam<SopKernel::Impl>
+{
+public:
+
+  void
+  SetUp() override
+  {
+    mOrigImpl = SopKernel::impl();
+    if ( !SopKernel::is_supported(GetParam()) ) {
+      GTEST_SKIP() << SopKernel::impl_name(GetParam())
+		   << " is not supported";
+    }
+    SopKernel::set_impl(GetParam());
+  }
+
+  void
+  TearDown() override
+  {
+    SopKernel::set_impl(mOrigImpl);
+  }
+
+  /// @brief ランダムなキューブ列を作る．
+  ///
+  /// 各変数は 1/4 の確率でリテラルとなる．
+  std::vector<SopPatWord>
+  random_cubes(
+    SizeType cube_num,
+    SizeType cube_size
+  )
+  {
+    std::vector<SopPatWord> vec(cube_num * cube_size);
+    for ( auto& w: vec ) {
+      w = SOP_ALL1;
+      for ( SizeType pos = 0; pos < 64; pos += 2 ) {
+	switch ( mRandGen() % 8 ) {
+	case 0: w &= ~(2ULL << pos); break;
+	case 1: w &= ~(1ULL << pos); break;
+	default: break;
+	}
+      }
+    }
+    return vec;
+  }
+
+  SopKernel::Impl mOrigImpl;
+
+  std::mt19937_64 mRandGen;
+
+};
+
+TEST_P(SopKernelTest, literal_num)
+{
+  // 端数の処理を確かめるために長さを変えて調べる．
+  for ( SizeType n = 0; n < 40; ++ n ) {
+    auto vec = random_cubes(n, 1);
+    SizeType exp_n = 0;
+    for ( auto w: vec ) {
+      for ( SizeType pos = 0; pos < 64; pos += 2 ) {
+	auto pat = (w >> pos) & 3ULL;
+	if ( pat == 1ULL || pat == 2ULL ) {
+	  ++ exp_n;
+	}
+      }
+    }
+    EXPECT_EQ( exp_n, SopKernel::literal_num(vec.data(), n) );
+  }
+}
+
+TEST_P(SopKernelTest, product)
+{
+  // ベクタに詰められるサイズと詰められないサイズを調べる．
+  for ( SizeType cs = 1; cs <= 9; ++ cs ) {
+    for ( SizeType n = 0; n < 30; ++ n ) {
+      auto src = random_cubes(n, cs);
+      auto cube = random_cubes(1, cs);
+      std::vector<SopPatWord> exp_dst;
+      for ( SizeType i = 0; i < n; ++ i ) {
+	std::vector<SopPatWord> tmp(cs);
+	bool ok = true;
+	for ( SizeType k = 0; k < cs; ++ k ) {
+	  tmp[k] = src[i * cs + k] & cube[k];
+	  auto t = tmp[k] | (tmp[k] >> 1);
+	  if ( (t & 0x5555555555555555ULL) != 0x5555555555555555ULL ) {
+	    ok = false;
+	  }
+	}
+	if ( ok ) {
+	  exp_dst.insert(exp_dst.end(), tmp.begin(), tmp.end());
+	}
+      }
+      std::vector<SopPatWord> dst(n * cs);
+      auto num = SopKernel::product(dst.data(), src.data(), n, cs, cube.data());
+      ASSERT_EQ( exp_dst.size(), num * cs );
+      dst.resize(num * cs);
+      EXPECT_EQ( exp_dst, dst );
+
+      // dst と src が同じ場合
+      auto num2 = SopKernel::product(src.data(), src.data(), n, cs, cube.data());
+      ASSERT_EQ( num, num2 );
+      src.resize(num2 * cs);
+      EXPECT_EQ( exp_dst, src );
+    }
+  }
+}
+
+TEST_P(SopKernelTest, algdiv)
+{
+  for ( SizeType cs = 1; cs <= 9; ++ cs ) {
+    for ( SizeType n = 0; n < 30; ++ n ) {
+      // 割り切れるキューブが現れるように除数のリテラルは少なくする．
+      auto src = random_cubes(n, cs);
+      auto cube = random_cubes(1, cs);
+      for ( auto& w: cube ) {
+	w |= random_cubes(1, 1)[0] | random_cubes(1, 1)[0];
+      }
+      for ( SizeType i = 0; i < n; i += 2 ) {
+	for ( SizeType k = 0; k < cs; ++ k ) {
+	  src[i * cs + k] &= cube[k];
+	}
+      }
+      std::vector<SopPatWord> exp_dst;
+      for ( SizeType i = 0; i < n; ++ i ) {
+	std::vector<SopPatWord> tmp(cs);
+	bool ok = true;
+	for ( SizeType k = 0; k < cs; ++ k ) {
+	  auto pat1 = src[i * cs + k];
+	  auto pat2 = cube[k];
+	  if ( (pat1 & ~pat2) != SOP_ALL0 ) {
+	    ok = false;
+	  }
+	  tmp[k] = pat1 | ~pat2;
+	}
+	if ( ok ) {
+	  exp_dst.insert(exp_dst.end(), tmp.begin(), tmp.end());
+	}
+      }
+      std::vector<SopPatWord> dst(n * cs);
+      auto num = SopKernel::algdiv(dst.data(), src.data(), n, cs, cube.data());
+      ASSERT_EQ( exp_dst.size(), num * cs );
+      dst.resize(num * cs);
+      EXPECT_EQ( exp_dst, dst );
+
+      // dst と src が同じ場合
+      auto num2 = SopKernel::algdiv(src.data(), src.data(), n, cs, cube.data());
+      ASSERT_EQ( num, num2 );
+      src.resize(num2 * cs);
+      EXPECT_EQ( exp_dst, src );
+    }
+  }
+}
+
+TEST_P(SopKernelTest, cover)
+{
+  // SopCover の演算がスカラー版と同じ結果になることを確かめる．
+  // キューブが2ワードになるようにする．
+  const SizeType nv = 60;
+  std::uniform_int_distribution<SizeType> rv(0, nv - 1);
+  std::uniform_int_distribution<int> rn(1, 5);
+  auto random_cover = [&](SizeType cube_num) {
+    std::vector<std::vector<Literal>> cube_list(cube_num);
+    for ( auto& lits: cube_list ) {
+      std::vector<bool> used(nv, false);
+      auto n = rn(mRandGen);
+      for ( int i = 0; i < n; ++ i ) {
+	auto var = rv(mRandGen);
+	if ( !used[var] ) {
+	  used[var] = true;
+	  lits.push_back(Literal{var, (mRandGen() % 2) == 1});
+	}
+      }
+    }
+    return SopCover{nv, cube_list};
+  };
+  for ( SizeType c = 0; c < 20; ++ c ) {
+    auto cover1 = random_cover(50);
+    auto cover2 = random_cover(5);
+    auto cube = cover1.get_cube(0);
+    auto lit = Literal{rv(mRandGen), false};
+    auto prod = cover1 & cover2;
+    auto prod_lit = cover1 & lit;
+    auto quo = cover1.algdiv(cube);
+    auto quo_lit = cover1.algdiv(lit);
+    auto lit_num = cover1.literal_num();
+    SopKernel::set_impl(SopKernel::Impl::Scalar);
+    EXPECT_EQ( cover1 & cover2, prod );
+    EXPECT_EQ( cover1 & lit, prod_lit );
+    EXPECT_EQ( cover1.algdiv(cube), quo );
+    EXPECT_EQ( cover1.algdiv(lit), quo_lit );
+    EXPECT_EQ( cover1.literal_num(), lit_num );
+    SopKernel::set_impl(GetParam());
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllImpl,
+			 SopKernelTest,
+			 ::testing::Values(SopKernel::Impl::Scalar,
+					   SopKernel::Impl::Avx2,
+					   SopKernel::Impl::Avx512));
+
+END_NAMESPACE_YM_SOP
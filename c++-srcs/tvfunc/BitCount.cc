@@ -0,0 +1,382 @@
+
+/// @file BitCount.cc
+/// @brief BitCount の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "BitCount.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BITCOUNT_X86 1
+#include <immintrin.h>
+#else
+#define BITCOUNT_X86 0
+#endif
+
+
+BEGIN_NAMESPACE_YM
+
+BEGIN_NONAMESPACE
+
+using WordType = BitCount::WordType;
+
+//////////////////////////////////////////////////////////////////////
+// シフトとマスクによる実装
+//////////////////////////////////////////////////////////////////////
+
+SizeType
+count_scalar(
+  const WordType* vec,
+  SizeType n
+)
+{
+  SizeType ans = 0;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    ans += BitCount::count_scalar(vec[i]);
+  }
+  return ans;
+}
+
+SizeType
+count_xor_scalar(
+  const WordType* vec,
+  SizeType n,
+  WordType mask
+)
+{
+  SizeType ans = 0;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    ans += BitCount::count_scalar(vec[i] ^ mask);
+  }
+  return ans;
+}
+
+#if BITCOUNT_X86
+
+//////////////////////////////////////////////////////////////////////
+// POPCNT 命令による実装
+//////////////////////////////////////////////////////////////////////
+
+__attribute__((target("popcnt")))
+SizeType
+count_popcnt(
+  const WordType* vec,
+  SizeType n
+)
+{
+  SizeType ans = 0;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    ans += __builtin_popcountll(vec[i]);
+  }
+  return ans;
+}
+
+__attribute__((target("popcnt")))
+SizeType
+count_xor_popcnt(
+  const WordType* vec,
+  SizeType n,
+  WordType mask
+)
+{
+  SizeType ans = 0;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    ans += __builtin_popcountll(vec[i] ^ mask);
+  }
+  return ans;
+}
+
+//////////////////////////////////////////////////////////////////////
+// AVX2 による実装
+//
+// 4ビットごとの1の数を VPSHUFB で表引きして VPSADBW で足し合わせる．
+//////////////////////////////////////////////////////////////////////
+
+__attribute__((target("avx2")))
+inline
+__m256i
+popcount256(
+  __m256i v
+)
+{
+  const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+					  1, 2, 2, 3, 2, 3, 3, 4,
+					  0, 1, 1, 2, 1, 2, 2, 3,
+					  1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i low_mask = _mm256_set1_epi8(0x0F);
+  auto lo = _mm256_and_si256(v, low_mask);
+  auto hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+  auto cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+			     _mm256_shuffle_epi8(lookup, hi));
+  return _mm256_sad_epu8(cnt, _mm256_setzero_si256());
+}
+
+__attribute__((target("avx2")))
+inline
+SizeType
+reduce256(
+  __m256i acc
+)
+{
+  return _mm256_extract_epi64(acc, 0) + _mm256_extract_epi64(acc, 1)
+    + _mm256_extract_epi64(acc, 2) + _mm256_extract_epi64(acc, 3);
+}
+
+__attribute__((target("avx2,popcnt")))
+SizeType
+count_avx2(
+  const WordType* vec,
+  SizeType n
+)
+{
+  auto acc = _mm256_setzero_si256();
+  SizeType i = 0;
+  for ( ; i + 4 <= n; i += 4 ) {
+    auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(vec + i));
+    acc = _mm256_add_epi64(acc, popcount256(v));
+  }
+  SizeType ans = reduce256(acc);
+  for ( ; i < n; ++ i ) {
+    ans += __builtin_popcountll(vec[i]);
+  }
+  return ans;
+}
+
+__attribute__((target("avx2,popcnt")))
+SizeType
+count_xor_avx2(
+  const WordType* vec,
+  SizeType n,
+  WordType mask
+)
+{
+  auto acc = _mm256_setzero_si256();
+  auto vmask = _mm256_set1_epi64x(static_cast<long long>(mask));
+  SizeType i = 0;
+  for ( ; i + 4 <= n; i += 4 ) {
+    auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(vec + i));
+    acc = _mm256_add_epi64(acc, popcount256(_mm256_xor_si256(v, vmask)));
+  }
+  SizeType ans = reduce256(acc);
+  for ( ; i < n; ++ i ) {
+    ans += __builtin_popcountll(vec[i] ^ mask);
+  }
+  return ans;
+}
+
+//////////////////////////////////////////////////////////////////////
+// AVX-512 VPOPCNTQ による実装
+//
+// 端数はマスク付きのロードで処理する．
+//////////////////////////////////////////////////////////////////////
+
+__attribute__((target("avx512f,avx512vpopcntdq")))
+SizeType
+count_avx512(
+  const WordType* vec,
+  SizeType n
+)
+{
+  auto acc = _mm512_setzero_si512();
+  SizeType i = 0;
+  for ( ; i + 8 <= n; i += 8 ) {
+    auto v = _mm512_loadu_si512(vec + i);
+    acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+  }
+  if ( i < n ) {
+    __mmask8 k = static_cast<__mmask8>((1U << (n - i)) - 1U);
+    auto v = _mm512_maskz_loadu_epi64(k, vec + i);
+    acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+  }
+  return _mm512_reduce_add_epi64(acc);
+}
+
+__attribute__((target("avx512f,avx512vpopcntdq")))
+SizeType
+count_xor_avx512(
+  const WordType* vec,
+  SizeType n,
+  WordType mask
+)
+{
+  auto acc = _mm512_setzero_si512();
+  auto vmask = _mm512_set1_epi64(static_cast<long long>(mask));
+  SizeType i = 0;
+  for ( ; i + 8 <= n; i += 8 ) {
+    auto v = _mm512_loadu_si512(vec + i);
+    acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(_mm512_xor_si512(v, vmask)));
+  }
+  if ( i < n ) {
+    // 読み込まなかった要素は 0 のままにしておく．
+    __mmask8 k = static_cast<__mmask8>((1U << (n - i)) - 1U);
+    auto v = _mm512_maskz_loadu_epi64(k, vec + i);
+    v = _mm512_maskz_xor_epi64(k, v, vmask);
+    acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+  }
+  return _mm512_reduce_add_epi64(acc);
+}
+
+#endif // BITCOUNT_X86
+
+// ベクトル命令を用いる最小のワード数
+// これより短い場合には準備のコストの方が大きい．
+const SizeType VECTOR_MIN = 8;
+
+// 実装ごとの関数の組
+//
+// mSmallXXX は VECTOR_MIN より短い場合に用いる．
+struct Kernel
+{
+  BitCount::Impl mImpl;
+  SizeType (*mCount)(const WordType*, SizeType);
+  SizeType (*mCountXor)(const WordType*, SizeType, WordType);
+  SizeType (*mSmallCount)(const WordType*, SizeType);
+  SizeType (*mSmallCountXor)(const WordType*, SizeType, WordType);
+};
+
+Kernel
+get_kernel(
+  BitCount::Impl impl
+)
+{
+  switch ( impl ) {
+#if BITCOUNT_X86
+  case BitCount::Impl::Avx512:
+    return Kernel{impl, count_avx512, count_xor_avx512,
+		  count_popcnt, count_xor_popcnt};
+  case BitCount::Impl::Avx2:
+    return Kernel{impl, count_avx2, count_xor_avx2,
+		  count_popcnt, count_xor_popcnt};
+  case BitCount::Impl::Popcnt:
+    return Kernel{impl, count_popcnt, count_xor_popcnt,
+		  count_popcnt, count_xor_popcnt};
+#endif
+  default:
+    break;
+  }
+  return Kernel{BitCount::Impl::Scalar, count_scalar, count_xor_scalar,
+		count_scalar, count_xor_scalar};
+}
+
+// 使える実装のうち最も速いものを選ぶ．
+Kernel
+best_kernel()
+{
+  for ( auto impl: {BitCount::Impl::Avx512,
+		    BitCount::Impl::Avx2,
+		    BitCount::Impl::Popcnt} ) {
+    if ( BitCount::is_supported(impl) ) {
+      return get_kernel(impl);
+    }
+  }
+  return get_kernel(BitCount::Impl::Scalar);
+}
+
+// 現在の実装
+Kernel&
+cur_kernel()
+{
+  static Kernel kernel = best_kernel();
+  return kernel;
+}
+
+END_NONAMESPACE
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス BitCount
+//////////////////////////////////////////////////////////////////////
+
+// @brief ワード列の1のビットを数える．
+SizeType
+BitCount::count(
+  const WordType* vec,
+  SizeType n
+)
+{
+  auto& kernel = cur_kernel();
+  if ( n < VECTOR_MIN ) {
+    return (*kernel.mSmallCount)(vec, n);
+  }
+  return (*kernel.mCount)(vec, n);
+}
+
+// @brief ワード列とマスクの排他的論理和の1のビットを数える．
+SizeType
+BitCount::count_xor(
+  const WordType* vec,
+  SizeType n,
+  WordType mask
+)
+{
+  auto& kernel = cur_kernel();
+  if ( n < VECTOR_MIN ) {
+    return (*kernel.mSmallCountXor)(vec, n, mask);
+  }
+  return (*kernel.mCountXor)(vec, n, mask);
+}
+
+// @brief 現在用いている実装を返す．
+BitCount::Impl
+BitCount::impl()
+{
+  return cur_kernel().mImpl;
+}
+
+// @brief 用いる実装を設定する．
+void
+BitCount::set_impl(
+  Impl impl
+)
+{
+  if ( !is_supported(impl) ) {
+    throw std::invalid_argument{"BitCount: not supported"};
+  }
+  cur_kernel() = get_kernel(impl);
+}
+
+// @brief 実装が使えるか調べる．
+bool
+BitCount::is_supported(
+  Impl impl
+)
+{
+  switch ( impl ) {
+  case Impl::Scalar:
+    return true;
+#if BITCOUNT_X86
+  case Impl::Popcnt:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("popcnt");
+  case Impl::Avx2:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+  case Impl::Avx512:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512f") &&
+      __builtin_cpu_supports("avx512vpopcntdq");
+#endif
+  default:
+    break;
+  }
+  return false;
+}
+
+// @brief 実装の名前を返す．
+const char*
+BitCount::impl_name(
+  Impl impl
+)
+{
+  switch ( impl ) {
+  case Impl::Scalar: return "scalar";
+  case Impl::Popcnt: return "popcnt";
+  case Impl::Avx2:   return "avx2";
+  case Impl::Avx512: return "avx512";
+  }
+  return "";
+}
+
+END_NAMESPACE_YM
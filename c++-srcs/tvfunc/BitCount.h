@@ -0,0 +1,134 @@
+#ifndef BITCOUNT_H
+#define BITCOUNT_H
+
+/// @file BitCount.h
+/// @brief BitCount のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+
+
+BEGIN_NAMESPACE_YM
+
+//////////////////////////////////////////////////////////////////////
+/// @class BitCount BitCount.h "BitCount.h"
+/// @brief 64ビットワードの列の1のビットを数える関数群
+///
+/// ワード列を対象とする関数は実行時に CPU の機能を調べて
+/// 以下の実装の中から使えるものを選ぶ．
+/// - Avx512: AVX-512 の VPOPCNTQ 命令を用いる．
+/// - Avx2:   AVX2 の VPSHUFB 命令による表引きを用いる．
+/// - Popcnt: POPCNT 命令を用いる．
+/// - Scalar: シフトとマスクによる計算を用いる．
+/// ただし，ワード数が少ない場合には Avx512, Avx2 でも POPCNT 命令を用いる．
+///
+/// 1ワードを対象とする count() はインライン関数で，
+/// コンパイル時に POPCNT 命令が使える場合のみそれを用いる．
+//////////////////////////////////////////////////////////////////////
+class BitCount
+{
+public:
+
+  using WordType = std::uint64_t;
+
+  /// @brief 実装の種類
+  enum class Impl {
+    Scalar,
+    Popcnt,
+    Avx2,
+    Avx512
+  };
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 1ワードの1のビットを数える．
+  static
+  int
+  count(
+    WordType word ///< [in] 対象のワード
+  )
+  {
+#if defined(__POPCNT__)
+    return __builtin_popcountll(word);
+#else
+    return count_scalar(word);
+#endif
+  }
+
+  /// @brief ワード列の1のビットを数える．
+  static
+  SizeType
+  count(
+    const WordType* vec, ///< [in] ワード列の先頭
+    SizeType n           ///< [in] ワード数
+  );
+
+  /// @brief ワード列とマスクの排他的論理和の1のビットを数える．
+  ///
+  /// 全てのワードに同じ mask との排他的論理和を取る．
+  static
+  SizeType
+  count_xor(
+    const WordType* vec, ///< [in] ワード列の先頭
+    SizeType n,          ///< [in] ワード数
+    WordType mask        ///< [in] マスク
+  );
+
+  /// @brief 現在用いている実装を返す．
+  static
+  Impl
+  impl();
+
+  /// @brief 用いる実装を設定する．
+  ///
+  /// 使えない実装を指定した場合には std::invalid_argument 例外を送出する．
+  /// 主に性能評価とテストのための関数
+  static
+  void
+  set_impl(
+    Impl impl ///< [in] 実装の種類
+  );
+
+  /// @brief 実装が使えるか調べる．
+  static
+  bool
+  is_supported(
+    Impl impl ///< [in] 実装の種類
+  );
+
+  /// @brief 実装の名前を返す．
+  static
+  const char*
+  impl_name(
+    Impl impl ///< [in] 実装の種類
+  );
+
+  /// @brief シフトとマスクで1ワードの1のビットを数える．
+  static
+  int
+  count_scalar(
+    WordType word ///< [in] 対象のワード
+  )
+  {
+    const WordType mask1  = 0x5555555555555555ULL;
+    const WordType mask2  = 0x3333333333333333ULL;
+    const WordType mask4  = 0x0F0F0F0F0F0F0F0FULL;
+
+    word = (word & mask1) + ((word >> 1) & mask1);
+    word = (word & mask2) + ((word >> 2) & mask2);
+    word = (word & mask4) + ((word >> 4) & mask4);
+    return static_cast<int>((word * 0x0101010101010101ULL) >> 56);
+  }
+
+};
+
+END_NAMESPACE_YM
+
+#endif // BITCOUNT_H
@@ -7,7 +7,6 @@
 /// All rights reserved.
 
 #include "ym/Tv2Bdd.h"
-#include "BddGen.h"
 
 
 BEGIN_NAMESPACE_YM
@@ -23,12 +22,7 @@ Tv2Bdd::gen_bdd(
   BddMgr& mgr
 )
 {
-  auto ni = f.input_num();
-  std::vector<BddVar> var_list(ni);
-  for ( SizeType i = 0; i < ni; ++ i ) {
-    var_list[i] = mgr.variable(ni - i - 1);
-  }
-  return gen_bdd(f, mgr, var_list);
+  return mgr.from_tvfunc(f);
 }
 
 // @brief TvFunc を BDD に変換する．
@@ -39,49 +33,41 @@ Tv2Bdd::gen_bdd(
   const std::vector<BddVar>& var_list
 )
 {
-  BddGen gen{f, mgr, var_list};
-  auto r = gen.run();
-  return r;
+  if ( var_list.size() < f.input_num() ) {
+    throw std::invalid_argument{"var_list.size() is too small"};
+  }
+  return mgr.from_tvfunc(f, var_list);
 }
 
-
-//////////////////////////////////////////////////////////////////////
-// クラス BddGen
-//////////////////////////////////////////////////////////////////////
-
-// @brief BDD を作る．
-Bdd
-BddGen::run()
+// @brief 複数の TvFunc を BDD のリストに変換する．
+std::vector<Bdd>
+Tv2Bdd::gen_bdd(
+  const std::vector<TvFunc>& f_list,
+  BddMgr& mgr
+)
 {
-  SizeType ni = mFunc.input_num();
-  SizeType nexp = 1UL << ni;
-  return decomp_step(0, 0, nexp);
+  std::vector<Bdd> bdd_list;
+  bdd_list.reserve(f_list.size());
+  for ( auto& f: f_list ) {
+    bdd_list.push_back(gen_bdd(f, mgr));
+  }
+  return bdd_list;
 }
 
-// @brief run() の下請け関数
-Bdd
-BddGen::decomp_step(
-  SizeType var,
-  SizeType start,
-  SizeType end
+// @brief 複数の TvFunc を BDD のリストに変換する．
+std::vector<Bdd>
+Tv2Bdd::gen_bdd(
+  const std::vector<TvFunc>& f_list,
+  BddMgr& mgr,
+  const std::vector<BddVar>& var_list
 )
 {
-  SizeType size = end - start;
-  if ( size == 1 ) {
-    if ( mFunc.value(start) ) {
-      return mMgr.one();
-    }
-    else {
-      return mMgr.zero();
-    }
+  std::vector<Bdd> bdd_list;
+  bdd_list.reserve(f_list.size());
+  for ( auto& f: f_list ) {
+    bdd_list.push_back(gen_bdd(f, mgr, var_list));
   }
-
-  SizeType mid = (start + end) / 2;
-  auto r0 = decomp_step(var + 1, start, mid);
-  auto r1 = decomp_step(var + 1, mid, end);
-  auto v = mVarList[var];
-  auto r = Bdd::ite(v, r1, r0);
-  return r;
+  return bdd_list;
 }
 
 END_NAMESPACE_YM
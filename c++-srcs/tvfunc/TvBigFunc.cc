@@ -0,0 +1,368 @@
+
+/// @file TvBigFunc.cc
+/// @brief TvBigFunc の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/TvBigFunc.h"
+#include "ym/Range.h"
+
+
+BEGIN_NAMESPACE_YM
+
+//////////////////////////////////////////////////////////////////////
+// クラス TvBigFunc
+//////////////////////////////////////////////////////////////////////
+
+// @brief 入力数のみ指定したコンストラクタ
+TvBigFunc::TvBigFunc(
+  SizeType ni
+) : mInputNum{ni}
+{
+  if ( ni > kMaxNi ) {
+    throw std::invalid_argument{"ni is too large"};
+  }
+  mTileList.resize(tile_num(ni), TvFunc::zero(tile_input_num(ni)));
+}
+
+// @brief TvFunc からの変換コンストラクタ
+TvBigFunc::TvBigFunc(
+  const TvFunc& func
+) : mInputNum{func.input_num()}
+{
+  if ( func.is_invalid() ) {
+    return;
+  }
+  auto ni = mInputNum;
+  if ( ni <= kTileNi ) {
+    mTileList.push_back(func);
+    return;
+  }
+  // 真理値表を連続したブロックごとに切り分ける．
+  auto tile_ni = tile_input_num(ni);
+  auto nt = tile_num(ni);
+  SizeType nw = 1UL << (tile_ni - 6);
+  mTileList.reserve(nt);
+  for ( SizeType t: Range(nt) ) {
+    std::vector<WordType> data(nw);
+    for ( SizeType b: Range(nw) ) {
+      data[b] = func.raw_data(t * nw + b);
+    }
+    mTileList.push_back(TvFunc::from_raw_data(tile_ni, std::move(data)));
+  }
+}
+
+// @brief リテラル関数を作る．
+TvBigFunc
+TvBigFunc::literal(
+  SizeType ni,
+  SizeType varid,
+  bool inv
+)
+{
+  TvBigFunc func{ni};
+  func._check_varid(varid);
+  auto tile_ni = tile_input_num(ni);
+  if ( varid < tile_ni ) {
+    auto lit = TvFunc::literal(tile_ni, varid, inv);
+    for ( auto& tile: func.mTileList ) {
+      tile = lit;
+    }
+  }
+  else {
+    // タイル番号のビットが値となる．
+    SizeType bit = 1UL << (varid - tile_ni);
+    auto one = TvFunc::one(tile_ni);
+    for ( SizeType t: Range(func.tile_num()) ) {
+      bool val = (t & bit) != 0;
+      if ( val != inv ) {
+	func.mTileList[t] = one;
+      }
+    }
+  }
+  return func;
+}
+
+// @brief タイルのリストから関数を作る．
+TvBigFunc
+TvBigFunc::from_tiles(
+  SizeType ni,
+  std::vector<TvFunc>&& tile_list
+)
+{
+  if ( ni > kMaxNi ) {
+    throw std::invalid_argument{"ni is too large"};
+  }
+  if ( tile_list.size() != tile_num(ni) ) {
+    throw std::invalid_argument{"tile_list.size() mismatch"};
+  }
+  auto tile_ni = tile_input_num(ni);
+  for ( auto& tile: tile_list ) {
+    if ( tile.input_num() != tile_ni ) {
+      throw std::invalid_argument{"input_num() of tile mismatch"};
+    }
+  }
+  TvBigFunc func;
+  func.mInputNum = ni;
+  func.mTileList = std::move(tile_list);
+  return func;
+}
+
+// @brief 自分自身を否定する．
+TvBigFunc&
+TvBigFunc::invert_int()
+{
+  for ( auto& tile: mTileList ) {
+    tile.invert_int();
+  }
+  return *this;
+}
+
+// @brief src1 との論理積を計算し自分に代入する．
+TvBigFunc&
+TvBigFunc::and_int(
+  const TvBigFunc& src1
+)
+{
+  _check_size(src1);
+  for ( SizeType t: Range(tile_num()) ) {
+    mTileList[t].and_int(src1.mTileList[t]);
+  }
+  return *this;
+}
+
+// @brief src1 との論理和を計算し自分に代入する．
+TvBigFunc&
+TvBigFunc::or_int(
+  const TvBigFunc& src1
+)
+{
+  _check_size(src1);
+  for ( SizeType t: Range(tile_num()) ) {
+    mTileList[t].or_int(src1.mTileList[t]);
+  }
+  return *this;
+}
+
+// @brief src1 との排他的論理和を計算し自分に代入する．
+TvBigFunc&
+TvBigFunc::xor_int(
+  const TvBigFunc& src1
+)
+{
+  _check_size(src1);
+  for ( SizeType t: Range(tile_num()) ) {
+    mTileList[t].xor_int(src1.mTileList[t]);
+  }
+  return *this;
+}
+
+// @brief コファクターを計算し自分に代入する．
+TvBigFunc&
+TvBigFunc::cofactor_int(
+  SizeType var,
+  bool inv
+)
+{
+  if ( is_invalid() ) {
+    return *this;
+  }
+  _check_varid(var);
+  auto tile_ni = tile_input_num(mInputNum);
+  if ( var < tile_ni ) {
+    for ( auto& tile: mTileList ) {
+      tile.cofactor_int(var, inv);
+    }
+  }
+  else {
+    // 反対側のタイルをコピーする．
+    SizeType bit = 1UL << (var - tile_ni);
+    for ( SizeType t: Range(tile_num()) ) {
+      if ( ((t & bit) != 0) == inv ) {
+	mTileList[t] = mTileList[t ^ bit];
+      }
+    }
+  }
+  return *this;
+}
+
+// @brief 入力値を2進数と見なしたときの pos 番目の値を得る．
+int
+TvBigFunc::value(
+  std::uint64_t pos
+) const
+{
+  if ( is_invalid() ) {
+    return 0;
+  }
+  if ( (pos >> mInputNum) != 0 ) {
+    throw std::out_of_range{"pos is out of range"};
+  }
+  auto tile_ni = tile_input_num(mInputNum);
+  auto t = pos >> tile_ni;
+  auto lpos = pos & ((1ULL << tile_ni) - 1);
+  return mTileList[t].value(lpos);
+}
+
+// @brief 定数0関数の時に true を返す．
+bool
+TvBigFunc::is_zero() const
+{
+  if ( is_invalid() ) {
+    return false;
+  }
+  for ( auto& tile: mTileList ) {
+    if ( !tile.is_zero() ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// @brief 定数1関数の時に true を返す．
+bool
+TvBigFunc::is_one() const
+{
+  if ( is_invalid() ) {
+    return false;
+  }
+  for ( auto& tile: mTileList ) {
+    if ( !tile.is_one() ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// @brief 0 の数を数える．
+std::uint64_t
+TvBigFunc::count_zero() const
+{
+  if ( is_invalid() ) {
+    return 0;
+  }
+  return (1ULL << mInputNum) - count_one();
+}
+
+// @brief 1 の数を数える．
+std::uint64_t
+TvBigFunc::count_one() const
+{
+  std::uint64_t ans = 0;
+  for ( auto& tile: mTileList ) {
+    ans += tile.count_one();
+  }
+  return ans;
+}
+
+// @brief 0次の Walsh 係数を求める．
+std::int64_t
+TvBigFunc::walsh_0() const
+{
+  std::int64_t ans = 0;
+  for ( auto& tile: mTileList ) {
+    ans += tile.walsh_0();
+  }
+  return ans;
+}
+
+// @brief 1次の Walsh 係数を求める．
+std::int64_t
+TvBigFunc::walsh_1(
+  SizeType var
+) const
+{
+  if ( is_invalid() ) {
+    return 0;
+  }
+  _check_varid(var);
+  auto tile_ni = tile_input_num(mInputNum);
+  std::int64_t ans = 0;
+  if ( var < tile_ni ) {
+    for ( auto& tile: mTileList ) {
+      ans += tile.walsh_1(var);
+    }
+  }
+  else {
+    // var が 1 のタイルは符号を反転させる．
+    SizeType bit = 1UL << (var - tile_ni);
+    for ( SizeType t: Range(tile_num()) ) {
+      auto w = mTileList[t].walsh_0();
+      if ( t & bit ) {
+	ans -= w;
+      }
+      else {
+	ans += w;
+      }
+    }
+  }
+  return ans;
+}
+
+// @brief var がサポートの時 true を返す．
+bool
+TvBigFunc::check_sup(
+  SizeType var
+) const
+{
+  if ( is_invalid() ) {
+    return false;
+  }
+  _check_varid(var);
+  auto tile_ni = tile_input_num(mInputNum);
+  if ( var < tile_ni ) {
+    for ( auto& tile: mTileList ) {
+      if ( tile.check_sup(var) ) {
+	return true;
+      }
+    }
+  }
+  else {
+    // var の値のみが異なるタイルを比較する．
+    SizeType bit = 1UL << (var - tile_ni);
+    for ( SizeType t: Range(tile_num()) ) {
+      if ( (t & bit) == 0 && mTileList[t] != mTileList[t | bit] ) {
+	return true;
+      }
+    }
+  }
+  return false;
+}
+
+// @brief ハッシュ値を返す．
+SizeType
+TvBigFunc::hash() const
+{
+  SizeType ans = 0;
+  for ( auto& tile: mTileList ) {
+    ans = ans * 1048583 + tile.hash();
+  }
+  return ans + mInputNum;
+}
+
+// @brief TvFunc に変換する．
+TvFunc
+TvBigFunc::to_tvfunc() const
+{
+  if ( is_invalid() ) {
+    return TvFunc::invalid();
+  }
+  if ( mInputNum > TvFunc::kMaxNi ) {
+    throw std::invalid_argument{"input_num() is too large"};
+  }
+  if ( mInputNum <= kTileNi ) {
+    return mTileList[0];
+  }
+  std::vector<WordType> data;
+  data.reserve(1UL << (mInputNum - 6));
+  for ( auto& tile: mTileList ) {
+    for ( SizeType b: Range(tile.nblk()) ) {
+      data.push_back(tile.raw_data(b));
+    }
+  }
+  return TvFunc::from_raw_data(mInputNum, std::move(data));
+}
+
+END_NAMESPACE_YM
@@ -11,6 +11,7 @@
 #include "ym/SopCube.h"
 #include "ym/Range.h"
 #include "npn/NpnMgr.h"
+#include "npn/NpnTable.h"
 
 
 // 1 ワード当たりの入力数
@@ -272,6 +273,22 @@ TvFunc::TvFunc(
   }
 }
 
+// @brief パックされた真理値ベクトルから関数を作る．
+TvFunc
+TvFunc::from_raw_data(
+  SizeType ni,
+  std::vector<WordType>&& data
+)
+{
+  TvFunc func(ni);
+  if ( data.size() != func.mBlockNum ) {
+    throw std::invalid_argument{"the size of 'data' mismatch"};
+  }
+  func.mVector = TvWordVec{data};
+  func.mVector[0] &= vec_mask(ni);
+  return func;
+}
+
 // コピーコンストラクタ
 TvFunc::TvFunc(
   const TvFunc& src
@@ -314,7 +331,7 @@ TvFunc::operator=(
 {
   mInputNum = src.mInputNum;
   mBlockNum = src.mBlockNum;
-  std::swap(mVector, src.mVector);
+  mVector.swap(src.mVector);
 
   src.mInputNum = 0;
   src.mBlockNum = 0;
@@ -445,6 +462,60 @@ TvFunc::xform(
 #endif
 
   SizeType new_ni = npnmap.input_num2();
+  if ( new_ni == mInputNum ) {
+    // 入力の置換になっている場合にはワード単位の処理で行う．
+    std::vector<SizeType> src_list(new_ni, BAD_VARID);
+    bool is_perm = true;
+    for ( SizeType src_var: Range(mInputNum) ) {
+      auto imap = npnmap.imap(src_var);
+      if ( imap.is_invalid() || imap.var() >= new_ni ||
+	   src_list[imap.var()] != BAD_VARID ) {
+	is_perm = false;
+	break;
+      }
+      src_list[imap.var()] = src_var;
+    }
+    if ( is_perm ) {
+      TvFunc ans{*this};
+      // 入力の反転
+      for ( SizeType src_var: Range(mInputNum) ) {
+	if ( npnmap.imap(src_var).inv() ) {
+	  ans._flip_var(src_var);
+	}
+      }
+      // 入力の置換
+      // cur_list[i] は現在 i 番目にある元の変数
+      // pos_list[v] は元の変数 v の現在の位置
+      std::vector<SizeType> cur_list(new_ni);
+      std::vector<SizeType> pos_list(new_ni);
+      for ( SizeType i: Range(new_ni) ) {
+	cur_list[i] = i;
+	pos_list[i] = i;
+      }
+      for ( SizeType i: Range(new_ni) ) {
+	auto src_var = src_list[i];
+	auto j = pos_list[src_var];
+	if ( j != i ) {
+	  ans._swap_var(i, j);
+	  auto var_i = cur_list[i];
+	  cur_list[i] = src_var;
+	  cur_list[j] = var_i;
+	  pos_list[src_var] = i;
+	  pos_list[var_i] = j;
+	}
+      }
+      // 出力の反転
+      if ( npnmap.oinv() ) {
+	ans.invert_int();
+      }
+#if defined(DEBUG)
+      std::cout << ans << std::endl;
+#endif
+      return ans;
+    }
+  }
+
+  // 一般の場合は最小項ごとに求める．
   SizeType imask = 0;
   SizeType ipat[kMaxNi];
   for ( SizeType i: Range(new_ni) ) {
@@ -485,6 +556,87 @@ TvFunc::xform(
   return ans;
 }
 
+// @brief 変数の極性を反転させる．
+void
+TvFunc::_flip_var(
+  SizeType var
+)
+{
+  if ( var < NIPW ) {
+    // ワード内でシフトする．
+    auto mask = c_mask(var);
+    SizeType s = 1 << var;
+    for ( SizeType b: Range(mBlockNum) ) {
+      auto word = mVector[b];
+      mVector[b] = ((word & mask) >> s) | ((word << s) & mask);
+    }
+  }
+  else {
+    // ブロックを入れ替える．
+    SizeType bit = 1 << (var - NIPW);
+    for ( SizeType b: Range(mBlockNum) ) {
+      if ( (b & bit) == 0 ) {
+	std::swap(mVector[b], mVector[b | bit]);
+      }
+    }
+  }
+}
+
+// @brief 2つの変数を入れ替える．
+void
+TvFunc::_swap_var(
+  SizeType var1,
+  SizeType var2
+)
+{
+  SizeType i = var1;
+  SizeType j = var2;
+  if ( i < j ) {
+    std::swap(i, j);
+  }
+  // ここ以降では必ず i > j が成り立つ．
+
+  if ( j >= NIPW ) {
+    // 両方ともブロックの変数
+    // (i, j) = (0, 1) のブロックと (1, 0) のブロックを入れ替える．
+    SizeType bit_i = 1 << (i - NIPW);
+    SizeType bit_j = 1 << (j - NIPW);
+    for ( SizeType b: Range(mBlockNum) ) {
+      if ( (b & bit_i) == 0 && (b & bit_j) != 0 ) {
+	std::swap(mVector[b], mVector[b ^ bit_i ^ bit_j]);
+      }
+    }
+  }
+  else if ( i >= NIPW ) {
+    // i はブロックの変数，j はワード内の変数
+    // x_i = 0 のブロックの x_j = 1 の部分と
+    // x_i = 1 のブロックの x_j = 0 の部分を入れ替える．
+    SizeType bit_i = 1 << (i - NIPW);
+    auto mask = c_mask(j);
+    SizeType s = 1 << j;
+    for ( SizeType b: Range(mBlockNum) ) {
+      if ( (b & bit_i) == 0 ) {
+	auto word0 = mVector[b];
+	auto word1 = mVector[b | bit_i];
+	mVector[b] = (word0 & ~mask) | ((word1 << s) & mask);
+	mVector[b | bit_i] = (word1 & mask) | ((word0 & mask) >> s);
+      }
+    }
+  }
+  else {
+    // 両方ともワード内の変数
+    // delta swap で (x_i, x_j) = (0, 1) のビットと (1, 0) のビットを
+    // 入れ替える．
+    auto mask = c_mask(j) & ~c_mask(i);
+    SizeType s = (1 << i) - (1 << j);
+    for ( SizeType b: Range(mBlockNum) ) {
+      auto word = mVector[b];
+      auto tmp = ((word >> s) ^ word) & mask;
+      mVector[b] = word ^ tmp ^ (tmp << s);
+    }
+  }
+}
+
 // @brief 独立な変数を取り除く変換を返す．
 NpnMap
 TvFunc::shrink_map() const
@@ -525,6 +677,10 @@ TvFunc::shrink_map() const
 NpnMap
 TvFunc::npn_cannonical_map() const
 {
+  if ( nsLogic::NpnTable::is_supported(*this) ) {
+    // 入力数が小さい場合は表引きで求める．
+    return nsLogic::NpnTable::cannonical_map(*this);
+  }
   nsLogic::NpnMgr npn_mgr;
   npn_mgr.cannonical(*this);
   std::vector<NpnMap> cmap_list;
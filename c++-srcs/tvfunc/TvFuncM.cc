@@ -30,46 +30,6 @@ TvFuncM::WordType c_masks[] = {
   0xFFFFFFFF00000000ULL
 };
 
-// 対称性を調べるためのテーブルその1
-// 同位相の時に用いる．
-TvFuncM::WordType sym_masks2[] = {
-  0x2222222222222222ULL, // (1, 0)
-  0x0A0A0A0A0A0A0A0AULL, // (2, 0)
-  0x0C0C0C0C0C0C0C0CULL, // (2, 1)
-  0x00AA00AA00AA00AAULL, // (3, 0)
-  0x00CC00CC00CC00CCULL, // (3, 1)
-  0x00F000F000F000F0ULL, // (3, 2)
-  0x0000AAAA0000AAAAULL, // (4, 0)
-  0x0000CCCC0000CCCCULL, // (4, 1)
-  0x0000F0F00000F0F0ULL, // (4, 2)
-  0x0000FF000000FF00ULL, // (4, 3)
-  0x00000000AAAAAAAAULL, // (5, 0)
-  0x00000000CCCCCCCCULL, // (5, 1)
-  0x00000000F0F0F0F0ULL, // (5, 2)
-  0x00000000FF00FF00ULL, // (5, 3)
-  0x00000000FFFF0000ULL  // (5, 4)
-};
-
-// 対称性を調べるためのテーブルその2
-// 逆位相の時に用いる．
-TvFuncM::WordType sym_masks3[] = {
-  0x1111111111111111ULL, // (1, 0)
-  0x0505050505050505ULL, // (2, 0)
-  0x0303030303030303ULL, // (2, 1)
-  0x0055005500550055ULL, // (3, 0)
-  0x0033003300330033ULL, // (3, 1)
-  0x000F000F000F000FULL, // (3, 2)
-  0x0000555500005555ULL, // (4, 0)
-  0x0000333300003333ULL, // (4, 1)
-  0x00000F0F00000F0FULL, // (4, 2)
-  0x000000FF000000FFULL, // (4, 3)
-  0x0000000055555555ULL, // (5, 0)
-  0x0000000033333333ULL, // (5, 1)
-  0x000000000F0F0F0FULL, // (5, 2)
-  0x0000000000FF00FFULL, // (5, 3)
-  0x000000000000FFFFULL  // (5, 4)
-};
-
 END_NONAMESPACE
 
 //////////////////////////////////////////////////////////////////////
@@ -116,6 +76,23 @@ TvFuncM::TvFuncM(
   }
 }
 
+// @brief TvFuncMView の内容をコピーするコンストラクタ
+TvFuncM::TvFuncM(
+  const TvFuncMView& src
+) : mInputNum{src.input_num()},
+    mOutputNum{src.output_num()},
+    mBlockNum1{nblock(mInputNum)},
+    mBlockNum{mBlockNum1 * mOutputNum},
+    mVector(mBlockNum)
+{
+  for ( SizeType i: Range(mOutputNum) ) {
+    SizeType offset = i * mBlockNum1;
+    for ( SizeType b: Range(mBlockNum1) ) {
+      mVector[offset + b] = src.raw_data(i, b);
+    }
+  }
+}
+
 // コピーコンストラクタ
 TvFuncM::TvFuncM(
   const TvFuncM& src
@@ -149,7 +126,7 @@ TvFuncM::TvFuncM(
     mOutputNum{1},
     mBlockNum1{nblock(mInputNum)},
     mBlockNum{mBlockNum1},
-    mVector{src.mVector}
+    mVector(src.mVector.begin(), src.mVector.end())
 {
 }
 
@@ -160,10 +137,12 @@ TvFuncM::TvFuncM(
     mOutputNum{1},
     mBlockNum1{nblock(mInputNum)},
     mBlockNum{mBlockNum1},
-    mVector{std::move(src.mVector)}
+    mVector(src.mVector.begin(), src.mVector.end())
 {
+  // TvFunc の領域はそのまま使えないのでコピーする．
   src.mInputNum = 0;
   src.mBlockNum = 0;
+  src.mVector.clear();
 }
 
 // コピー代入演算子
@@ -380,32 +359,7 @@ TvFuncM::check_sup(
   SizeType var
 ) const
 {
-  if ( var < NIPW ) {
-    // ブロックごとにチェック
-    int dist = 1U << var;
-    TvFuncM::WordType mask = c_masks[var];
-    for ( int b: Range(mBlockNum) ) {
-      TvFuncM::WordType word = mVector[b];
-      if ( (word ^ (word << dist)) & mask ) {
-	return true;
-      }
-    }
-  }
-  else {
-    // ブロック単位でチェック
-    int i5 = var - NIPW;
-    int check = 1 << i5;
-    for ( int i: Range(mOutputNum) ) {
-      int offset = var * mBlockNum1;
-      for ( int b: Range(mBlockNum1) ) {
-	if ( (b & check) &&
-	     (mVector[b + offset] != mVector[(b ^ check) + offset]) ) {
-	  return true;
-	}
-      }
-    }
-  }
-  return false;
+  return view().check_sup(var);
 }
 
 // var1 と var2 の変数が対称のとき true を返す．
@@ -416,77 +370,7 @@ TvFuncM::check_sym(
   bool inv
 ) const
 {
-  // var1 と var2 を正規化する．
-  if ( var1 < var2 ) {
-    std::swap(var1, var2);
-  }
-  // ここ以降では必ず var1 > var2 が成り立つ．
-
-  bool ans = true;
-  if ( var2 >= NIPW ) {
-    // var1 >= NIPW
-    // var2 >= NIPW
-    // ブロック単位で比較する．
-    int mask_i = (1 << (var1 - NIPW));
-    int mask_j = (1 << (var2 - NIPW));
-    int mask_all = mask_i | mask_j;
-    int cond = inv ? 0 : mask_j;
-    for ( int i: Range(mOutputNum) ) {
-      int offset = i * mBlockNum1;
-      for ( int v: Range(mBlockNum1) ) {
-	if ( (v & mask_all) == cond &&
-	     mVector[v + offset] != mVector[(v ^ mask_all) + offset] ) {
-	  ans = false;
-	  break;
-	}
-      }
-    }
-  }
-  else if ( var1 >= NIPW ) {
-    // var1 >= NIPW
-    // var2 < NIPW
-    int mask_i = (1U << (var1 - NIPW));
-    int cond = inv ? 0UL : mask_i;
-    TvFuncM::WordType mask2 = ~c_masks[var2];
-    int s = 1 << var2;
-    for ( int i: Range(mOutputNum) ) {
-      int offset = i * mBlockNum1;
-      for ( int v: Range(mBlockNum1) ) {
-	if ( (v & mask_i) == cond &&
-	     (mVector[v + offset] ^ (mVector[(v ^ mask_i) + offset] >> s)) & mask2 ) {
-	  ans = false;
-	  break;
-	}
-      }
-    }
-  }
-  else {
-    // var1 < NIPW
-    // var2 < NIPW
-    if ( inv ) {
-      TvFuncM::WordType mask = sym_masks3[(var1 * (var1 - 1)) / 2 + var2];
-      int s = (1U << var1) + (1U << var2);
-      for ( int b: Range(mBlockNum) ) {
-	TvFuncM::WordType word = mVector[b];
-	if ( ((word >> s) ^ word) & mask ) {
-	  ans = false;
-	  break;
-	}
-      }
-    }
-    else {
-      TvFuncM::WordType mask = sym_masks2[(var1 * (var1 - 1)) / 2 + var2];
-      int s = (1U << var1) - (1U << var2);
-      for ( int b: Range(mBlockNum) ) {
-	TvFuncM::WordType word = mVector[b];
-	if ( ((word >> s) ^ word) & mask ) {
-	  ans = false;
-	  break;
-	}
-      }
-    }
-  }
-  return ans;
+  return view().check_sym(var1, var2, inv);
 }
 
 // npnmap に従った変換を行う．
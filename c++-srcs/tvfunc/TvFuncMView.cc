@@ -0,0 +1,283 @@
+
+/// @file TvFuncMView.cc
+/// @brief TvFuncMView の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/TvFuncMView.h"
+#include "ym/TvFuncM.h"
+#include "ym/Range.h"
+
+
+// 1 ワード当たりの入力数
+#define NIPW 6
+
+BEGIN_NAMESPACE_YM
+
+BEGIN_NONAMESPACE
+
+// コファクターマスク
+TvFunc::WordType c_masks[] = {
+  0xAAAAAAAAAAAAAAAAULL,
+  0xCCCCCCCCCCCCCCCCULL,
+  0xF0F0F0F0F0F0F0F0ULL,
+  0xFF00FF00FF00FF00ULL,
+  0xFFFF0000FFFF0000ULL,
+  0xFFFFFFFF00000000ULL
+};
+
+// 対称性を調べるためのテーブルその1
+// 同位相の時に用いる．
+TvFunc::WordType sym_masks2[] = {
+  0x2222222222222222ULL, // (1, 0)
+  0x0A0A0A0A0A0A0A0AULL, // (2, 0)
+  0x0C0C0C0C0C0C0C0CULL, // (2, 1)
+  0x00AA00AA00AA00AAULL, // (3, 0)
+  0x00CC00CC00CC00CCULL, // (3, 1)
+  0x00F000F000F000F0ULL, // (3, 2)
+  0x0000AAAA0000AAAAULL, // (4, 0)
+  0x0000CCCC0000CCCCULL, // (4, 1)
+  0x0000F0F00000F0F0ULL, // (4, 2)
+  0x0000FF000000FF00ULL, // (4, 3)
+  0x00000000AAAAAAAAULL, // (5, 0)
+  0x00000000CCCCCCCCULL, // (5, 1)
+  0x00000000F0F0F0F0ULL, // (5, 2)
+  0x00000000FF00FF00ULL, // (5, 3)
+  0x00000000FFFF0000ULL  // (5, 4)
+};
+
+// 対称性を調べるためのテーブルその2
+// 逆位相の時に用いる．
+TvFunc::WordType sym_masks3[] = {
+  0x1111111111111111ULL, // (1, 0)
+  0x0505050505050505ULL, // (2, 0)
+  0x0303030303030303ULL, // (2, 1)
+  0x0055005500550055ULL, // (3, 0)
+  0x0033003300330033ULL, // (3, 1)
+  0x000F000F000F000FULL, // (3, 2)
+  0x0000555500005555ULL, // (4, 0)
+  0x0000333300003333ULL, // (4, 1)
+  0x00000F0F00000F0FULL, // (4, 2)
+  0x000000FF000000FFULL, // (4, 3)
+  0x0000000055555555ULL, // (5, 0)
+  0x0000000033333333ULL, // (5, 1)
+  0x000000000F0F0F0FULL, // (5, 2)
+  0x0000000000FF00FFULL, // (5, 3)
+  0x000000000000FFFFULL  // (5, 4)
+};
+
+// 1出力分の真理値ベクトルが var に依存する時 true を返す．
+bool
+sup1(
+  const TvFunc::WordType* body,
+  SizeType nb,
+  SizeType var
+)
+{
+  if ( var < NIPW ) {
+    // ブロックごとにチェック
+    SizeType dist = 1U << var;
+    auto mask = c_masks[var];
+    for ( SizeType b = 0; b < nb; ++ b ) {
+      auto word = body[b];
+      if ( (word ^ (word << dist)) & mask ) {
+	return true;
+      }
+    }
+  }
+  else {
+    // ブロック単位でチェック
+    SizeType check = 1U << (var - NIPW);
+    for ( SizeType b = 0; b < nb; ++ b ) {
+      if ( (b & check) && body[b] != body[b ^ check] ) {
+	return true;
+      }
+    }
+  }
+  return false;
+}
+
+// 1出力分の真理値ベクトルで var1 と var2 が対称の時 true を返す．
+//
+// var1 > var2 を仮定している．
+bool
+sym1(
+  const TvFunc::WordType* body,
+  SizeType nb,
+  SizeType var1,
+  SizeType var2,
+  bool inv
+)
+{
+  if ( var2 >= NIPW ) {
+    // ブロック単位で比較する．
+    SizeType mask_i = 1U << (var1 - NIPW);
+    SizeType mask_j = 1U << (var2 - NIPW);
+    SizeType mask_all = mask_i | mask_j;
+    SizeType cond = inv ? 0 : mask_j;
+    for ( SizeType b = 0; b < nb; ++ b ) {
+      if ( (b & mask_all) == cond && body[b] != body[b ^ mask_all] ) {
+	return false;
+      }
+    }
+  }
+  else if ( var1 >= NIPW ) {
+    SizeType mask_i = 1U << (var1 - NIPW);
+    SizeType cond = inv ? 0 : mask_i;
+    auto mask2 = ~c_masks[var2];
+    SizeType s = 1U << var2;
+    for ( SizeType b = 0; b < nb; ++ b ) {
+      if ( (b & mask_i) == cond &&
+	   ((body[b] ^ (body[b ^ mask_i] >> s)) & mask2) ) {
+	return false;
+      }
+    }
+  }
+  else {
+    SizeType idx = (var1 * (var1 - 1)) / 2 + var2;
+    auto mask = inv ? sym_masks3[idx] : sym_masks2[idx];
+    SizeType s = inv ? (1U << var1) + (1U << var2) : (1U << var1) - (1U << var2);
+    for ( SizeType b = 0; b < nb; ++ b ) {
+      auto word = body[b];
+      if ( ((word >> s) ^ word) & mask ) {
+	return false;
+      }
+    }
+  }
+  return true;
+}
+
+END_NONAMESPACE
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス TvFuncMView
+//////////////////////////////////////////////////////////////////////
+
+// @brief 1出力の論理関数をコピーして返す．
+TvFunc
+TvFuncMView::slice(
+  SizeType ovar
+) const
+{
+  auto body = mBody + ovar * mBlockNum1;
+  std::vector<WordType> data(body, body + mBlockNum1);
+  return TvFunc::from_raw_data(mInputNum, std::move(data));
+}
+
+// @brief いずれかの出力が var に依存する時 true を返す．
+bool
+TvFuncMView::check_sup(
+  SizeType var
+) const
+{
+  return _sup_kernel(var, nullptr);
+}
+
+// @brief 出力ごとに var に依存するか調べる．
+std::vector<bool>
+TvFuncMView::sup_outputs(
+  SizeType var
+) const
+{
+  std::vector<bool> ans(mOutputNum, false);
+  _sup_kernel(var, &ans);
+  return ans;
+}
+
+// @brief 全ての出力で var1 と var2 が対称の時 true を返す．
+bool
+TvFuncMView::check_sym(
+  SizeType var1,
+  SizeType var2,
+  bool inv
+) const
+{
+  return _sym_kernel(var1, var2, inv, nullptr);
+}
+
+// @brief 出力ごとに var1 と var2 が対称か調べる．
+std::vector<bool>
+TvFuncMView::sym_outputs(
+  SizeType var1,
+  SizeType var2,
+  bool inv
+) const
+{
+  std::vector<bool> ans(mOutputNum, true);
+  _sym_kernel(var1, var2, inv, &ans);
+  return ans;
+}
+
+// @brief コファクターを返す．
+TvFuncM
+TvFuncMView::cofactor(
+  SizeType var,
+  bool inv
+) const
+{
+  return TvFuncM{*this}.cofactor_int(var, inv);
+}
+
+// @brief sup_outputs() の下請け関数
+bool
+TvFuncMView::_sup_kernel(
+  SizeType var,
+  std::vector<bool>* ans
+) const
+{
+  if ( var >= mInputNum ) {
+    throw std::out_of_range{"var is out of range"};
+  }
+
+  // 出力は連続した領域に並んでいるので，
+  // 先頭から順に調べれば全体を1回走査するだけで済む．
+  bool any = false;
+  for ( SizeType i: Range(mOutputNum) ) {
+    if ( sup1(mBody + i * mBlockNum1, mBlockNum1, var) ) {
+      any = true;
+      if ( ans == nullptr ) {
+	break;
+      }
+      (*ans)[i] = true;
+    }
+  }
+  return any;
+}
+
+// @brief sym_outputs() の下請け関数
+bool
+TvFuncMView::_sym_kernel(
+  SizeType var1,
+  SizeType var2,
+  bool inv,
+  std::vector<bool>* ans
+) const
+{
+  if ( var1 >= mInputNum || var2 >= mInputNum ) {
+    throw std::out_of_range{"var is out of range"};
+  }
+  if ( var1 == var2 ) {
+    throw std::invalid_argument{"var1 == var2"};
+  }
+  // var1 > var2 となるように正規化する．
+  if ( var1 < var2 ) {
+    std::swap(var1, var2);
+  }
+
+  bool all = true;
+  for ( SizeType i: Range(mOutputNum) ) {
+    if ( !sym1(mBody + i * mBlockNum1, mBlockNum1, var1, var2, inv) ) {
+      all = false;
+      if ( ans == nullptr ) {
+	break;
+      }
+      (*ans)[i] = false;
+    }
+  }
+  return all;
+}
+
+END_NAMESPACE_YM
@@ -8,6 +8,7 @@
 
 #include "ym/TvFunc.h"
 #include "ym/Range.h"
+#include "BitCount.h"
 
 
 // 1 ワード当たりの入力数
@@ -19,24 +20,59 @@ BEGIN_NAMESPACE_YM
 
 BEGIN_NONAMESPACE
 
-// 0 - 63 までの数をその数を2進表記したときの1のビット数ごとにならべたもの
-// 以下行ごとに 0, 1, 2, 3, 4, 5, 6 ビットの順になっている．
-int s_plist[] = {
-   0,
-   1,  2,  4,  8, 16, 32,
-   3,  5,  6,  9, 10, 12, 17, 18, 20, 24, 33, 34, 36, 40, 48,
-   7, 11, 13, 14, 19, 21, 22, 25, 26, 28, 35, 37, 38, 41, 42, 44, 49, 50, 52, 56,
-  15, 23, 27, 29, 30, 39, 43, 45, 46, 51, 53, 54, 57, 58, 60,
-  31, 47, 55, 59, 61, 62,
-  63
-};
-
-// s_plist 中の各行の最初の位置を記したリスト
+// 0 - 63 までの数をその数を2進表記したときの1のビット数ごとにならべた時の
+// 各ビット数の最初の位置を記したリスト
 // sentinel として 7 つめの要素がある．
+// s_pidx[v + 1] - s_pidx[v] が重み v のビット位置の数となる．
 int s_pidx[] = {
   0, 1, 7, 22, 42, 57, 63, 64
 };
 
+// ワード内の重み別のビットマスクの表
+//
+// mask(ibits, v) はブロック内の入力反転ビットマスクが ibits の時に
+// 位置の重みが v となるビット位置が 1 のマスクを返す．
+// つまりビット位置 p について p ^ ibits の1のビット数が v の時に
+// p ビット目が 1 となる．
+class WeightMaskTable
+{
+public:
+
+  WeightMaskTable()
+  {
+    for ( SizeType ibits = 0; ibits < 64; ++ ibits ) {
+      for ( SizeType v = 0; v <= NIPW; ++ v ) {
+	mTable[ibits][v] = 0ULL;
+      }
+      for ( SizeType p = 0; p < 64; ++ p ) {
+	auto v = BitCount::count_scalar(p ^ ibits);
+	mTable[ibits][v] |= 1ULL << p;
+      }
+    }
+  }
+
+  TvFunc::WordType
+  mask(
+    SizeType ibits,
+    SizeType v
+  ) const
+  {
+    return mTable[ibits][v];
+  }
+
+private:
+
+  TvFunc::WordType mTable[64][NIPW + 1];
+
+};
+
+const WeightMaskTable&
+weight_mask_table()
+{
+  static WeightMaskTable table;
+  return table;
+}
+
 END_NONAMESPACE
 
 
@@ -178,7 +214,7 @@ count_onebits(
   TvFunc::WordType word
 )
 {
-  return count_onebits_6(word);
+  return BitCount::count(word);
 }
 
 END_NONAMESPACE
@@ -200,10 +236,7 @@ TvFunc::count_zero() const
     ;
   }
 
-  SizeType ans = 0;
-  for ( SizeType b: Range(mBlockNum) ) {
-    ans += count_onebits(mVector[b]);
-  }
+  SizeType ans = BitCount::count(mVector.data(), mBlockNum);
   return (1 << input_num()) - ans;
 }
 
@@ -224,11 +257,7 @@ TvFunc::count_one() const
     ;
   }
 
-  SizeType ans = 0;
-  for ( SizeType b: Range(mBlockNum) ) {
-    ans += count_onebits(mVector[b]);
-  }
-  return ans;
+  return BitCount::count(mVector.data(), mBlockNum);
 }
 
 // 0次の Walsh 係数を求める．
@@ -252,10 +281,7 @@ TvFunc::walsh_0() const
     ;
   }
 
-  int ans = 0;
-  for ( SizeType b: Range(mBlockNum) ) {
-    ans += count_onebits(mVector[b]);
-  }
+  int ans = BitCount::count(mVector.data(), mBlockNum);
   return (1 << input_num()) - ans * 2;
 }
 
@@ -287,9 +313,16 @@ TvFunc::walsh_1(
   // n > 6
   SizeType c = 0;
   int n = 1 << input_num();
-  for ( SizeType b: Range(mBlockNum) ) {
-    TvFunc::WordType mask = lit_pat(varid, b);
-    c += count_onebits(mVector[b] ^ mask);
+  if ( varid < NIPW ) {
+    c = BitCount::count_xor(mVector.data(), mBlockNum, c_mask(varid));
+  }
+  else {
+    // 2^(varid - NIPW) ブロックごとにマスクが反転する．
+    SizeType run = 1 << (varid - NIPW);
+    for ( SizeType b = 0; b < mBlockNum; b += run * 2 ) {
+      c += BitCount::count(mVector.data() + b, run);
+      c += BitCount::count_xor(mVector.data() + b + run, run, ~0ULL);
+    }
   }
   return n - c * 2;
 }
@@ -330,9 +363,7 @@ TvFunc::walsh_2(
   SizeType c = 0;
   if ( var1 < NIPW ) {
     TvFunc::WordType mask = c_mask(var1) ^ c_mask(var2);
-    for ( SizeType b: Range(mBlockNum) ) {
-      c += count_onebits(mVector[b] ^ mask);
-    }
+    c = BitCount::count_xor(mVector.data(), mBlockNum, mask);
   }
   else if ( var2 < NIPW ) {
     // int check = 1 << (var1 - 5);
@@ -345,11 +376,12 @@ TvFunc::walsh_2(
     //     c += count_onebits(mVector[b] ^ mask1);
     //   }
     // }
-    SizeType i5 = var1 - NIPW;
+    // 2^(var1 - NIPW) ブロックごとにマスクが反転する．
+    SizeType run = 1 << (var1 - NIPW);
     TvFunc::WordType mask = c_mask(var2);
-    for ( int b: Range(mBlockNum) ) {
-      TvFunc::WordType mask1 = 0UL - ((b >> i5) & 1UL);
-      c += count_onebits(mVector[b] ^ mask ^ mask1);
+    for ( SizeType b = 0; b < mBlockNum; b += run * 2 ) {
+      c += BitCount::count_xor(mVector.data() + b, run, mask);
+      c += BitCount::count_xor(mVector.data() + b + run, run, ~mask);
     }
   }
   else {
@@ -364,11 +396,13 @@ TvFunc::walsh_2(
     //     c += count_onebits(mVector[b]);
     //   }
     // }
+    // 2^(var2 - NIPW) ブロックの中ではマスクは一定となる．
     SizeType i5 = var1 - NIPW;
     SizeType j5 = var2 - NIPW;
-    for ( SizeType b: Range(mBlockNum) ) {
+    SizeType run = 1 << j5;
+    for ( SizeType b = 0; b < mBlockNum; b += run ) {
       TvFunc::WordType mask = 0UL - (((b >> i5) ^ (b >> j5)) & 1UL);
-      c += count_onebits(mVector[b] ^ mask);
+      c += BitCount::count_xor(mVector.data() + b, run, mask);
     }
   }
   return (1 << input_num()) - c * 2;
@@ -380,7 +414,7 @@ BEGIN_NONAMESPACE
 inline
 int
 walsh_01_5b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -449,7 +483,7 @@ walsh_01_5b(
 inline
 int
 walsh_01_6b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -533,7 +567,7 @@ walsh_01_6b(
 inline
 int
 walsh_01_7b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -550,7 +584,7 @@ walsh_01_7b(
 inline
 int
 walsh_01_8b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -567,7 +601,7 @@ walsh_01_8b(
 inline
 int
 walsh_01_9b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -584,7 +618,7 @@ walsh_01_9b(
 inline
 int
 walsh_01_10b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -600,7 +634,7 @@ walsh_01_10b(
 // 11入力の walsh_01 用サブルーティン
 int
 walsh_01_11b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -616,7 +650,7 @@ walsh_01_11b(
 // 12入力の walsh_01 用サブルーティン
 int
 walsh_01_12b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -632,7 +666,7 @@ walsh_01_12b(
 // 13入力の walsh_01 用サブルーティン
 int
 walsh_01_13b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -648,7 +682,7 @@ walsh_01_13b(
 // 14入力の walsh_01 用サブルーティン
 int
 walsh_01_14b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -664,7 +698,7 @@ walsh_01_14b(
 // 15入力の walsh_01 用サブルーティン
 int
 walsh_01_15b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -680,7 +714,7 @@ walsh_01_15b(
 // 16入力の walsh_01 用サブルーティン
 int
 walsh_01_16b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -696,7 +730,7 @@ walsh_01_16b(
 // 17入力の walsh_01 用サブルーティン
 int
 walsh_01_17b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -712,7 +746,7 @@ walsh_01_17b(
 // 18入力の walsh_01 用サブルーティン
 int
 walsh_01_18b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -728,7 +762,7 @@ walsh_01_18b(
 // 19入力の walsh_01 用サブルーティン
 int
 walsh_01_19b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   int vec[]
 )
@@ -745,7 +779,7 @@ walsh_01_19b(
 inline
 int
 walsh_01_0(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -756,7 +790,7 @@ walsh_01_0(
 inline
 int
 walsh_01_1(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -781,7 +815,7 @@ walsh_01_1(
 inline
 int
 walsh_01_2(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -816,7 +850,7 @@ walsh_01_2(
 inline
 int
 walsh_01_3(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -862,7 +896,7 @@ walsh_01_3(
 inline
 int
 walsh_01_4(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -920,7 +954,7 @@ walsh_01_4(
 inline
 int
 walsh_01_5(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -941,7 +975,7 @@ walsh_01_5(
 inline
 int
 walsh_01_6(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -962,7 +996,7 @@ walsh_01_6(
 inline
 int
 walsh_01_7(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -987,7 +1021,7 @@ walsh_01_7(
 inline
 int
 walsh_01_8(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -1012,7 +1046,7 @@ walsh_01_8(
 inline
 int
 walsh_01_9(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -1037,7 +1071,7 @@ walsh_01_9(
 inline
 int
 walsh_01_10(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -1061,7 +1095,7 @@ walsh_01_10(
 // 11入力の walsh_01 本体
 int
 walsh_01_11(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -1085,7 +1119,7 @@ walsh_01_11(
 // 12入力の walsh_01 本体
 int
 walsh_01_12(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -1109,7 +1143,7 @@ walsh_01_12(
 // 13入力の walsh_01 本体
 int
 walsh_01_13(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -1133,7 +1167,7 @@ walsh_01_13(
 // 14入力の walsh_01 本体
 int
 walsh_01_14(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -1157,7 +1191,7 @@ walsh_01_14(
 // 15入力の walsh_01 本体
 int
 walsh_01_15(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -1181,7 +1215,7 @@ walsh_01_15(
 // 16入力の walsh_01 本体
 int
 walsh_01_16(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -1205,7 +1239,7 @@ walsh_01_16(
 // 17入力の walsh_01 本体
 int
 walsh_01_17(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -1229,7 +1263,7 @@ walsh_01_17(
 // 18入力の walsh_01 本体
 int
 walsh_01_18(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -1253,7 +1287,7 @@ walsh_01_18(
 // 19入力の walsh_01 本体
 int
 walsh_01_19(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -1277,7 +1311,7 @@ walsh_01_19(
 // 20入力の walsh_01 本体
 int
 walsh_01_20(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec[]
 )
 {
@@ -1776,7 +1810,7 @@ w2pos(
 inline
 int
 walsh_012_5b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType ni,
   int vec1[],
   int vec2[]
@@ -1917,7 +1951,7 @@ walsh_012_5b(
 inline
 int
 walsh_012_6b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2121,7 +2155,7 @@ walsh_012_6b(
 inline
 int
 walsh_012_7b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2147,7 +2181,7 @@ walsh_012_7b(
 inline
 int
 walsh_012_8b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2173,7 +2207,7 @@ walsh_012_8b(
 inline
 int
 walsh_012_9b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2199,7 +2233,7 @@ walsh_012_9b(
 inline
 int
 walsh_012_10b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2225,7 +2259,7 @@ walsh_012_10b(
 inline
 int
 walsh_012_11b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2251,7 +2285,7 @@ walsh_012_11b(
 inline
 int
 walsh_012_12b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2276,7 +2310,7 @@ walsh_012_12b(
 // 13入力の walsh_012 用サブルーティン
 int
 walsh_012_13b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2301,7 +2335,7 @@ walsh_012_13b(
 // 14入力の walsh_012 用サブルーティン
 int
 walsh_012_14b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2326,7 +2360,7 @@ walsh_012_14b(
 // 15入力の walsh_012 用サブルーティン
 int
 walsh_012_15b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2351,7 +2385,7 @@ walsh_012_15b(
 // 16入力の walsh_012 用サブルーティン
 int
 walsh_012_16b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2376,7 +2410,7 @@ walsh_012_16b(
 // 17入力の walsh_012 用サブルーティン
 int
 walsh_012_17b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2401,7 +2435,7 @@ walsh_012_17b(
 // 18入力の walsh_012 用サブルーティン
 int
 walsh_012_18b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2426,7 +2460,7 @@ walsh_012_18b(
 // 19入力の walsh_012 用サブルーティン
 int
 walsh_012_19b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2451,7 +2485,7 @@ walsh_012_19b(
 // 20入力の walsh_012 用サブルーティン
 int
 walsh_012_20b(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   SizeType offset,
   SizeType ni,
   int vec1[],
@@ -2476,7 +2510,7 @@ walsh_012_20b(
 // 0入力の walsh_012 本体
 int
 walsh_012_0(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2487,7 +2521,7 @@ walsh_012_0(
 // 1入力の walsh_012 本体
 int
 walsh_012_1(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2498,7 +2532,7 @@ walsh_012_1(
 // 2入力の walsh_012 本体
 int
 walsh_012_2(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2528,7 +2562,7 @@ walsh_012_2(
 // 3入力の walsh_012 本体
 int
 walsh_012_3(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2576,7 +2610,7 @@ walsh_012_3(
 // 4入力の walsh_012 本体
 int
 walsh_012_4(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2645,7 +2679,7 @@ walsh_012_4(
 // 5入力の walsh_012 本体
 int
 walsh_012_5(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2669,7 +2703,7 @@ walsh_012_5(
 // 6入力の walsh_012 本体
 int
 walsh_012_6(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2694,7 +2728,7 @@ walsh_012_6(
 // 7入力の walsh_012 本体
 int
 walsh_012_7(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2719,7 +2753,7 @@ walsh_012_7(
 // 8入力の walsh_012 本体
 int
 walsh_012_8(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2744,7 +2778,7 @@ walsh_012_8(
 // 9入力の walsh_012 本体
 int
 walsh_012_9(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2769,7 +2803,7 @@ walsh_012_9(
 // 10入力の walsh_012 本体
 int
 walsh_012_10(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2794,7 +2828,7 @@ walsh_012_10(
 // 11入力の walsh_012 本体
 int
 walsh_012_11(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2819,7 +2853,7 @@ walsh_012_11(
 // 12入力の walsh_012 本体
 int
 walsh_012_12(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2844,7 +2878,7 @@ walsh_012_12(
 // 13入力の walsh_012 本体
 int
 walsh_012_13(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2869,7 +2903,7 @@ walsh_012_13(
 // 14入力の walsh_012 本体
 int
 walsh_012_14(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2894,7 +2928,7 @@ walsh_012_14(
 // 15入力の walsh_012 本体
 int
 walsh_012_15(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2919,7 +2953,7 @@ walsh_012_15(
 // 16入力の walsh_012 本体
 int
 walsh_012_16(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2944,7 +2978,7 @@ walsh_012_16(
 // 17入力の walsh_012 本体
 int
 walsh_012_17(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2969,7 +3003,7 @@ walsh_012_17(
 // 18入力の walsh_012 本体
 int
 walsh_012_18(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -2994,7 +3028,7 @@ walsh_012_18(
 // 19入力の walsh_012 本体
 int
 walsh_012_19(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -3019,7 +3053,7 @@ walsh_012_19(
 // 20入力の walsh_01 本体
 int
 walsh_012_20(
-  const std::vector<TvFunc::WordType>& src_vec,
+  const TvWordVec& src_vec,
   int vec1[],
   int vec2[]
 )
@@ -3452,6 +3486,8 @@ TvFunc::walsh_w0(
       int ibits1 = ibits >> NIPW;
       // ブロック内の入力反転ビットマスク
       int ibits2 = ibits & ((1UL << NIPW) - 1UL);
+      // 重み別のビットマスク
+      const auto& wtable = weight_mask_table();
       for ( int b0: Range(mBlockNum) ) {
 	// ブロック番号中の1の重み
 	int u = count_onebits(b0);
@@ -3463,16 +3499,10 @@ TvFunc::walsh_w0(
 	if ( v > NIPW ) {
 	  continue;
 	}
-	int start = s_pidx[v];
-	int end = s_pidx[v + 1];
-	int* endp = &s_plist[end];
 	int b1 = b0 ^ ibits1;
 	TvFunc::WordType bitvec = mVector[b1];
-	for ( int* p = &s_plist[start]; p != endp; ++ p ) {
-	  int bitpos = *p ^ ibits2;
-	  c += (bitvec >> bitpos) & 1;
-	}
-	nall += (end - start);
+	c += count_onebits(bitvec & wtable.mask(ibits2, v));
+	nall += s_pidx[v + 1] - s_pidx[v];
       }
       ans = nall - c * 2;
     }
@@ -3524,6 +3554,8 @@ TvFunc::walsh_w1(
     int ibits1 = ibits >> NIPW;
     // ブロック内の入力反転ビットマスク
     int ibits2 = ibits & ((1UL << NIPW) - 1UL);
+    // 重み別のビットマスク
+    const auto& wtable = weight_mask_table();
 
     for ( int b0: Range(mBlockNum) ) {
       // ブロック番号中の1の重み
@@ -3536,9 +3568,6 @@ TvFunc::walsh_w1(
       if ( v > NIPW ) {
 	continue;
       }
-      int start = s_pidx[v];
-      int end = s_pidx[v + 1];
-      int* endp = &s_plist[end];
       int b1 = b0 ^ ibits1;
       TvFunc::WordType mask;
       if ( var < NIPW ) {
@@ -3556,11 +3585,8 @@ TvFunc::walsh_w1(
 	mask = 0UL - ((b0 >> var5) & 1UL);
       }
       TvFunc::WordType bitvec = mVector[b1] ^ mask;
-      for ( int* p = &s_plist[start]; p != endp; ++ p ) {
-	int bitpos = *p ^ ibits2;
-	c += (bitvec >> bitpos) & 1;
-      }
-      nall += (end - start);
+      c += count_onebits(bitvec & wtable.mask(ibits2, v));
+      nall += s_pidx[v + 1] - s_pidx[v];
     }
     ans = nall - c * 2;
   }
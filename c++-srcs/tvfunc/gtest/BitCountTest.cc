@@ -0,0 +1,103 @@
+/// @file BitCountTest.cc
+/// @brief BitCount のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "BitCount.h"
+#include "ym/TvFunc.h"
+#include <random>
+
+
+BEGIN_NAMESPACE_YM
+
+class BitCountTest :
+  public ::testing::TestWithParam<BitCount::Impl>
+{
+public:
+
+  void
+  SetUp() override
+  {
+    mOrigImpl = BitCount::impl();
+    if ( !BitCount::is_supported(GetParam()) ) {
+      GTEST_SKIP() << BitCount::impl_name(GetParam())
+		   << " is not supported";
+    }
+    BitCount::set_impl(GetParam());
+  }
+
+  void
+  TearDown() override
+  {
+    BitCount::set_impl(mOrigImpl);
+  }
+
+  BitCount::Impl mOrigImpl;
+
+  std::mt19937_64 mRandGen;
+
+};
+
+TEST_P(BitCountTest, count)
+{
+  // 端数の処理を確かめるために長さを変えて調べる．
+  for ( SizeType n = 0; n < 40; ++ n ) {
+    std::vector<BitCount::WordType> vec(n);
+    for ( auto& w: vec ) {
+      w = mRandGen();
+    }
+    BitCount::WordType mask = mRandGen();
+    SizeType exp_c = 0;
+    SizeType exp_cx = 0;
+    for ( auto w: vec ) {
+      exp_c += BitCount::count_scalar(w);
+      exp_cx += BitCount::count_scalar(w ^ mask);
+    }
+    EXPECT_EQ( exp_c, BitCount::count(vec.data(), n) );
+    EXPECT_EQ( exp_cx, BitCount::count_xor(vec.data(), n, mask) );
+  }
+}
+
+TEST_P(BitCountTest, walsh)
+{
+  // スカラー版と同じ Walsh 係数が得られることを確かめる．
+  const SizeType ni = 12;
+  std::vector<int> values(1 << ni);
+  for ( auto& v: values ) {
+    v = mRandGen() & 1;
+  }
+  TvFunc func{ni, values};
+  BitCount::set_impl(BitCount::Impl::Scalar);
+  auto exp_c1 = func.count_one();
+  auto exp_w0 = func.walsh_0();
+  std::vector<int> exp_w1(ni);
+  std::vector<int> exp_w2(ni * ni);
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    exp_w1[i] = func.walsh_1(i);
+    for ( SizeType j = 0; j < ni; ++ j ) {
+      exp_w2[i * ni + j] = func.walsh_2(i, j);
+    }
+  }
+
+  BitCount::set_impl(GetParam());
+  EXPECT_EQ( exp_c1, func.count_one() );
+  EXPECT_EQ( exp_w0, func.walsh_0() );
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    EXPECT_EQ( exp_w1[i], func.walsh_1(i) );
+    for ( SizeType j = 0; j < ni; ++ j ) {
+      EXPECT_EQ( exp_w2[i * ni + j], func.walsh_2(i, j) );
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllImpl,
+			 BitCountTest,
+			 ::testing::Values(BitCount::Impl::Scalar,
+					   BitCount::Impl::Popcnt,
+					   BitCount::Impl::Avx2,
+					   BitCount::Impl::Avx512));
+
+END_NAMESPACE_YM
@@ -91,4 +91,35 @@ TEST_F(Tv2BddTest, func1)
   check_func(func);
 }
 
+TEST_F(Tv2BddTest, func2)
+{
+  // 16入力の関数
+  const SizeType ni = 16;
+  std::vector<int> val_list(1 << ni);
+  for ( SizeType p = 0; p < val_list.size(); ++ p ) {
+    // 適当なハッシュ値の最下位ビットを用いる．
+    val_list[p] = ((p * 2654435761UL) >> 13) & 1;
+  }
+  TvFunc func{ni, val_list};
+
+  check_func(func);
+  auto bdd = Tv2Bdd::gen_bdd(func, mMgr);
+  std::vector<BddVar> var_list;
+  for ( SizeType i = 0; i < ni; ++ i ) {
+    var_list.push_back(mMgr.variable(i));
+  }
+  EXPECT_EQ( func, bdd.to_tvfunc(var_list) );
+}
+
+TEST_F(Tv2BddTest, var_list)
+{
+  // i 番目の入力が var_list[i] に対応する．
+  auto func = TvFunc::literal(3, 0, false) & TvFunc::literal(3, 2, true);
+  auto var0 = mMgr.variable(0);
+  auto var1 = mMgr.variable(1);
+  auto var2 = mMgr.variable(2);
+  auto bdd = Tv2Bdd::gen_bdd(func, mMgr, {var1, var2, var0});
+  EXPECT_EQ( var1 & ~var0, bdd );
+}
+
 END_NAMESPACE_YM
@@ -0,0 +1,145 @@
+
+/// @file TvBigFuncTest.cc
+/// @brief TvBigFunc のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "ym/TvBigFunc.h"
+#include <random>
+
+
+BEGIN_NAMESPACE_YM
+
+class TvBigFuncTest :
+  public ::testing::TestWithParam<SizeType>
+{
+public:
+
+  /// @brief ランダムな関数を作る．
+  TvFunc
+  random_func(
+    SizeType ni
+  )
+  {
+    std::uniform_int_distribution<TvFunc::WordType> rd;
+    SizeType nw = ni <= 6 ? 1 : (1UL << (ni - 6));
+    std::vector<TvFunc::WordType> data(nw);
+    for ( auto& w: data ) {
+      w = rd(mRandGen);
+    }
+    return TvFunc::from_raw_data(ni, std::move(data));
+  }
+
+  // 乱数生成器
+  std::mt19937 mRandGen;
+
+};
+
+TEST_P(TvBigFuncTest, convert)
+{
+  auto ni = GetParam();
+  auto f = random_func(ni);
+  TvBigFunc bf{f};
+  EXPECT_EQ( ni, bf.input_num() );
+  EXPECT_EQ( TvBigFunc::tile_num(ni), bf.tile_num() );
+  EXPECT_EQ( f, bf.to_tvfunc() );
+  for ( SizeType p = 0; p < (1UL << ni); p += 997 ) {
+    EXPECT_EQ( f.value(p), bf.value(p) );
+  }
+}
+
+TEST_P(TvBigFuncTest, logic_op)
+{
+  auto ni = GetParam();
+  auto f = random_func(ni);
+  auto g = random_func(ni);
+  TvBigFunc bf{f};
+  TvBigFunc bg{g};
+  EXPECT_EQ( ~f, (~bf).to_tvfunc() );
+  EXPECT_EQ( f & g, (bf & bg).to_tvfunc() );
+  EXPECT_EQ( f | g, (bf | bg).to_tvfunc() );
+  EXPECT_EQ( f ^ g, (bf ^ bg).to_tvfunc() );
+}
+
+TEST_P(TvBigFuncTest, literal)
+{
+  auto ni = GetParam();
+  for ( SizeType var = 0; var < ni; ++ var ) {
+    for ( bool inv: {false, true} ) {
+      EXPECT_EQ( TvFunc::literal(ni, var, inv),
+		 TvBigFunc::literal(ni, var, inv).to_tvfunc() );
+    }
+  }
+}
+
+TEST_P(TvBigFuncTest, cofactor)
+{
+  auto ni = GetParam();
+  auto f = random_func(ni);
+  TvBigFunc bf{f};
+  for ( SizeType var = 0; var < ni; ++ var ) {
+    for ( bool inv: {false, true} ) {
+      EXPECT_EQ( f.cofactor(var, inv), bf.cofactor(var, inv).to_tvfunc() );
+    }
+  }
+}
+
+TEST_P(TvBigFuncTest, count)
+{
+  auto ni = GetParam();
+  auto f = random_func(ni);
+  TvBigFunc bf{f};
+  EXPECT_EQ( f.count_one(), bf.count_one() );
+  EXPECT_EQ( f.count_zero(), bf.count_zero() );
+  EXPECT_EQ( f.walsh_0(), bf.walsh_0() );
+  for ( SizeType var = 0; var < ni; ++ var ) {
+    EXPECT_EQ( f.walsh_1(var), bf.walsh_1(var) );
+  }
+}
+
+TEST_P(TvBigFuncTest, check_sup)
+{
+  auto ni = GetParam();
+  // 偶数番目の変数のみに依存する関数を作る．
+  auto f = TvFunc::zero(ni);
+  for ( SizeType var = 0; var < ni; var += 2 ) {
+    f ^= TvFunc::literal(ni, var) & random_func(ni).cofactor(var, false);
+  }
+  for ( SizeType var = 1; var < ni; var += 2 ) {
+    f.cofactor_int(var, false);
+  }
+  TvBigFunc bf{f};
+  for ( SizeType var = 0; var < ni; ++ var ) {
+    EXPECT_EQ( f.check_sup(var), bf.check_sup(var) );
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(TvBigFuncTest,
+			 TvBigFuncTest,
+			 ::testing::Values(0, 5, 10, 16, 17, 18, 20));
+
+TEST(TvBigFuncTest_wide, basic)
+{
+  SizeType ni = 24;
+  auto x0 = TvBigFunc::literal(ni, 0);
+  auto x23 = TvBigFunc::literal(ni, 23);
+  auto f = x0 & x23;
+  EXPECT_EQ( 1ULL << (ni - 2), f.count_one() );
+  EXPECT_EQ( (1LL << ni) - (1LL << (ni - 1)), f.walsh_0() );
+  EXPECT_TRUE( f.check_sup(0) );
+  EXPECT_TRUE( f.check_sup(23) );
+  EXPECT_FALSE( f.check_sup(10) );
+  EXPECT_FALSE( f.check_sup(20) );
+  EXPECT_EQ( x0, f.cofactor(23, false) );
+  EXPECT_TRUE( f.cofactor(23, true).is_zero() );
+  EXPECT_TRUE( (f | ~f).is_one() );
+  EXPECT_EQ( 1, f.value((1ULL << 23) | 1ULL) );
+  EXPECT_EQ( 0, f.value(1ULL << 23) );
+  EXPECT_THROW( f.to_tvfunc(), std::invalid_argument );
+  EXPECT_THROW( TvBigFunc{33}, std::invalid_argument );
+}
+
+END_NAMESPACE_YM
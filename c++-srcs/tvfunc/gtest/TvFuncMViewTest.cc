@@ -0,0 +1,146 @@
+
+/// @file TvFuncMViewTest.cc
+/// @brief TvFuncMView のテストプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "ym/TvFuncM.h"
+#include <random>
+
+
+BEGIN_NAMESPACE_YM
+
+class TvFuncMViewTest :
+  public ::testing::TestWithParam<SizeType>
+{
+public:
+
+  /// @brief 出力ごとにサポートの異なる多出力関数を作る．
+  void
+  make_func(
+    SizeType ni,
+    SizeType no
+  )
+  {
+    std::uniform_int_distribution<TvFunc::WordType> rd;
+    SizeType nw = ni <= 6 ? 1 : (1UL << (ni - 6));
+    mFuncList.clear();
+    for ( SizeType i = 0; i < no; ++ i ) {
+      std::vector<TvFunc::WordType> data(nw);
+      for ( auto& w: data ) {
+	w = rd(mRandGen);
+      }
+      auto f = TvFunc::from_raw_data(ni, std::move(data));
+      // 出力によっていくつかの変数を取り除く．
+      for ( SizeType var = 0; var < ni; ++ var ) {
+	if ( ((i >> (var % 6)) & 1) == 0 ) {
+	  f.cofactor_int(var, false);
+	}
+      }
+      mFuncList.push_back(f);
+    }
+    mFuncM = TvFuncM{mFuncList};
+  }
+
+  std::mt19937 mRandGen;
+
+  std::vector<TvFunc> mFuncList;
+
+  TvFuncM mFuncM;
+
+};
+
+TEST_P(TvFuncMViewTest, slice)
+{
+  auto ni = GetParam();
+  SizeType no = 64;
+  make_func(ni, no);
+  auto view = mFuncM.view();
+  EXPECT_EQ( ni, view.input_num() );
+  EXPECT_EQ( no, view.output_num() );
+  for ( SizeType i = 0; i < no; ++ i ) {
+    EXPECT_EQ( mFuncList[i], view.slice(i) );
+    EXPECT_EQ( mFuncList[i], mFuncM.slice(i) );
+  }
+  auto sub = mFuncM.view(10, 5);
+  EXPECT_EQ( 5, sub.output_num() );
+  for ( SizeType i = 0; i < 5; ++ i ) {
+    EXPECT_EQ( mFuncList[i + 10], sub.slice(i) );
+  }
+  EXPECT_EQ( TvFuncM(std::vector<TvFunc>(mFuncList.begin() + 10,
+					 mFuncList.begin() + 15)),
+	     TvFuncM{sub} );
+  EXPECT_THROW( mFuncM.view(60, 5), std::out_of_range );
+}
+
+TEST_P(TvFuncMViewTest, sup)
+{
+  auto ni = GetParam();
+  SizeType no = 64;
+  make_func(ni, no);
+  for ( SizeType var = 0; var < ni; ++ var ) {
+    auto ans = mFuncM.sup_outputs(var);
+    ASSERT_EQ( no, ans.size() );
+    bool any = false;
+    for ( SizeType i = 0; i < no; ++ i ) {
+      EXPECT_EQ( mFuncList[i].check_sup(var), ans[i] );
+      any = any || ans[i];
+    }
+    EXPECT_EQ( any, mFuncM.check_sup(var) );
+    // 一部の出力のみ
+    auto sub = mFuncM.view(0, 1);
+    EXPECT_EQ( mFuncList[0].check_sup(var), sub.check_sup(var) );
+  }
+}
+
+TEST_P(TvFuncMViewTest, sym)
+{
+  auto ni = GetParam();
+  SizeType no = 16;
+  make_func(ni, no);
+  // 両方の変数を取り除いた出力は対称となる．
+  for ( SizeType var1 = 0; var1 < ni; ++ var1 ) {
+    for ( SizeType var2 = 0; var2 < var1; ++ var2 ) {
+      for ( bool inv: {false, true} ) {
+	auto ans = mFuncM.sym_outputs(var1, var2, inv);
+	bool all = true;
+	for ( SizeType i = 0; i < no; ++ i ) {
+	  EXPECT_EQ( mFuncList[i].check_sym(var1, var2, inv), ans[i] );
+	  all = all && ans[i];
+	}
+	EXPECT_EQ( all, mFuncM.check_sym(var1, var2, inv) );
+	EXPECT_EQ( all, mFuncM.check_sym(var2, var1, inv) );
+      }
+    }
+  }
+
+  // 同じ変数や範囲外の変数は例外となる．
+  EXPECT_THROW( mFuncM.check_sym(0, 0), std::invalid_argument );
+  EXPECT_THROW( mFuncM.check_sym(0, ni), std::out_of_range );
+  EXPECT_THROW( mFuncM.sym_outputs(ni, 0), std::out_of_range );
+}
+
+TEST_P(TvFuncMViewTest, cofactor)
+{
+  auto ni = GetParam();
+  SizeType no = 8;
+  make_func(ni, no);
+  auto sub = mFuncM.view(2, 4);
+  for ( SizeType var = 0; var < ni; ++ var ) {
+    for ( bool inv: {false, true} ) {
+      auto cf = sub.cofactor(var, inv);
+      for ( SizeType i = 0; i < 4; ++ i ) {
+	EXPECT_EQ( mFuncList[i + 2].cofactor(var, inv), cf.slice(i) );
+      }
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(TvFuncMViewTest,
+			 TvFuncMViewTest,
+			 ::testing::Values(1, 3, 6, 7, 10));
+
+END_NAMESPACE_YM
@@ -43,6 +43,44 @@ TEST(TvFuncMove, move)
   EXPECT_EQ( TvFunc::one(20), g );
 }
 
+TEST(TvFuncMove, copy_small)
+{
+  // オブジェクト内に格納される場合
+  auto f = TvFunc::posi_literal(7, 6);
+  auto g = TvFunc::nega_literal(7, 0);
+
+  for ( auto i = 0; i < 10000; ++ i ) {
+    auto tmp = f;
+    f = g;
+    g = tmp;
+  }
+
+  EXPECT_EQ( TvFunc::posi_literal(7, 6), f );
+  EXPECT_EQ( TvFunc::nega_literal(7, 0), g );
+}
+
+TEST(TvFuncMove, move_mixed)
+{
+  // 格納方法の異なるオブジェクトの間でのムーブ
+  auto f = TvFunc::posi_literal(4, 1);
+  auto g = TvFunc::nega_literal(10, 8);
+
+  for ( auto i = 0; i < 10001; ++ i ) {
+    auto tmp = std::move(f);
+    f = std::move(g);
+    g = std::move(tmp);
+  }
+
+  EXPECT_EQ( TvFunc::nega_literal(10, 8), f );
+  EXPECT_EQ( TvFunc::posi_literal(4, 1), g );
+
+  auto h = f;
+  h = g;
+  EXPECT_EQ( g, h );
+  h = f;
+  EXPECT_EQ( f, h );
+}
+
 TEST(TvFuncMove, copy_m)
 {
   std::vector<TvFunc> f_list(2);
@@ -32,6 +32,8 @@ class Bdd :
   public BddMgrHolder
 {
   friend class BddMgrHolder;
+  friend class BddSampler;
+  friend class BddImage;
 
 public:
 
@@ -200,6 +202,31 @@ public:
     return cofactor(cube);
   }
 
+  /// @brief 存在量化を行う．
+  /// @return 結果を返す．
+  Bdd
+  exist(
+    const BddVarSet& var_set ///< [in] 量化する変数の集合
+  ) const;
+
+  /// @brief 全称量化を行う．
+  /// @return 結果を返す．
+  Bdd
+  forall(
+    const BddVarSet& var_set ///< [in] 量化する変数の集合
+  ) const;
+
+  /// @brief 論理積と存在量化を同時に行う．
+  /// @return ∃var_set.(this ∧ right) を返す．
+  ///
+  /// 論理積の結果を作らずに計算するので，
+  /// and_op() と exist() を続けて行うよりも効率がよい．
+  Bdd
+  and_exist(
+    const Bdd& right,        ///< [in] オペランド
+    const BddVarSet& var_set ///< [in] 量化する変数の集合
+  ) const;
+
   /// @}
   //////////////////////////////////////////////////////////////////////
 
@@ -323,6 +350,20 @@ public:
     return cofactor_int(cube);
   }
 
+  /// @brief 存在量化を行って代入する．
+  /// @return 自分自身への参照を返す．
+  Bdd&
+  exist_int(
+    const BddVarSet& var_set ///< [in] 量化する変数の集合
+  );
+
+  /// @brief 全称量化を行って代入する．
+  /// @return 自分自身への参照を返す．
+  Bdd&
+  forall_int(
+    const BddVarSet& var_set ///< [in] 量化する変数の集合
+  );
+
   /// @brief If-Then-Else 演算
   static
   Bdd
@@ -583,6 +624,38 @@ public:
   SizeType
   size() const;
 
+  /// @brief 真となる入力割当(最小項)の数を数える．
+  ///
+  /// - nvars 個の変数上の関数とみなして数える．
+  /// - nvars がサポート変数の数より小さい場合には
+  ///   std::invalid_argument 例外を送出する．
+  /// - 2^nvars が double の範囲を越える場合には無限大となるので
+  ///   log2_minterm_count() か minterm_count_str() を用いること．
+  double
+  minterm_count(
+    SizeType nvars ///< [in] 変数の数
+  ) const;
+
+  /// @brief 真となる入力割当の数の2を底とする対数を求める．
+  ///
+  /// - 定数0の場合は -inf を返す．
+  /// - nvars がサポート変数の数より小さい場合には
+  ///   std::invalid_argument 例外を送出する．
+  double
+  log2_minterm_count(
+    SizeType nvars ///< [in] 変数の数
+  ) const;
+
+  /// @brief 真となる入力割当の数を厳密に数える．
+  /// @return 10進表記の文字列を返す．
+  ///
+  /// - nvars がサポート変数の数より小さい場合には
+  ///   std::invalid_argument 例外を送出する．
+  std::string
+  minterm_count_str(
+    SizeType nvars ///< [in] 変数の数
+  ) const;
+
   /// @brief リテラルのリストの変換する．
   ///
   /// - is_cube() == true が成り立っていると仮定している．
@@ -600,6 +673,18 @@ public:
     const std::vector<BddVar> var_list ///< [in] 入力変数のリスト
   ) const;
 
+  /// @brief 内容を真理値表に変換する．
+  ///
+  /// - var_list[i] が結果の i 番目の入力となる．
+  /// - var_list に含まれていない変数があった場合や
+  ///   var_list に同じ変数が含まれていた場合には
+  ///   std::invalid_argument 例外を送出する．
+  /// - 不正値の場合には TvFunc::invalid() を返す．
+  TvFunc
+  to_tvfunc(
+    const std::vector<BddVar>& var_list ///< [in] 入力変数のリスト
+  ) const;
+
   /// @brief 内容を出力する．
   void
   display(
@@ -835,6 +920,25 @@ private:
                     /// cube.is_cube() = true でなければならない．
   ) const;
 
+  /// @brief 存在量化の下請け関数
+  DdEdge
+  _exist(
+    const BddVarSet& var_set ///< [in] 量化する変数の集合
+  ) const;
+
+  /// @brief 全称量化の下請け関数
+  DdEdge
+  _forall(
+    const BddVarSet& var_set ///< [in] 量化する変数の集合
+  ) const;
+
+  /// @brief and_exist の下請け関数
+  DdEdge
+  _and_exist(
+    const Bdd& right,        ///< [in] オペランド
+    const BddVarSet& var_set ///< [in] 量化する変数の集合
+  ) const;
+
   /// @brief 複合compose演算
   DdEdge
   _multi_compose(
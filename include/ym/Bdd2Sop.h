@@ -0,0 +1,64 @@
+#ifndef BDD2SOP_H
+#define BDD2SOP_H
+
+/// @file Bdd2Sop.h
+/// @brief Bdd2Sop のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/Bdd.h"
+#include "ym/BddVar.h"
+#include "ym/SopCube.h"
+
+
+BEGIN_NAMESPACE_YM
+
+//////////////////////////////////////////////////////////////////////
+/// @class Bdd2Sop Bdd2Sop.h "Bdd2Sop.h"
+/// @brief Bdd に対して積和形論理式に関連した処理を行うクラス
+///
+/// Tv2Sop と異なり真理値表を作らないので，
+/// TvFunc::kMaxNi を超える入力数の関数も扱える．
+///
+/// 実はただの関数群の定義
+//////////////////////////////////////////////////////////////////////
+class Bdd2Sop
+{
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief Minato-Morreale のアルゴリズムで非冗長積和形を求める．
+  ///
+  /// - 結果のキューブの i 番目の変数は var_list[i] に対応する．
+  /// - f が var_list に含まれない変数に依存する場合には
+  ///   std::invalid_argument 例外を送出する．
+  static
+  std::vector<SopCube>
+  isop(
+    const Bdd& f,                       ///< [in] 対象の関数
+    const std::vector<BddVar>& var_list ///< [in] 変数のリスト
+  );
+
+  /// @brief Minato-Morreale のアルゴリズムで非冗長積和形を求める．
+  ///
+  /// - 結果のキューブの i 番目の変数は var_list[i] に対応する．
+  /// - f と dc は同じ BddMgr に属していなければならない．
+  /// - f と dc が var_list に含まれない変数に依存する場合には
+  ///   std::invalid_argument 例外を送出する．
+  static
+  std::vector<SopCube>
+  isop(
+    const Bdd& f,                       ///< [in] 対象の関数
+    const Bdd& dc,                      ///< [in] ドントケアの関数
+    const std::vector<BddVar>& var_list ///< [in] 変数のリスト
+  );
+
+};
+
+END_NAMESPACE_YM
+
+#endif // BDD2SOP_H
@@ -0,0 +1,274 @@
+#ifndef BDDIMAGE_H
+#define BDDIMAGE_H
+
+/// @file BddImage.h
+/// @brief BddImage のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "ym/Literal.h"
+
+
+BEGIN_NAMESPACE_YM_DD
+
+//////////////////////////////////////////////////////////////////////
+/// @class BddImage BddImage.h "ym/BddImage.h"
+/// @brief 固定長形式でファイルに書き出された BDD のイメージ
+///
+/// Bdd::dump() の形式は可変長の整数で書かれているので
+/// 読み込みの際に全てのノードを復号する必要がある．
+/// こちらの形式はノードを固定長(64ビット x 3)の配列として書き出すので
+/// ファイルをそのままメモリにマップ(mmap)して用いることができる．
+/// - eval(), minterm_count(), for_each_path() はマップしたイメージ上で
+///   直接計算を行う．ノードのテーブルは作らない．
+/// - BddMgr::load_image() でマネージャに読み込むこともできる．
+///   この場合もノード数があらかじめわかっているので表の拡張は起こらない．
+///
+/// ファイルの形式は以下の通り．全て 64ビットのネイティブバイトオーダ．
+/// - ヘッダ(8ワード): シグネチャ，バイトオーダの印，変数の数，
+///   根の数，ノード数，予備(3ワード)
+/// - レベルごとの変数番号(変数の数)
+/// - 根の枝(根の数)
+/// - ノード(ノード数 x 3): レベル，0枝，1枝
+///
+/// 枝は 0: 定数0，1: 定数1，それ以外は ノード番号 * 2 + 反転属性
+/// で表す．ノード番号は 1 から始まり，子供のノードは親のノードより
+/// 前にある．
+//////////////////////////////////////////////////////////////////////
+class BddImage
+{
+public:
+
+  /// @brief ファイルをマップするコンストラクタ
+  ///
+  /// - ファイルが開けない場合には std::invalid_argument 例外を送出する．
+  /// - 形式が不正な場合には std::invalid_argument 例外を送出する．
+  explicit
+  BddImage(
+    const std::string& filename ///< [in] ファイル名
+  );
+
+  /// @brief コピーコンストラクタは禁止
+  BddImage(
+    const BddImage& src
+  ) = delete;
+
+  /// @brief ムーブコンストラクタ
+  BddImage(
+    BddImage&& src
+  );
+
+  /// @brief コピー代入演算子は禁止
+  BddImage&
+  operator=(
+    const BddImage& src
+  ) = delete;
+
+  /// @brief デストラクタ
+  ///
+  /// マップを解除する．
+  ~BddImage();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // イメージの書き出し
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief BDD のリストをイメージの形式で書き出す．
+  ///
+  /// bdd_list の BDD は全て同じマネージャに属していなければならない．
+  static
+  void
+  write(
+    std::ostream& s,                 ///< [in] 出力ストリーム(バイナリモード)
+    const std::vector<Bdd>& bdd_list ///< [in] BDD のリスト
+  );
+
+  /// @brief BDD のリストをイメージの形式でファイルに書き出す．
+  ///
+  /// ファイルが開けない場合には std::invalid_argument 例外を送出する．
+  static
+  void
+  write(
+    const std::string& filename,     ///< [in] ファイル名
+    const std::vector<Bdd>& bdd_list ///< [in] BDD のリスト
+  );
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 内容を取り出す関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 変数の数(レベルの最大値 + 1)を返す．
+  SizeType
+  variable_num() const
+  {
+    return mHeader[2];
+  }
+
+  /// @brief 根の数を返す．
+  SizeType
+  root_num() const
+  {
+    return mHeader[3];
+  }
+
+  /// @brief ノード数を返す．
+  SizeType
+  node_num() const
+  {
+    return mHeader[4];
+  }
+
+  /// @brief レベルに対応する変数番号を返す．
+  SizeType
+  level_to_varid(
+    SizeType level ///< [in] レベル ( 0 <= level < variable_num() )
+  ) const
+  {
+    if ( level >= variable_num() ) {
+      throw std::out_of_range{"level is out of range"};
+    }
+    return mVarIdArray[level];
+  }
+
+  /// @brief 根の枝を返す．
+  SizeType
+  root(
+    SizeType pos ///< [in] 位置 ( 0 <= pos < root_num() )
+  ) const
+  {
+    if ( pos >= root_num() ) {
+      throw std::out_of_range{"pos is out of range"};
+    }
+    return mRootArray[pos];
+  }
+
+  /// @brief ノードのレベルを返す．
+  SizeType
+  node_level(
+    SizeType id ///< [in] ノード番号 ( 1 <= id <= node_num() )
+  ) const
+  {
+    return _node(id)[0];
+  }
+
+  /// @brief ノードの0枝を返す．
+  SizeType
+  node_edge0(
+    SizeType id ///< [in] ノード番号 ( 1 <= id <= node_num() )
+  ) const
+  {
+    return _node(id)[1];
+  }
+
+  /// @brief ノードの1枝を返す．
+  SizeType
+  node_edge1(
+    SizeType id ///< [in] ノード番号 ( 1 <= id <= node_num() )
+  ) const
+  {
+    return _node(id)[2];
+  }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // イメージ上で直接計算を行う関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 評価を行う．
+  bool
+  eval(
+    SizeType pos,                   ///< [in] 根の位置
+    const std::vector<bool>& inputs ///< [in] 変数番号をキーにした入力値
+  ) const;
+
+  /// @brief 真となる入力割当の数を数える．
+  ///
+  /// nvars は根のサポート数以上でなければならない．
+  /// 2^nvars が double で表せない場合には無限大となる．
+  double
+  minterm_count(
+    SizeType pos,  ///< [in] 根の位置
+    SizeType nvars ///< [in] 変数の数
+  ) const;
+
+  /// @brief 定数1に至る経路を列挙する．
+  ///
+  /// 経路ごとにその上のリテラルのリストを引数にして func を呼び出す．
+  /// func が false を返したらそこで列挙を打ち切る．
+  /// 再帰を用いないので深い BDD でもスタックはあふれない．
+  void
+  for_each_path(
+    SizeType pos,  ///< [in] 根の位置
+    std::function<bool(const std::vector<Literal>&)> func ///< [in] 処理関数
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ノードの先頭のアドレスを返す．
+  const std::uint64_t*
+  _node(
+    SizeType id ///< [in] ノード番号
+  ) const
+  {
+    if ( id == 0 || id > node_num() ) {
+      throw std::out_of_range{"id is out of range"};
+    }
+    return mNodeArray + (id - 1) * 3;
+  }
+
+  /// @brief 枝の子供の枝が正しいか調べる．
+  ///
+  /// 子供のノード番号は親より小さくなければならない．
+  /// 不正な場合には std::invalid_argument 例外を送出する．
+  void
+  _check_child(
+    SizeType id,   ///< [in] 親のノード番号
+    SizeType edge  ///< [in] 子供の枝
+  ) const
+  {
+    if ( (edge >> 1) >= id ) {
+      throw std::invalid_argument{"BddImage: broken node array"};
+    }
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // マップした領域の先頭
+  void* mAddr{nullptr};
+
+  // マップした領域のサイズ
+  SizeType mSize{0};
+
+  // ヘッダ
+  const std::uint64_t* mHeader{nullptr};
+
+  // レベルごとの変数番号の配列
+  const std::uint64_t* mVarIdArray{nullptr};
+
+  // 根の枝の配列
+  const std::uint64_t* mRootArray{nullptr};
+
+  // ノードの配列
+  const std::uint64_t* mNodeArray{nullptr};
+
+};
+
+END_NAMESPACE_YM_DD
+
+#endif // BDDIMAGE_H
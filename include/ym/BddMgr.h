@@ -94,6 +94,71 @@ public:
     const std::vector<BddVar>& order_list ///< [in] 変数順を表すリスト
   );
 
+  /// @brief sifting を用いて変数順の最適化を行う．
+  ///
+  /// 各変数をノード数が最小となる位置に移動させる．
+  /// ノード数の増加率と制限時間で探索を打ち切る．
+  void
+  dvo_sift();
+
+  /// @brief ウィンドウ置換を用いて変数順の最適化を行う．
+  ///
+  /// 隣り合う width 個の変数の全ての順列を試す．
+  /// width は 2 から 4 の範囲に丸められる．
+  void
+  dvo_window(
+    SizeType width = 3 ///< [in] ウィンドウ幅
+  );
+
+  /// @brief sifting で許容するノード数の増加率を返す．
+  double
+  dvo_max_growth() const;
+
+  /// @brief sifting で許容するノード数の増加率を設定する．
+  ///
+  /// 変数の移動中にノード数がそれまでの最小値のこの倍数を越えたら
+  /// その方向への移動を打ち切る．
+  /// 1.0 未満の値は 1.0 に丸められる．
+  void
+  set_dvo_max_growth(
+    double growth ///< [in] 増加率(デフォルトは 1.2)
+  );
+
+  /// @brief 変数順の最適化の制限時間を返す．
+  ///
+  /// 単位はミリ秒で 0 の場合は制限なし．
+  SizeType
+  dvo_time_limit() const;
+
+  /// @brief 変数順の最適化の制限時間を設定する．
+  ///
+  /// 制限時間を過ぎた場合にはその時点で最良の変数順で打ち切る．
+  void
+  set_dvo_time_limit(
+    SizeType limit ///< [in] 制限時間(ミリ秒), 0 の場合は制限なし
+  );
+
+  /// @brief グループ sifting を許可する．
+  ///
+  /// 対称な変数をまとめて移動させる．
+  void
+  enable_dvo_group();
+
+  /// @brief グループ sifting を禁止する．
+  void
+  disable_dvo_group();
+
+  /// @brief 自動的な変数順の最適化を許可する．
+  ///
+  /// 演算の開始時にノード数が前回の最適化後の2倍を越えていたら
+  /// dvo_sift() を行う．
+  void
+  enable_auto_dvo();
+
+  /// @brief 自動的な変数順の最適化を禁止する．
+  void
+  disable_auto_dvo();
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -124,6 +189,7 @@ public:
   /// - ただし，長さはvar_listのサイズのべき乗である必要がある．
   /// - for some reason, この文字列は big endian となっている．
   /// - 0文字目が(1, 1, 1, 1)に対応する
+  /// - Bdd::to_truth() と同様に var_list の先頭が MSB となる．
   /// - var_list が省略された場合は自動的に適切な変数リストを用いる．
   /// - 不正な形式の場合は std::invalid_argument 例外を送出する．
   Bdd
@@ -133,6 +199,20 @@ public:
     = {}
   );
 
+  /// @brief 真理値表から BDD を作る．
+  ///
+  /// - func の i 番目の入力を var_list[i] に対応させる．
+  /// - var_list が省略された場合は i 番目の入力を variable(i) に対応させる．
+  /// - var_list.size() < func.input_num() の場合や
+  ///   var_list に同じ変数が含まれる場合は std::invalid_argument 例外を送出する．
+  /// - ノードは下のレベルから直接作られるので ITE 演算は用いない．
+  Bdd
+  from_tvfunc(
+    const TvFunc& func,                 ///< [in] 真理値表
+    const std::vector<BddVar>& var_list ///< [in] 変数のリスト
+    = {}
+  );
+
   /// @brief 論理式から BDD を作る．
   ///
   /// - var_list が省略された場合は自動的に適切な変数リストを用いる．
@@ -158,6 +238,19 @@ public:
     BinDec& s ///< [in] 入力ストリーム
   );
 
+  /// @brief BddImage の内容を読み込む．
+  /// @return 生成されたBDDのリストを返す．
+  ///
+  /// restore() と異なりノード数があらかじめわかっているので
+  /// 表の拡張を行わずにノードを作る．
+  /// イメージの変数順がこのマネージャと異なる場合には
+  /// イメージの変数順に変更される．
+  /// 不正な形式の場合は std::invalid_argument 例外を送出する．
+  std::vector<Bdd>
+  load_image(
+    const BddImage& image ///< [in] イメージ
+  );
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -165,6 +258,9 @@ public:
   //////////////////////////////////////////////////////////////////////
 
   /// @brief ガーベージコレクションを行う．
+  ///
+  /// しきい値に関係なく参照されていないノードを全て削除する．
+  /// 通常は演算の開始時に必要に応じて自動的に行われる．
   void
   garbage_collection();
 
@@ -172,11 +268,13 @@ public:
   SizeType
   node_num() const;
 
-  /// @brief GC を起動するしきい値を返す．
+  /// @brief GC を起動するしきい値の下限を返す．
+  ///
+  /// 実際のしきい値は生きているノード数に応じて大きくなる．
   SizeType
   gc_limit() const;
 
-  /// @brief GC を起動するしきい値を設定する．
+  /// @brief GC を起動するしきい値の下限を設定する．
   void
   set_gc_limit(
     SizeType limit
@@ -189,9 +287,25 @@ public:
   enable_gc();
 
   /// @brief GC を禁止する．
+  ///
+  /// 禁止されている間は garbage_collection() を呼んでも何もしない．
+  /// ただし，変数順の変更を行うと参照されていないノードは削除される．
   void
   disable_gc();
 
+  /// @brief 演算に用いるスレッド数を返す．
+  SizeType
+  thread_num() const;
+
+  /// @brief 演算に用いるスレッド数を設定する．
+  ///
+  /// - 0 の場合にはハードウェアのスレッド数を用いる．
+  /// - 1 の場合(デフォルト)には並列実行を行わない．
+  void
+  set_thread_num(
+    SizeType num ///< [in] スレッド数
+  );
+
   /// @brief 等価比較演算子
   bool
   operator==(
@@ -0,0 +1,147 @@
+#ifndef BDDSAMPLER_H
+#define BDDSAMPLER_H
+
+/// @file BddSampler.h
+/// @brief BddSampler のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "ym/BddVar.h"
+#include <random>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+//////////////////////////////////////////////////////////////////////
+/// @class BddSampler BddSampler.h "ym/BddSampler.h"
+/// @brief BDD の充足割当を一様にサンプリングするクラス
+///
+/// コンストラクタで各ノードの密度(1となる割合)を一度だけ求めておき，
+/// サンプリングでは根から葉への1本の経路をたどる．
+/// そのため1回あたりの計算量は BDD の深さに比例する．
+///
+/// 割当は変数リスト var_list の順に並べる．
+/// var_list 中でサポートでない変数の値は一様にランダムとなる．
+///
+/// 元の BDD の構造をコピーして保持するので，
+/// 構築後は元の BDD やマネージャとは独立に用いることができる．
+//////////////////////////////////////////////////////////////////////
+class BddSampler
+{
+public:
+
+  /// @brief コンストラクタ
+  ///
+  /// - bdd が定数0の場合には std::invalid_argument 例外を送出する．
+  /// - bdd のサポートが var_list に含まれていない場合には
+  ///   std::invalid_argument 例外を送出する．
+  BddSampler(
+    const Bdd& bdd,                     ///< [in] 対象の BDD
+    const std::vector<BddVar>& var_list ///< [in] 変数のリスト
+  );
+
+  /// @brief デストラクタ
+  ~BddSampler() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 変数の数を返す．
+  SizeType
+  variable_num() const
+  {
+    return mVarNum;
+  }
+
+  /// @brief 1つの割当を表すのに必要なワード数を返す．
+  SizeType
+  row_size() const
+  {
+    return (mVarNum + 63) / 64;
+  }
+
+  /// @brief 充足割当を一つ求める．
+  /// @return var_list の順に並べた値のベクタを返す．
+  std::vector<bool>
+  sample(
+    std::mt19937& randgen ///< [in] 乱数生成器
+  ) const;
+
+  /// @brief 充足割当をまとめて求める．
+  /// @return 割当をビット行列の形で返す．
+  ///
+  /// i 番目の割当は [i * row_size(), (i + 1) * row_size()) の
+  /// ワードに格納される．var_list の j 番目の変数の値は
+  /// その (j / 64) 番目のワードの (j % 64) ビット目となる．
+  /// 余ったビットは 0 となる．
+  std::vector<std::uint64_t>
+  sample_batch(
+    SizeType num,         ///< [in] 割当の数
+    std::mt19937& randgen ///< [in] 乱数生成器
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ノードの情報
+  ///
+  /// 枝は 0: 定数0，1: 定数1，それ以外は (ノード番号 + 1) * 2 + 反転属性
+  /// で表す．
+  struct Node
+  {
+    SizeType mPos;     ///< 変数の位置
+    SizeType mEdge0;   ///< 0枝
+    SizeType mEdge1;   ///< 1枝
+    double mLogPosi;   ///< 自身の密度の対数
+    double mLogNega;   ///< 否定の密度の対数
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 1つの割当を row に書き込む．
+  void
+  sample_row(
+    std::mt19937& randgen, ///< [in] 乱数生成器
+    std::uint64_t* row     ///< [out] 結果を書き込む領域
+  ) const;
+
+  /// @brief 枝の密度の対数を返す．
+  double
+  log_density(
+    SizeType edge ///< [in] 枝
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 変数の数
+  SizeType mVarNum;
+
+  // ノードのリスト
+  // 子供のノードは親のノードより前にある．
+  std::vector<Node> mNodeList;
+
+  // 根の枝
+  SizeType mRoot;
+
+};
+
+END_NAMESPACE_YM_DD
+
+#endif // BDDSAMPLER_H
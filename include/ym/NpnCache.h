@@ -0,0 +1,218 @@
+#ifndef YM_NPNCACHE_H
+#define YM_NPNCACHE_H
+
+/// @file ym/NpnCache.h
+/// @brief NpnCache のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "ym/NpnMap.h"
+#include "ym/TvFunc.h"
+#include <list>
+
+
+BEGIN_NAMESPACE_YM_LOGIC
+
+//////////////////////////////////////////////////////////////////////
+/// @class NpnCache NpnCache.h "ym/NpnCache.h"
+/// @ingroup LogicGroup
+/// @brief NPN正規形の計算結果を記録しておくキャッシュ
+///
+/// 関数をキーにして正規形と正規化マップを記録しておき，
+/// 同じ関数に対する2回目以降の問い合わせでは計算を行わない．
+///
+/// 関数のリストを受け取るバッチ版の関数では
+/// - まずリスト内の同一の関数をまとめる．
+/// - キャッシュに記録されていない関数のみを複数のスレッドで計算する．
+///
+/// max_size に 0 以外の値を指定した場合には記録する関数の数の上限となり，
+/// 溢れた場合には最も長い間参照されていない関数から捨てられる．
+///
+/// キャッシュ自体の操作は呼び出し側のスレッドのみで行うので，
+/// 1つの NpnCache を複数のスレッドから同時に使うことはできない．
+//////////////////////////////////////////////////////////////////////
+class NpnCache
+{
+public:
+
+  /// @brief コンストラクタ
+  explicit
+  NpnCache(
+    SizeType max_size = 0 ///< [in] 記録する関数の数の上限
+                          ///<      0 の場合には上限なし
+  );
+
+  /// @brief デストラクタ
+  ~NpnCache() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 正規形を返す．
+  TvFunc
+  cannonical(
+    const TvFunc& func ///< [in] 対象の関数
+  );
+
+  /// @brief 正規化マップを返す．
+  ///
+  /// TvFunc::npn_cannonical_map() と同じ結果を返す．
+  NpnMap
+  cannonical_map(
+    const TvFunc& func ///< [in] 対象の関数
+  );
+
+  /// @brief 複数の関数の正規形を返す．
+  /// @return func_list と同じ順に結果を格納したリストを返す．
+  std::vector<TvFunc>
+  cannonical(
+    const std::vector<TvFunc>& func_list, ///< [in] 対象の関数のリスト
+    SizeType thread_num = 0               ///< [in] スレッド数
+                                          ///<      0 の場合にはハードウェアで決める．
+  );
+
+  /// @brief 複数の関数の正規化マップを返す．
+  /// @return func_list と同じ順に結果を格納したリストを返す．
+  std::vector<NpnMap>
+  cannonical_map(
+    const std::vector<TvFunc>& func_list, ///< [in] 対象の関数のリスト
+    SizeType thread_num = 0               ///< [in] スレッド数
+                                          ///<      0 の場合にはハードウェアで決める．
+  );
+
+  /// @brief 記録されている関数の数を返す．
+  SizeType
+  size() const
+  {
+    return mHash.size();
+  }
+
+  /// @brief 記録する関数の数の上限を返す．
+  ///
+  /// 0 の場合には上限なし．
+  SizeType
+  max_size() const
+  {
+    return mMaxSize;
+  }
+
+  /// @brief 記録されていた関数の問い合わせ回数を返す．
+  SizeType
+  hit_num() const
+  {
+    return mHitNum;
+  }
+
+  /// @brief 計算を行った関数の数を返す．
+  SizeType
+  miss_num() const
+  {
+    return mMissNum;
+  }
+
+  /// @brief 内容をクリアする．
+  ///
+  /// 統計情報もクリアされる．
+  void
+  clear();
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 記録する内容
+  struct Entry
+  {
+    // 元の関数
+    TvFunc mFunc;
+
+    // 正規形
+    TvFunc mCfunc;
+
+    // 正規化マップ
+    NpnMap mCmap;
+  };
+
+  // 参照順に並べたリストの型
+  // 先頭が最も新しい．
+  using EntryList = std::list<Entry>;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 1つの関数の結果を探す．
+  ///
+  /// 記録されていなければ計算して登録する．
+  const Entry&
+  find(
+    const TvFunc& func
+  );
+
+  /// @brief 複数の関数の結果を探す．
+  ///
+  /// 記録されていない関数は並列に計算して登録する．
+  std::vector<Entry>
+  find_list(
+    const std::vector<TvFunc>& func_list,
+    SizeType thread_num
+  );
+
+  /// @brief 計算結果を登録する．
+  const Entry&
+  put(
+    Entry&& entry
+  );
+
+  /// @brief 記録を探す．
+  /// @return 見つからなければ nullptr を返す．
+  ///
+  /// 見つかった場合には最も新しい記録とする．
+  const Entry*
+  get(
+    const TvFunc& func
+  );
+
+  /// @brief 1つの関数の正規形を計算する．
+  static
+  Entry
+  calc(
+    const TvFunc& func
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 記録する関数の数の上限
+  SizeType mMaxSize;
+
+  // 記録の本体
+  EntryList mEntryList;
+
+  // 関数をキーにして mEntryList 中の位置を保持するハッシュ表
+  std::unordered_map<TvFunc, EntryList::iterator> mHash;
+
+  // 記録されていた回数
+  SizeType mHitNum{0};
+
+  // 計算を行った回数
+  SizeType mMissNum{0};
+
+};
+
+END_NAMESPACE_YM_LOGIC
+
+#endif // YM_NPNCACHE_H
@@ -0,0 +1,197 @@
+#ifndef YM_NPNSIGNATURE_H
+#define YM_NPNSIGNATURE_H
+
+/// @file ym/NpnSignature.h
+/// @brief NpnSignature のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "ym/NpnMap.h"
+#include "ym/TvFunc.h"
+
+
+BEGIN_NAMESPACE_YM_LOGIC
+
+//////////////////////////////////////////////////////////////////////
+/// @class NpnSignature NpnSignature.h "ym/NpnSignature.h"
+/// @ingroup LogicGroup
+/// @brief NPN変換で不変な関数の特徴量
+///
+/// 以下の値からなる．
+/// - 入力数とサポート変数の数
+/// - 0次の Walsh 係数の絶対値
+/// - サポート変数ごとの1次の Walsh 係数の絶対値と
+///   2次の Walsh 係数の絶対値を降順に並べたもの．
+///   これを変数ごとのキーとして，キーの降順に並べる．
+///
+/// NPN同値な関数は必ず同じシグネチャを持つが，
+/// 同じシグネチャを持つ関数が NPN同値とは限らない．
+/// Walsh 係数は TvFunc::walsh_012() の1回の呼び出しで求める．
+///
+/// 同時に準正規形への変換マップも求める．
+/// 準正規形は以下の方法で求める．
+/// - 0次の係数が非負になるように出力の極性を決める．
+/// - 1次の係数が非負になるように入力の極性を決める．
+/// - サポート変数をキーの降順に並べ，その後ろに独立な変数を置く．
+/// 係数が 0 の場合や同じキーの変数がある場合には
+/// 元の関数の変数順や極性に依存するので，
+/// NPN同値な関数が異なる準正規形になる場合がある．
+/// 準正規形の入力数は元の関数と等しい．
+/// is_unique() が true の場合には極性と変数順が一意に決まるので，
+/// そのような関数同士は準正規形が等しい時，かつその時に限り NPN同値となる．
+//////////////////////////////////////////////////////////////////////
+class NpnSignature
+{
+public:
+
+  /// @brief 空のコンストラクタ
+  ///
+  /// 不正値となる．
+  NpnSignature() = default;
+
+  /// @brief 関数を指定したコンストラクタ
+  explicit
+  NpnSignature(
+    const TvFunc& func ///< [in] 対象の関数
+  );
+
+  /// @brief デストラクタ
+  ~NpnSignature() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 適正な値を持っている時 true を返す．
+  bool
+  is_valid() const
+  {
+    return !mData.empty();
+  }
+
+  /// @brief 入力数を返す．
+  SizeType
+  input_num() const
+  {
+    return is_valid() ? mData[0] : 0;
+  }
+
+  /// @brief サポート変数の数を返す．
+  SizeType
+  support_num() const
+  {
+    return is_valid() ? mData[1] : 0;
+  }
+
+  /// @brief 0次の Walsh 係数の絶対値を返す．
+  int
+  walsh_0() const
+  {
+    return is_valid() ? mData[2] : 0;
+  }
+
+  /// @brief 準正規形が一意に決まる時 true を返す．
+  ///
+  /// 0次の係数とサポート変数の1次の係数が 0 でなく，
+  /// 変数ごとのキーが全て異なる場合に true となる．
+  bool
+  is_unique() const
+  {
+    return mUnique;
+  }
+
+  /// @brief 準正規形への変換マップを返す．
+  const NpnMap&
+  semi_cannonical_map() const
+  {
+    return mXmap;
+  }
+
+  /// @brief 準正規形を返す．
+  ///
+  /// func はこのシグネチャを作った関数でなければならない．
+  TvFunc
+  semi_cannonical(
+    const TvFunc& func ///< [in] 対象の関数
+  ) const
+  {
+    return func.xform(mXmap);
+  }
+
+  /// @brief ハッシュ値を返す．
+  SizeType
+  hash() const;
+
+  /// @brief 等価比較演算子
+  bool
+  operator==(
+    const NpnSignature& right ///< [in] オペランド
+  ) const
+  {
+    return mData == right.mData;
+  }
+
+  /// @brief 非等価比較演算子
+  bool
+  operator!=(
+    const NpnSignature& right ///< [in] オペランド
+  ) const
+  {
+    return !operator==(right);
+  }
+
+  /// @brief 小なり比較演算子
+  ///
+  /// 整列のための順序で，特別な意味はない．
+  bool
+  operator<(
+    const NpnSignature& right ///< [in] オペランド
+  ) const
+  {
+    return mData < right.mData;
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // シグネチャの本体
+  // 先頭から入力数，サポート変数の数，0次の係数，
+  // 変数ごとのキーの順に並べたもの
+  std::vector<int> mData;
+
+  // 準正規形への変換マップ
+  NpnMap mXmap;
+
+  // 準正規形が一意に決まる時 true にするフラグ
+  bool mUnique{false};
+
+};
+
+END_NAMESPACE_YM_LOGIC
+
+BEGIN_NAMESPACE_STD
+
+// NpnSignature をキーにしたハッシュ関数クラスの定義
+template <>
+struct hash<YM_NAMESPACE::nsLogic::NpnSignature>
+{
+  SizeType
+  operator()(
+    const YM_NAMESPACE::nsLogic::NpnSignature& sig
+  ) const
+  {
+    return sig.hash();
+  }
+};
+
+END_NAMESPACE_STD
+
+#endif // YM_NPNSIGNATURE_H
@@ -855,6 +855,25 @@ protected:
     return 0;
   }
 
+  /// @brief キューブの包含関係を調べる．
+  /// @return cube1 が cube2 を包含している時 true を返す．
+  ///
+  /// cube1 のリテラル集合が cube2 のリテラル集合に含まれていればよい．
+  bool
+  _cube_check_containment(
+    Cube cube1, ///< [in] 1つめのキューブを表すビットベクタ
+    Cube cube2  ///< [in] 2つめのキューブを表すビットベクタ
+  ) const
+  {
+    auto src1_end = _cube_end(cube1);
+    for ( ; cube1 != src1_end; ++ cube1, ++ cube2 ) {
+      if ( (*cube2 & ~*cube1) != SOP_ALL0 ) {
+	return false;
+      }
+    }
+    return true;
+  }
+
 
 protected:
   //////////////////////////////////////////////////////////////////////
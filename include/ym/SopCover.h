@@ -565,6 +565,80 @@ public:
     Literal lit ///< [in] オペランド
   );
 
+  /// @brief 否定を計算する．
+  /// @return 計算結果を返す．
+  ///
+  /// unate recursive paradigm に基づいて積和形のまま計算するので
+  /// 真理値表を経由しない．
+  /// 結果は既約とは限らない．
+  SopCover
+  complement() const;
+
+  /// @brief トートロジーの時 true を返す．
+  ///
+  /// unate recursive paradigm に基づいて判定する．
+  bool
+  is_tautology() const;
+
+  /// @brief キューブを覆っている時 true を返す．
+  ///
+  /// * cube の表す論理関数が自身に含意される時 true を返す．
+  /// * キューブによるコファクターが tautology かどうかで判定する．
+  bool
+  check_covering(
+    const SopCube& cube ///< [in] 対象のキューブ
+  ) const;
+
+  /// @brief オペランドのキューブに包含されている時 true を返す．
+  ///
+  /// * ここではキューブの表す論理関数の含意を考える．
+  /// * 全てのキューブがオペランドのキューブに含まれていればよい．
+  bool
+  check_containment(
+    const SopCube& right ///< [in] オペランドのキューブ
+  ) const;
+
+  /// @brief オペランドのカバーに包含されている時 true を返す．
+  ///
+  /// * ここではカバーの表す論理関数の含意を考える．
+  /// * 全てのキューブを right が覆っているかどうかで判定する．
+  bool
+  check_containment(
+    const SopCover& right ///< [in] オペランドのカバー
+  ) const;
+
+  /// @brief 単一キューブ包含(single cube containment)を取り除く．
+  /// @return 計算結果を返す．
+  ///
+  /// 他のキューブに包含されているキューブを取り除いたカバーを返す．
+  SopCover
+  scc() const;
+
+  /// @brief 単一キューブ包含(single cube containment)を取り除き自身に代入する．
+  /// @return 自身への参照を返す．
+  SopCover&
+  scc_int();
+
+  /// @brief 2段論理最小化を行う．
+  /// @return 計算結果を返す．
+  ///
+  /// Espresso と同様に EXPAND, IRREDUNDANT, REDUCE を
+  /// コストが減らなくなるまで繰り返す．
+  /// コストは (キューブ数, リテラル数) の辞書式順序で比較する．
+  /// 結果は最小とは限らない．
+  SopCover
+  minimize() const;
+
+  /// @brief ドントケアを用いて2段論理最小化を行う．
+  /// @return 計算結果を返す．
+  ///
+  /// 結果は自身から dc を除いた関数を含み，
+  /// 自身と dc の和に含まれる．
+  SopCover
+  minimize(
+    const SopCover& dc ///< [in] ドントケア
+  ) const;
+
   /// @brief 比較演算子 (EQ)
   /// @return 等しい時に true を返す．
   bool
@@ -21,6 +21,7 @@ BEGIN_NAMESPACE_YM
 /// @brief TvFunc を Bdd に変換するクラス
 ///
 /// 実際にはただの関数群
+/// 変換は BddMgr::from_tvfunc() で行う．
 //////////////////////////////////////////////////////////////////////
 class Tv2Bdd
 {
@@ -0,0 +1,506 @@
+#ifndef YM_TVBIGFUNC_H
+#define YM_TVBIGFUNC_H
+
+/// @file ym/TvBigFunc.h
+/// @brief TvBigFunc のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "ym/TvFunc.h"
+
+
+BEGIN_NAMESPACE_YM
+
+//////////////////////////////////////////////////////////////////////
+/// @class TvBigFunc TvBigFunc.h "ym/TvBigFunc.h"
+/// @ingroup LogicGroup
+/// @brief TvFunc::kMaxNi を超える入力数を扱うための真理値表
+///
+/// 真理値表を kTileNi 入力の TvFunc (タイル)に分割して保持する．
+/// - 下位 kTileNi 個の入力はタイル内の変数となる．
+/// - 上位の入力はタイル番号のビットとなる．
+///   つまり，t 番目のタイルは上位の入力に t の2進表現を割り当てた
+///   コファクターとなる．
+///
+/// 各演算はタイルごとに TvFunc の演算を適用して行うので，
+/// 一度に扱うデータはタイル1つ分の大きさで済む．
+/// 入力数が kTileNi 以下の場合はタイル1つからなる．
+//////////////////////////////////////////////////////////////////////
+class TvBigFunc
+{
+public:
+  using WordType = TvFunc::WordType;
+
+public:
+
+  /// @brief 不正値を作るコンストラクタ
+  TvBigFunc() = default;
+
+  /// @brief 入力数のみ指定したコンストラクタ
+  ///
+  /// - 中身は恒偽関数
+  /// - ni が kMaxNi を超える時は std::invalid_argument 例外が送出される．
+  explicit
+  TvBigFunc(
+    SizeType ni ///< [in] 入力数
+  );
+
+  /// @brief TvFunc からの変換コンストラクタ
+  explicit
+  TvBigFunc(
+    const TvFunc& func ///< [in] 元の関数
+  );
+
+  /// @brief コピーコンストラクタ
+  TvBigFunc(
+    const TvBigFunc& src ///< [in] コピー元のソースオブジェクト
+  ) = default;
+
+  /// @brief ムーブコンストラクタ
+  TvBigFunc(
+    TvBigFunc&& src ///< [in] ムーブ元のソースオブジェクト
+  ) = default;
+
+  /// @brief コピー代入演算子
+  TvBigFunc&
+  operator=(
+    const TvBigFunc& src ///< [in] コピー元のソースオブジェクト
+  ) = default;
+
+  /// @brief ムーブ代入演算子
+  TvBigFunc&
+  operator=(
+    TvBigFunc&& src ///< [in] ムーブ元のソースオブジェクト
+  ) = default;
+
+  /// @brief デストラクタ
+  ~TvBigFunc() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // オブジェクト生成用のクラスメソッド
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 不正な値を作る．
+  static
+  TvBigFunc
+  invalid()
+  {
+    return TvBigFunc{};
+  }
+
+  /// @brief 恒偽関数を作る．
+  static
+  TvBigFunc
+  zero(
+    SizeType ni ///< [in] 入力数
+  )
+  {
+    return TvBigFunc{ni};
+  }
+
+  /// @brief 恒真関数を作る．
+  static
+  TvBigFunc
+  one(
+    SizeType ni ///< [in] 入力数
+  )
+  {
+    return TvBigFunc{ni}.invert_int();
+  }
+
+  /// @brief リテラル関数を作る．
+  ///
+  /// varid が範囲外の時は std::out_of_range 例外が送出される．
+  static
+  TvBigFunc
+  literal(
+    SizeType ni,     ///< [in] 入力数
+    SizeType varid,  ///< [in] リテラルの変数番号 ( 0 <= varid < ni )
+    bool inv = false ///< [in] 反転属性
+                     ///<   - false: 反転なし (正極性)
+                     ///<   - true:  反転あり (負極性)
+  );
+
+  /// @brief リテラル関数を作る．
+  static
+  TvBigFunc
+  literal(
+    SizeType ni, ///< [in] 入力数
+    Literal lit  ///< [in] リテラル
+  )
+  {
+    return literal(ni, lit.varid(), lit.is_negative());
+  }
+
+  /// @brief タイルのリストから関数を作る．
+  ///
+  /// - tile_list のサイズは tile_num(ni) に等しくなければならない．
+  /// - 各タイルの入力数は tile_input_num(ni) に等しくなければならない．
+  /// - 違反時には std::invalid_argument 例外が送出される．
+  static
+  TvBigFunc
+  from_tiles(
+    SizeType ni,                   ///< [in] 入力数
+    std::vector<TvFunc>&& tile_list ///< [in] タイルのリスト
+  );
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 論理演算
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 否定した関数を返す．
+  TvBigFunc
+  invert() const
+  {
+    return TvBigFunc{*this}.invert_int();
+  }
+
+  /// @brief コファクターを返す．
+  ///
+  /// var が範囲外の時は std::out_of_range 例外が送出される．
+  TvBigFunc
+  cofactor(
+    SizeType var, ///< [in] 変数番号 ( 0 <= var < input_num() )
+    bool inv      ///< [in] 極性
+                  ///<  - false: 反転なし (正極性)
+                  ///<  - true:  反転あり (負極性)
+  ) const
+  {
+    return TvBigFunc{*this}.cofactor_int(var, inv);
+  }
+
+  /// @brief 自分自身を否定する．
+  /// @return 自身への参照を返す．
+  TvBigFunc&
+  invert_int();
+
+  /// @brief src1 との論理積を計算し自分に代入する．
+  /// @return 自身への参照を返す．
+  ///
+  /// src1 と入力数が異なるときは std::invalid_argument 例外が送出される．
+  TvBigFunc&
+  and_int(
+    const TvBigFunc& src1 ///< [in] オペランド
+  );
+
+  /// @brief src1 との論理和を計算し自分に代入する．
+  /// @return 自身への参照を返す．
+  ///
+  /// src1 と入力数が異なるときは std::invalid_argument 例外が送出される．
+  TvBigFunc&
+  or_int(
+    const TvBigFunc& src1 ///< [in] オペランド
+  );
+
+  /// @brief src1 との排他的論理和を計算し自分に代入する．
+  /// @return 自身への参照を返す．
+  ///
+  /// src1 と入力数が異なるときは std::invalid_argument 例外が送出される．
+  TvBigFunc&
+  xor_int(
+    const TvBigFunc& src1 ///< [in] オペランド
+  );
+
+  /// @brief コファクターを計算し自分に代入する．
+  /// @return 自身への参照を返す．
+  ///
+  /// var が範囲外の時は std::out_of_range 例外が送出される．
+  TvBigFunc&
+  cofactor_int(
+    SizeType var,    ///< [in] 変数番号
+    bool inv = false ///< [in] 反転属性
+                     ///<  - false: 反転なし (正極性)
+                     ///<  - true:  反転あり (負極性)
+  );
+
+  /// @brief invert() の別名
+  TvBigFunc
+  operator~() const
+  {
+    return invert();
+  }
+
+  /// @brief 論理積を求める．
+  TvBigFunc
+  operator&(
+    const TvBigFunc& right ///< [in] 第2オペランド
+  ) const
+  {
+    return TvBigFunc{*this}.and_int(right);
+  }
+
+  /// @brief 論理積を求め代入する．
+  TvBigFunc&
+  operator&=(
+    const TvBigFunc& right ///< [in] 第2オペランド
+  )
+  {
+    return and_int(right);
+  }
+
+  /// @brief 論理和を求める．
+  TvBigFunc
+  operator|(
+    const TvBigFunc& right ///< [in] 第2オペランド
+  ) const
+  {
+    return TvBigFunc{*this}.or_int(right);
+  }
+
+  /// @brief 論理和を求め代入する．
+  TvBigFunc&
+  operator|=(
+    const TvBigFunc& right ///< [in] 第2オペランド
+  )
+  {
+    return or_int(right);
+  }
+
+  /// @brief 排他的論理和を求める．
+  TvBigFunc
+  operator^(
+    const TvBigFunc& right ///< [in] 第2オペランド
+  ) const
+  {
+    return TvBigFunc{*this}.xor_int(right);
+  }
+
+  /// @brief 排他的論理和を求め代入する．
+  TvBigFunc&
+  operator^=(
+    const TvBigFunc& right ///< [in] 第2オペランド
+  )
+  {
+    return xor_int(right);
+  }
+
+  /// @brief 等価比較演算子
+  bool
+  operator==(
+    const TvBigFunc& right ///< [in] 第2オペランド
+  ) const
+  {
+    return mInputNum == right.mInputNum && mTileList == right.mTileList;
+  }
+
+  /// @brief 非等価比較演算子
+  bool
+  operator!=(
+    const TvBigFunc& right ///< [in] 第2オペランド
+  ) const
+  {
+    return !operator==(right);
+  }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 情報の取得
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 適正な値を持っている時に true を返す．
+  bool
+  is_valid() const
+  {
+    return !mTileList.empty();
+  }
+
+  /// @brief 不正値の時に true を返す．
+  bool
+  is_invalid() const
+  {
+    return !is_valid();
+  }
+
+  /// @brief 入力数を得る．
+  SizeType
+  input_num() const
+  {
+    return mInputNum;
+  }
+
+  /// @brief 入力値を2進数と見なしたときの pos 番目の値を得る．
+  ///
+  /// pos が範囲外の時は std::out_of_range 例外が送出される．
+  int
+  value(
+    std::uint64_t pos ///< [in] 位置番号 ( 0 <= pos < 2^(input_num()) )
+  ) const;
+
+  /// @brief 定数0関数の時に true を返す．
+  bool
+  is_zero() const;
+
+  /// @brief 定数1関数の時に true を返す．
+  bool
+  is_one() const;
+
+  /// @brief 0 の数を数える．
+  std::uint64_t
+  count_zero() const;
+
+  /// @brief 1 の数を数える．
+  std::uint64_t
+  count_one() const;
+
+  /// @brief 0次の Walsh 係数を求める．
+  ///
+  /// 入力数が 31 を超えると int に収まらないので 64 ビットで返す．
+  std::int64_t
+  walsh_0() const;
+
+  /// @brief 1次の Walsh 係数を求める．
+  ///
+  /// var が範囲外の時は std::out_of_range 例外が送出される．
+  std::int64_t
+  walsh_1(
+    SizeType var ///< [in] 変数 ( 0 <= var < input_num() )
+  ) const;
+
+  /// @brief var がサポートの時 true を返す．
+  ///
+  /// var が範囲外の時は std::out_of_range 例外が送出される．
+  bool
+  check_sup(
+    SizeType var ///< [in] 変数 ( 0 <= var < input_num() )
+  ) const;
+
+  /// @brief ハッシュ値を返す．
+  SizeType
+  hash() const;
+
+  /// @brief TvFunc に変換する．
+  ///
+  /// 入力数が TvFunc::kMaxNi を超える時は std::invalid_argument 例外が送出される．
+  TvFunc
+  to_tvfunc() const;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // タイルに関する関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief タイル数を返す．
+  SizeType
+  tile_num() const
+  {
+    return mTileList.size();
+  }
+
+  /// @brief タイルを返す．
+  const TvFunc&
+  tile(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < tile_num() )
+  ) const
+  {
+    return mTileList[pos];
+  }
+
+  /// @brief 入力数 ni の時のタイルの入力数を返す．
+  static
+  SizeType
+  tile_input_num(
+    SizeType ni ///< [in] 入力数
+  )
+  {
+    return std::min(ni, kTileNi);
+  }
+
+  /// @brief 入力数 ni の時のタイル数を返す．
+  static
+  SizeType
+  tile_num(
+    SizeType ni ///< [in] 入力数
+  )
+  {
+    return 1UL << (ni - tile_input_num(ni));
+  }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 定数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief タイルの入力数
+  ///
+  /// 1つのタイルの大きさが 8KB となり，キャッシュに収まる．
+  static
+  constexpr SizeType kTileNi = 16;
+
+  /// @brief 最大の入力数
+  ///
+  /// 真理値表全体で 512MB となる．
+  static
+  constexpr SizeType kMaxNi = 32;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で使われる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 同じサイズの関数かチェックする．
+  void
+  _check_size(
+    const TvBigFunc& src
+  ) const
+  {
+    if ( src.input_num() != input_num() ) {
+      throw std::invalid_argument{"input_num() mismatch"};
+    }
+  }
+
+  /// @brief var が適切かチェックする．
+  void
+  _check_varid(
+    SizeType var
+  ) const
+  {
+    if ( var >= mInputNum ) {
+      throw std::out_of_range{"var is out of range"};
+    }
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 入力数
+  SizeType mInputNum{0};
+
+  // タイルのリスト
+  std::vector<TvFunc> mTileList;
+
+};
+
+END_NAMESPACE_YM
+
+BEGIN_NAMESPACE_STD
+
+// TvBigFunc をキーにしたハッシュ関数クラスの定義
+template <>
+struct hash<YM_NAMESPACE::TvBigFunc>
+{
+  SizeType
+  operator()(
+    const YM_NAMESPACE::TvBigFunc& func
+  ) const
+  {
+    return func.hash();
+  }
+};
+
+END_NAMESPACE_STD
+
+#endif // YM_TVBIGFUNC_H
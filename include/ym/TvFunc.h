@@ -10,6 +10,7 @@
 
 #include "ym/logic.h"
 #include "ym/Literal.h"
+#include "ym/TvWordVec.h"
 #include "ym/BinEnc.h"
 #include "ym/BinDec.h"
 
@@ -27,6 +28,8 @@ BEGIN_NAMESPACE_YM
 ///
 /// 中身はビットパックされた本当の真理値表なので入力数の指数乗に比例した
 /// メモリ容量を必要とする．
+/// ただし，入力数が 7 以下の場合には真理値表をオブジェクト内に直接
+/// 格納するので，生成やコピーの際にヒープ領域の確保は行われない．
 /// そのため通常の論理演算よりも代入付き論理演算のほうが効率がよい．
 /// さらに，オペランドのどちらかが右辺値の場合には自動的にそのオブジェクト
 /// からムーブ演算子で中身を移してそのオブジェクト乗で代入付き論理演算を
@@ -225,6 +228,19 @@ public:
     return TvFunc{ni, lit_list};
   }
 
+  /// @brief パックされた真理値ベクトルから関数を作る．
+  /// @return 生成したオブジェクトを返す．
+  ///
+  /// - raw_data() の逆の変換となる．
+  /// - data のサイズは nblk() と等しくなければならない．
+  /// - 違反時には std::invalid_argument 例外が送出される．
+  static
+  TvFunc
+  from_raw_data(
+    SizeType ni,                  ///< [in] 入力数
+    std::vector<WordType>&& data  ///< [in] パックされた真理値ベクトル
+  );
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -773,6 +789,11 @@ public:
   /// - Walsh の0次の係数が非負である．
   /// - Walsh の1次の係数が非負である．
   /// - 他のNPN同値の関数と比較して(ある基準で)最大となる．
+  ///
+  /// 入力数が4以下の場合は表引きで求める．
+  /// 変換後の関数はどちらの方法でも同じになるが，対称な変数を持つ関数では
+  /// 返される変換が npn_cannonical_all_map() の先頭の要素と
+  /// 異なる場合がある．
   NpnMap
   npn_cannonical_map() const;
 
@@ -868,6 +889,23 @@ private:
     const TvFunc& right ///< [in] 第2オペランド
   ) const;
 
+  /// @brief 変数の極性を反転させる．
+  ///
+  /// xform() の下請け関数
+  void
+  _flip_var(
+    SizeType var ///< [in] 変数番号
+  );
+
+  /// @brief 2つの変数を入れ替える．
+  ///
+  /// xform() の下請け関数
+  void
+  _swap_var(
+    SizeType var1, ///< [in] 変数番号1
+    SizeType var2  ///< [in] 変数番号2
+  );
+
   /// @brief コファクターマスクを得る．
   static
   WordType
@@ -954,7 +992,8 @@ private:
   SizeType mBlockNum;
 
   // パックされた真理値ベクトル
-  std::vector<WordType> mVector;
+  // 入力数が 7 以下の場合にはヒープ領域を用いない．
+  TvWordVec mVector;
 
 };
 
@@ -9,6 +9,7 @@
 /// All rights reserved.
 
 #include "ym/TvFunc.h"
+#include "ym/TvFuncMView.h"
 
 
 BEGIN_NAMESPACE_YM
@@ -54,6 +55,12 @@ public:
     TvFunc&& src
   );
 
+  /// @brief TvFuncMView の内容をコピーするコンストラクタ
+  explicit
+  TvFuncM(
+    const TvFuncMView& src
+  );
+
   /// @brief TvFunc のリストを用いたコンストラクタ
   /// @param[in] src_list 各出力の論理関数
   ///
@@ -270,6 +277,29 @@ public:
     SizeType ovar ///< [in] 出力番号
   ) const;
 
+  /// @brief 全ての出力を参照するビューを返す．
+  ///
+  /// 真理値ベクトルのコピーは行わない．
+  TvFuncMView
+  view() const
+  {
+    return TvFuncMView{mInputNum, mOutputNum, mVector.data()};
+  }
+
+  /// @brief 一部の出力を参照するビューを返す．
+  ///
+  /// - 真理値ベクトルのコピーは行わない．
+  /// - first + num が output_num() を超える時は
+  ///   std::out_of_range 例外が送出される．
+  TvFuncMView
+  view(
+    SizeType first, ///< [in] 先頭の出力番号
+    SizeType num    ///< [in] 出力数
+  ) const
+  {
+    return view().view(first, num);
+  }
+
   /// @brief 入力値を2進数と見なしたときの pos 番目の値を得る．
   /// 答は 0 か 1 だが int 型
   int
@@ -291,6 +321,10 @@ public:
   /// @brief pos1 番目と pos2 番目の変数が対称のとき true を返す．
   /// @param[in] pos1, pos2 変数番号
   /// @param[in] inv
+  ///
+  /// - var1 と var2 は異なる変数でなければならない．
+  ///   同じ場合には std::invalid_argument 例外を送出する．
+  /// - var1 か var2 が入力数以上の場合には std::out_of_range 例外を送出する．
   bool
   check_sym(
     SizeType var1,   ///< [in] 変数1
@@ -300,6 +334,35 @@ public:
                      ///<  - true:  反転あり (負極性)
   ) const;
 
+  /// @brief 出力ごとに varid 番目の変数がサポートか調べる．
+  /// @return 出力番号をインデックスとする結果のベクタを返す．
+  ///
+  /// 真理値ベクトルを1回走査するだけで全ての出力の結果を求める．
+  std::vector<bool>
+  sup_outputs(
+    SizeType varid ///< [in] 変数番号
+  ) const
+  {
+    return view().sup_outputs(varid);
+  }
+
+  /// @brief 出力ごとに var1 と var2 が対称か調べる．
+  /// @return 出力番号をインデックスとする結果のベクタを返す．
+  ///
+  /// 真理値ベクトルを1回走査するだけで全ての出力の結果を求める．
+  /// 引数に関する条件と例外は check_sym() と同じ．
+  std::vector<bool>
+  sym_outputs(
+    SizeType var1,   ///< [in] 変数1
+    SizeType var2,   ///< [in] 変数2
+    bool inv = false ///< [in] 極性
+                     ///<  - false: 反転なし (正極性)
+                     ///<  - true:  反転あり (負極性)
+  ) const
+  {
+    return view().sym_outputs(var1, var2, inv);
+  }
+
   /// @brief ハッシュ値を返す．
   SizeType
   hash() const;
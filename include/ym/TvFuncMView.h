@@ -0,0 +1,228 @@
+#ifndef YM_TVFUNCMVIEW_H
+#define YM_TVFUNCMVIEW_H
+
+/// @file ym/TvFuncMView.h
+/// @brief TvFuncMView のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/TvFunc.h"
+
+
+BEGIN_NAMESPACE_YM
+
+//////////////////////////////////////////////////////////////////////
+/// @class TvFuncMView TvFuncMView.h "ym/TvFuncMView.h"
+/// @brief TvFuncM の連続した出力を参照するクラス
+///
+/// 真理値ベクトルをコピーせずに元の TvFuncM の領域を直接参照する．
+/// そのため，元の TvFuncM が変更・破棄されると無効になる．
+///
+/// sup_outputs() や sym_outputs() は全ての出力の結果を
+/// 真理値ベクトルの1回の走査で求める．
+/// 出力ごとに slice() して調べるよりも効率がよい．
+//////////////////////////////////////////////////////////////////////
+class TvFuncMView
+{
+public:
+  using WordType = TvFunc::WordType;
+
+public:
+
+  /// @brief コンストラクタ
+  ///
+  /// 通常は TvFuncM::view() を用いる．
+  TvFuncMView(
+    SizeType ni,          ///< [in] 入力数
+    SizeType no,          ///< [in] 出力数
+    const WordType* body  ///< [in] 先頭の出力の真理値ベクトル
+  ) : mInputNum{ni},
+      mOutputNum{no},
+      mBlockNum1{nblock(ni)},
+      mBody{body}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~TvFuncMView() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 情報の取得
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 入力数を得る．
+  SizeType
+  input_num() const
+  {
+    return mInputNum;
+  }
+
+  /// @brief 出力数を得る．
+  SizeType
+  output_num() const
+  {
+    return mOutputNum;
+  }
+
+  /// @brief 一部の出力を参照するビューを返す．
+  ///
+  /// first + num が output_num() を超える時は
+  /// std::out_of_range 例外が送出される．
+  TvFuncMView
+  view(
+    SizeType first, ///< [in] 先頭の出力番号
+    SizeType num    ///< [in] 出力数
+  ) const
+  {
+    if ( first + num > mOutputNum ) {
+      throw std::out_of_range{"first + num is out of range"};
+    }
+    return TvFuncMView{mInputNum, num, mBody + first * mBlockNum1};
+  }
+
+  /// @brief 入力値を2進数と見なしたときの pos 番目の値を得る．
+  int
+  value(
+    SizeType ovar, ///< [in] 出力番号
+    SizeType pos   ///< [in] 位置番号 ( 0 <= pos < 2^(input_num()) )
+  ) const
+  {
+    return (mBody[ovar * mBlockNum1 + pos / 64] >> (pos % 64)) & 1;
+  }
+
+  /// @brief 1出力分のブロック数を得る．
+  SizeType
+  nblk1() const
+  {
+    return mBlockNum1;
+  }
+
+  /// @brief 生のデータを得る．
+  WordType
+  raw_data(
+    SizeType ovar, ///< [in] 出力番号
+    SizeType blk   ///< [in] ブロック番号 ( 0 <= blk < nblk1() )
+  ) const
+  {
+    return mBody[ovar * mBlockNum1 + blk];
+  }
+
+  /// @brief 1出力の論理関数をコピーして返す．
+  TvFunc
+  slice(
+    SizeType ovar ///< [in] 出力番号
+  ) const;
+
+  /// @brief いずれかの出力が var に依存する時 true を返す．
+  bool
+  check_sup(
+    SizeType var ///< [in] 変数番号
+  ) const;
+
+  /// @brief 出力ごとに var に依存するか調べる．
+  /// @return 出力番号をインデックスとする結果のベクタを返す．
+  std::vector<bool>
+  sup_outputs(
+    SizeType var ///< [in] 変数番号
+  ) const;
+
+  /// @brief 全ての出力で var1 と var2 が対称の時 true を返す．
+  ///
+  /// - var1 == var2 の場合には std::invalid_argument 例外を送出する．
+  /// - var1 か var2 が入力数以上の場合には std::out_of_range 例外を送出する．
+  bool
+  check_sym(
+    SizeType var1,   ///< [in] 変数1
+    SizeType var2,   ///< [in] 変数2
+    bool inv = false ///< [in] 極性
+                     ///<  - false: 反転なし (正極性)
+                     ///<  - true:  反転あり (負極性)
+  ) const;
+
+  /// @brief 出力ごとに var1 と var2 が対称か調べる．
+  /// @return 出力番号をインデックスとする結果のベクタを返す．
+  std::vector<bool>
+  sym_outputs(
+    SizeType var1,   ///< [in] 変数1
+    SizeType var2,   ///< [in] 変数2
+    bool inv = false ///< [in] 極性
+                     ///<  - false: 反転なし (正極性)
+                     ///<  - true:  反転あり (負極性)
+  ) const;
+
+  /// @brief コファクターを返す．
+  ///
+  /// 結果は新たな TvFuncM となる．
+  TvFuncM
+  cofactor(
+    SizeType var, ///< [in] 変数番号
+    bool inv      ///< [in] 極性
+                  ///<  - false: 反転なし (正極性)
+                  ///<  - true:  反転あり (負極性)
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で使われる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 入力数 ni のベクタを納めるのに必要なブロック数を計算する．
+  static
+  SizeType
+  nblock(
+    SizeType ni
+  )
+  {
+    return ((1 << ni) + 63) / 64;
+  }
+
+  /// @brief sup_outputs() の下請け関数
+  /// @return いずれかの出力が var に依存する時 true を返す．
+  ///
+  /// ans が nullptr の時は依存する出力が見つかった時点で終わる．
+  bool
+  _sup_kernel(
+    SizeType var,
+    std::vector<bool>* ans
+  ) const;
+
+  /// @brief sym_outputs() の下請け関数
+  /// @return 全ての出力で対称の時 true を返す．
+  ///
+  /// ans が nullptr の時は対称でない出力が見つかった時点で終わる．
+  bool
+  _sym_kernel(
+    SizeType var1,
+    SizeType var2,
+    bool inv,
+    std::vector<bool>* ans
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 入力数
+  SizeType mInputNum;
+
+  // 出力数
+  SizeType mOutputNum;
+
+  // 1出力分のブロック数
+  SizeType mBlockNum1;
+
+  // 先頭の出力の真理値ベクトル
+  const WordType* mBody;
+
+};
+
+END_NAMESPACE_YM
+
+#endif // YM_TVFUNCMVIEW_H
@@ -0,0 +1,291 @@
+#ifndef YM_TVWORDVEC_H
+#define YM_TVWORDVEC_H
+
+/// @file ym/TvWordVec.h
+/// @brief TvWordVec のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+
+
+BEGIN_NAMESPACE_YM
+
+//////////////////////////////////////////////////////////////////////
+/// @class TvWordVec TvWordVec.h "ym/TvWordVec.h"
+/// @brief TvFunc の真理値ベクトルを保持するワードの配列
+///
+/// ワード数が INLINE_NUM 以下の場合にはオブジェクト内に直接格納し，
+/// ヒープ領域を確保しない．
+/// 入力数が 7 以下の関数がこれに該当する．
+/// それより大きい場合には std::vector と同様にヒープ領域を用いる．
+///
+/// 必要最小限の機能しか持たない．
+/// 要素の型は 64ビットのワードに限られ，
+/// サイズを変更すると内容は 0 で初期化される．
+//////////////////////////////////////////////////////////////////////
+class TvWordVec
+{
+public:
+
+  using WordType = std::uint64_t;
+
+  /// @brief オブジェクト内に格納できる最大のワード数
+  static
+  const SizeType INLINE_NUM = 2;
+
+
+public:
+
+  /// @brief コンストラクタ
+  explicit
+  TvWordVec(
+    SizeType n = 0,    ///< [in] ワード数
+    WordType val = 0ULL ///< [in] 初期値
+  ) : mSize{n}
+  {
+    _alloc();
+    std::fill(data(), data() + mSize, val);
+  }
+
+  /// @brief std::vector からの変換コンストラクタ
+  explicit
+  TvWordVec(
+    const std::vector<WordType>& src ///< [in] コピー元のワード列
+  ) : mSize{src.size()}
+  {
+    _alloc();
+    std::copy(src.begin(), src.end(), data());
+  }
+
+  /// @brief コピーコンストラクタ
+  TvWordVec(
+    const TvWordVec& src
+  ) : mSize{src.mSize}
+  {
+    _alloc();
+    std::copy(src.begin(), src.end(), data());
+  }
+
+  /// @brief ムーブコンストラクタ
+  TvWordVec(
+    TvWordVec&& src
+  ) : mSize{src.mSize}
+  {
+    if ( is_inline() ) {
+      mInline[0] = src.mInline[0];
+      mInline[1] = src.mInline[1];
+    }
+    else {
+      mBody = src.mBody;
+    }
+    src.mSize = 0;
+  }
+
+  /// @brief コピー代入演算子
+  TvWordVec&
+  operator=(
+    const TvWordVec& src
+  )
+  {
+    if ( &src != this ) {
+      if ( src.mSize != mSize ) {
+	_free();
+	mSize = src.mSize;
+	_alloc();
+      }
+      std::copy(src.begin(), src.end(), data());
+    }
+    return *this;
+  }
+
+  /// @brief ムーブ代入演算子
+  TvWordVec&
+  operator=(
+    TvWordVec&& src
+  )
+  {
+    if ( &src != this ) {
+      _free();
+      mSize = src.mSize;
+      if ( is_inline() ) {
+	mInline[0] = src.mInline[0];
+	mInline[1] = src.mInline[1];
+      }
+      else {
+	mBody = src.mBody;
+      }
+      src.mSize = 0;
+    }
+    return *this;
+  }
+
+  /// @brief デストラクタ
+  ~TvWordVec()
+  {
+    _free();
+  }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ワード数を返す．
+  SizeType
+  size() const
+  {
+    return mSize;
+  }
+
+  /// @brief オブジェクト内に格納されている時 true を返す．
+  bool
+  is_inline() const
+  {
+    return mSize <= INLINE_NUM;
+  }
+
+  /// @brief 先頭のアドレスを返す．
+  WordType*
+  data()
+  {
+    return is_inline() ? mInline : mBody;
+  }
+
+  /// @brief 先頭のアドレスを返す．
+  const WordType*
+  data() const
+  {
+    return is_inline() ? mInline : mBody;
+  }
+
+  /// @brief 要素を返す．
+  WordType&
+  operator[](
+    SizeType pos ///< [in] 位置 ( 0 <= pos < size() )
+  )
+  {
+    return data()[pos];
+  }
+
+  /// @brief 要素を返す．
+  WordType
+  operator[](
+    SizeType pos ///< [in] 位置 ( 0 <= pos < size() )
+  ) const
+  {
+    return data()[pos];
+  }
+
+  /// @brief 先頭の反復子を返す．
+  WordType*
+  begin()
+  {
+    return data();
+  }
+
+  /// @brief 末尾の反復子を返す．
+  WordType*
+  end()
+  {
+    return data() + mSize;
+  }
+
+  /// @brief 先頭の反復子を返す．
+  const WordType*
+  begin() const
+  {
+    return data();
+  }
+
+  /// @brief 末尾の反復子を返す．
+  const WordType*
+  end() const
+  {
+    return data() + mSize;
+  }
+
+  /// @brief サイズを変更する．
+  ///
+  /// 内容は 0 で初期化される．
+  void
+  resize(
+    SizeType n ///< [in] ワード数
+  )
+  {
+    if ( n != mSize ) {
+      _free();
+      mSize = n;
+      _alloc();
+    }
+    std::fill(data(), data() + mSize, 0ULL);
+  }
+
+  /// @brief 空にする．
+  void
+  clear()
+  {
+    _free();
+    mSize = 0;
+  }
+
+  /// @brief 内容を交換する．
+  void
+  swap(
+    TvWordVec& src
+  )
+  {
+    std::swap(mSize, src.mSize);
+    std::swap(mInline[0], src.mInline[0]);
+    std::swap(mInline[1], src.mInline[1]);
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief mSize に応じて領域を確保する．
+  void
+  _alloc()
+  {
+    if ( !is_inline() ) {
+      mBody = new WordType[mSize];
+    }
+  }
+
+  /// @brief 領域を開放する．
+  void
+  _free()
+  {
+    if ( !is_inline() ) {
+      delete [] mBody;
+    }
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // ワード数
+  SizeType mSize;
+
+  union {
+    // オブジェクト内の領域
+    WordType mInline[INLINE_NUM];
+
+    // ヒープ上の領域
+    WordType* mBody;
+  };
+
+};
+
+END_NAMESPACE_YM
+
+#endif // YM_TVWORDVEC_H
@@ -26,6 +26,7 @@ class Zdd :
   public ZddMgrHolder
 {
   friend class ZddMgrHolder;
+  friend class ZddSampler;
 
 public:
 
@@ -364,9 +365,28 @@ public:
   size() const;
 
   /// @brief 集合の要素数を数える．
+  ///
+  /// SizeType で表せない場合には std::overflow_error 例外を送出する．
   SizeType
   count() const;
 
+  /// @brief 集合の要素数を double で数える．
+  ///
+  /// 丸め誤差が生じる可能性がある．
+  double
+  count_double() const;
+
+  /// @brief 集合の要素数の2を底とする対数を求める．
+  ///
+  /// 空集合の場合は -inf を返す．
+  double
+  log2_count() const;
+
+  /// @brief 集合の要素数を厳密に数える．
+  /// @return 10進表記の文字列を返す．
+  std::string
+  count_str() const;
+
   /// @brief 同じ構造を持つか調べる．
   ///
   /// 同じマネージャに属するZDDなら同じノードだが
@@ -122,6 +122,9 @@ public:
   //////////////////////////////////////////////////////////////////////
 
   /// @brief ガーベージコレクションを行う．
+  ///
+  /// しきい値に関係なく参照されていないノードを全て削除する．
+  /// 通常は演算の開始時に必要に応じて自動的に行われる．
   void
   garbage_collection();
 
@@ -129,11 +132,13 @@ public:
   SizeType
   node_num() const;
 
-  /// @brief GC を起動するしきい値を返す．
+  /// @brief GC を起動するしきい値の下限を返す．
+  ///
+  /// 実際のしきい値は生きているノード数に応じて大きくなる．
   SizeType
   gc_limit() const;
 
-  /// @brief GC を起動するしきい値を設定する．
+  /// @brief GC を起動するしきい値の下限を設定する．
   void
   set_gc_limit(
     SizeType limit
@@ -149,6 +154,19 @@ public:
   void
   disable_gc();
 
+  /// @brief 演算に用いるスレッド数を返す．
+  SizeType
+  thread_num() const;
+
+  /// @brief 演算に用いるスレッド数を設定する．
+  ///
+  /// - 0 の場合にはハードウェアのスレッド数を用いる．
+  /// - 1 の場合(デフォルト)には並列実行を行わない．
+  void
+  set_thread_num(
+    SizeType num ///< [in] スレッド数
+  );
+
   /// @brief 等価比較演算子
   bool
   operator==(
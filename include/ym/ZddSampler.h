@@ -0,0 +1,141 @@
+#ifndef ZDDSAMPLER_H
+#define ZDDSAMPLER_H
+
+/// @file ZddSampler.h
+/// @brief ZddSampler のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/logic.h"
+#include "ym/ZddItem.h"
+#include <random>
+
+
+BEGIN_NAMESPACE_YM_DD
+
+//////////////////////////////////////////////////////////////////////
+/// @class ZddSampler ZddSampler.h "ym/ZddSampler.h"
+/// @brief ZDD の表す集合族から要素(集合)を一様にサンプリングするクラス
+///
+/// コンストラクタで各ノードの要素数を一度だけ数えておき，
+/// サンプリングでは根から葉への1本の経路をたどる．
+/// そのため1回あたりの計算量は ZDD の深さに比例する．
+///
+/// 構築後は元の ZDD やマネージャとは独立に用いることができる．
+//////////////////////////////////////////////////////////////////////
+class ZddSampler
+{
+public:
+
+  /// @brief コンストラクタ
+  ///
+  /// - zdd が空集合の場合には std::invalid_argument 例外を送出する．
+  /// - zdd のサポートが item_list に含まれていない場合には
+  ///   std::invalid_argument 例外を送出する．
+  ZddSampler(
+    const Zdd& zdd,                       ///< [in] 対象の ZDD
+    const std::vector<ZddItem>& item_list ///< [in] 要素のリスト
+  );
+
+  /// @brief デストラクタ
+  ~ZddSampler() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 要素の数を返す．
+  SizeType
+  item_num() const
+  {
+    return mItemList.size();
+  }
+
+  /// @brief 1つの集合を表すのに必要なワード数を返す．
+  SizeType
+  row_size() const
+  {
+    return (item_num() + 63) / 64;
+  }
+
+  /// @brief 集合を一つ求める．
+  /// @return 集合に含まれる要素のリストを item_list の順に返す．
+  std::vector<ZddItem>
+  sample(
+    std::mt19937& randgen ///< [in] 乱数生成器
+  ) const;
+
+  /// @brief 集合をまとめて求める．
+  /// @return 集合をビット行列の形で返す．
+  ///
+  /// i 番目の集合は [i * row_size(), (i + 1) * row_size()) の
+  /// ワードに格納される．item_list の j 番目の要素を含む時に
+  /// その (j / 64) 番目のワードの (j % 64) ビット目が 1 となる．
+  std::vector<std::uint64_t>
+  sample_batch(
+    SizeType num,         ///< [in] 集合の数
+    std::mt19937& randgen ///< [in] 乱数生成器
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ノードの情報
+  ///
+  /// 枝は 0: 空集合，1: 空集合のみを含む集合族，
+  /// それ以外は (ノード番号 + 1) * 2 で表す．
+  struct Node
+  {
+    SizeType mPos;    ///< 要素の位置
+    SizeType mEdge0;  ///< 0枝
+    SizeType mEdge1;  ///< 1枝
+    double mLogCount; ///< 要素数の対数
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 1つの集合を row に書き込む．
+  void
+  sample_row(
+    std::mt19937& randgen, ///< [in] 乱数生成器
+    std::uint64_t* row     ///< [out] 結果を書き込む領域
+  ) const;
+
+  /// @brief 枝の要素数の対数を返す．
+  double
+  log_count(
+    SizeType edge ///< [in] 枝
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 要素のリスト
+  std::vector<ZddItem> mItemList;
+
+  // ノードのリスト
+  // 子供のノードは親のノードより前にある．
+  std::vector<Node> mNodeList;
+
+  // 根の枝
+  SizeType mRoot;
+
+};
+
+END_NAMESPACE_YM_DD
+
+#endif // ZDDSAMPLER_H
@@ -118,10 +118,13 @@ class BddVar;
 class BddVarSet;
 class BddLit;
 class BddMgr;
+class BddSampler;
+class BddImage;
 
 class Zdd;
 class ZddItem;
 class ZddMgr;
+class ZddSampler;
 
 END_NAMESPACE_YM_DD
 
@@ -172,10 +175,13 @@ using nsDd::BddVar;
 using nsDd::BddVarSet;
 using nsDd::BddLit;
 using nsDd::BddMgr;
+using nsDd::BddSampler;
+using nsDd::BddImage;
 
 using nsDd::Zdd;
 using nsDd::ZddItem;
 using nsDd::ZddMgr;
+using nsDd::ZddSampler;
 
 /// @brief 不正な変数番号
 const SizeType BAD_VARID = static_cast<SizeType>(-1);
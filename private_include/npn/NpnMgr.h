@@ -10,6 +10,7 @@
 
 
 #include "ym/NpnMap.h"
+#include <chrono>
 
 
 BEGIN_NAMESPACE_YM_LOGIC
@@ -57,6 +58,47 @@ public:
   std::uint64_t
   tvmax_count() const;
 
+  /// @brief 処理段階ごとの時間計測を行うか設定する．
+  ///
+  /// デフォルトでは計測しない．
+  void
+  set_profile(
+    bool flag ///< [in] 計測する時 true にするフラグ
+  )
+  {
+    mProfile = flag;
+  }
+
+  /// @brief walsh_01_normalize の段階の時間を返す．
+  ///
+  /// 直前の cannonical の呼び出しにおける値をナノ秒単位で返す．
+  /// set_profile(true) の場合のみ意味を持つ．
+  std::uint64_t
+  normalize_time() const
+  {
+    return mNormalizeTime;
+  }
+
+  /// @brief 極性の候補を絞り込む段階の時間を返す．
+  ///
+  /// 直前の cannonical の呼び出しにおける値をナノ秒単位で返す．
+  /// set_profile(true) の場合のみ意味を持つ．
+  std::uint64_t
+  refine_time() const
+  {
+    return mRefineTime;
+  }
+
+  /// @brief tvmax_recur の段階の時間を返す．
+  ///
+  /// 直前の cannonical の呼び出しにおける値をナノ秒単位で返す．
+  /// set_profile(true) の場合のみ意味を持つ．
+  std::uint64_t
+  tvmax_time() const
+  {
+    return mTvmaxTime;
+  }
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -75,6 +117,14 @@ private:
     const NpnMap& map
   );
 
+  /// @brief 時間計測の区切りをつける．
+  ///
+  /// 前回の区切りからの時間を time に足す．
+  void
+  lap(
+    std::uint64_t& time
+  );
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -94,6 +144,17 @@ private:
   // 1回の cannonical あたりの tvmax_recur の起動回数
   std::uint64_t mTvmax_count;
 
+  // 時間計測を行う時 true にするフラグ
+  bool mProfile{false};
+
+  // 前回の区切りの時刻
+  std::chrono::steady_clock::time_point mLapTime;
+
+  // 段階ごとの時間(ナノ秒)
+  std::uint64_t mNormalizeTime{0};
+  std::uint64_t mRefineTime{0};
+  std::uint64_t mTvmaxTime{0};
+
 };
 
 END_NAMESPACE_YM_LOGIC
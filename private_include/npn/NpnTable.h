@@ -0,0 +1,77 @@
+#ifndef NPNTABLE_H
+#define NPNTABLE_H
+
+/// @file NpnTable.h
+/// @brief NpnTable のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/NpnMap.h"
+
+
+BEGIN_NAMESPACE_YM_LOGIC
+
+//////////////////////////////////////////////////////////////////////
+/// @class NpnTable NpnTable.h "NpnTable.h"
+/// @brief 入力数の小さい関数のNPN正規形を表引きで求めるためのクラス
+///
+/// 入力数が MAX_NI 以下の全ての関数について正規形と正規化マップを
+/// 記録した表を持つ．
+/// 表は最初に使われた時に作られる．
+/// 同値類ごとに1つの代表関数の正規形を NpnMgr で求め，
+/// 全てのNPN変換を施して同値類の残りの関数の結果を埋めるので，
+/// NpnMgr を呼び出すのは同値類の数(4入力で222)だけとなる．
+///
+/// 正規形は NpnMgr の結果と一致するが，
+/// 対称性のある関数では正規化マップは NpnMgr の最初の結果と
+/// 異なる場合がある．
+//////////////////////////////////////////////////////////////////////
+class NpnTable
+{
+public:
+
+  /// @brief 表を持つ最大の入力数
+  static
+  const SizeType MAX_NI = 4;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 表引きが使える時 true を返す．
+  static
+  bool
+  is_supported(
+    const TvFunc& func ///< [in] 対象の関数
+  )
+  {
+    return func.is_valid() && func.input_num() <= MAX_NI;
+  }
+
+  /// @brief 正規形を返す．
+  ///
+  /// is_supported(func) が true でなければならない．
+  static
+  TvFunc
+  cannonical(
+    const TvFunc& func ///< [in] 対象の関数
+  );
+
+  /// @brief 正規化マップを返す．
+  ///
+  /// is_supported(func) が true でなければならない．
+  static
+  NpnMap
+  cannonical_map(
+    const TvFunc& func ///< [in] 対象の関数
+  );
+
+};
+
+END_NAMESPACE_YM_LOGIC
+
+#endif // NPNTABLE_H
@@ -1,16 +0,0 @@
-    0,  1,  1,  0,  1,  2,  2,  1,  1,  2,  2,  1,  0,  1,  1,  0,
-    1,  2,  2,  1,  2,  3,  3,  2,  2,  3,  3,  2,  1,  2,  2,  1,
-    1,  2,  2,  1,  2,  3,  3,  2,  2,  3,  3,  2,  1,  2,  2,  1,
-    0,  1,  1,  0,  1,  2,  2,  1,  1,  2,  2,  1,  0,  1,  1,  0,
-    1,  2,  2,  1,  2,  3,  3,  2,  2,  3,  3,  2,  1,  2,  2,  1,
-    2,  3,  3,  2,  3,  4,  4,  3,  3,  4,  4,  3,  2,  3,  3,  2,
-    2,  3,  3,  2,  3,  4,  4,  3,  3,  4,  4,  3,  2,  3,  3,  2,
-    1,  2,  2,  1,  2,  3,  3,  2,  2,  3,  3,  2,  1,  2,  2,  1,
-    1,  2,  2,  1,  2,  3,  3,  2,  2,  3,  3,  2,  1,  2,  2,  1,
-    2,  3,  3,  2,  3,  4,  4,  3,  3,  4,  4,  3,  2,  3,  3,  2,
-    2,  3,  3,  2,  3,  4,  4,  3,  3,  4,  4,  3,  2,  3,  3,  2,
-    1,  2,  2,  1,  2,  3,  3,  2,  2,  3,  3,  2,  1,  2,  2,  1,
-    0,  1,  1,  0,  1,  2,  2,  1,  1,  2,  2,  1,  0,  1,  1,  0,
-    1,  2,  2,  1,  2,  3,  3,  2,  2,  3,  3,  2,  1,  2,  2,  1,
-    1,  2,  2,  1,  2,  3,  3,  2,  2,  3,  3,  2,  1,  2,  2,  1,
-    0,  1,  1,  0,  1,  2,  2,  1,  1,  2,  2,  1,  0,  1,  1,  0,
@@ -512,6 +512,127 @@ remap_vars(
   }
 }
 
+// existential quantification
+PyObject*
+exist(
+  PyObject* self,
+  PyObject* args,
+  PyObject* kwds
+)
+{
+  static const char* kwlist[] = {
+    "var_set",
+    nullptr
+  };
+  PyObject* var_set_obj = nullptr;
+  if ( !PyArg_ParseTupleAndKeywords(args, kwds, "O",
+                                    const_cast<char**>(kwlist),
+                                    &var_set_obj) ) {
+    return nullptr;
+  }
+  BddVarSet var_set;
+  if ( var_set_obj != nullptr ) {
+    if ( !PyBddVarSet::FromPyObject(var_set_obj, var_set) ) {
+      PyErr_SetString(PyExc_ValueError, "could not convert to BddVarSet");
+      return nullptr;
+    }
+  }
+  auto& val = PyBdd::_get_ref(self);
+  try {
+    return PyBdd::ToPyObject(val.exist(var_set));
+  }
+  catch ( std::invalid_argument err ) {
+    std::ostringstream buf;
+    buf << "invalid argument" << ": " << err.what();
+    PyErr_SetString(PyExc_ValueError, buf.str().c_str());
+    return nullptr;
+  }
+}
+
+// universal quantification
+PyObject*
+forall(
+  PyObject* self,
+  PyObject* args,
+  PyObject* kwds
+)
+{
+  static const char* kwlist[] = {
+    "var_set",
+    nullptr
+  };
+  PyObject* var_set_obj = nullptr;
+  if ( !PyArg_ParseTupleAndKeywords(args, kwds, "O",
+                                    const_cast<char**>(kwlist),
+                                    &var_set_obj) ) {
+    return nullptr;
+  }
+  BddVarSet var_set;
+  if ( var_set_obj != nullptr ) {
+    if ( !PyBddVarSet::FromPyObject(var_set_obj, var_set) ) {
+      PyErr_SetString(PyExc_ValueError, "could not convert to BddVarSet");
+      return nullptr;
+    }
+  }
+  auto& val = PyBdd::_get_ref(self);
+  try {
+    return PyBdd::ToPyObject(val.forall(var_set));
+  }
+  catch ( std::invalid_argument err ) {
+    std::ostringstream buf;
+    buf << "invalid argument" << ": " << err.what();
+    PyErr_SetString(PyExc_ValueError, buf.str().c_str());
+    return nullptr;
+  }
+}
+
+// AND and existential quantification
+PyObject*
+and_exist(
+  PyObject* self,
+  PyObject* args,
+  PyObject* kwds
+)
+{
+  static const char* kwlist[] = {
+    "operand",
+    "var_set",
+    nullptr
+  };
+  PyObject* operand_obj = nullptr;
+  PyObject* var_set_obj = nullptr;
+  if ( !PyArg_ParseTupleAndKeywords(args, kwds, "O!O",
+                                    const_cast<char**>(kwlist),
+                                    PyBdd::_typeobject(), &operand_obj,
+                                    &var_set_obj) ) {
+    return nullptr;
+  }
+  Bdd operand;
+  if ( operand_obj != nullptr ) {
+    if ( !PyBdd::FromPyObject(operand_obj, operand) ) {
+      PyErr_SetString(PyExc_TypeError, "could not convert to Bdd");
+      return nullptr;
+    }
+  }
+  BddVarSet var_set;
+  if ( var_set_obj != nullptr ) {
+    if ( !PyBddVarSet::FromPyObject(var_set_obj, var_set) ) {
+      PyErr_SetString(PyExc_ValueError, "could not convert to BddVarSet");
+      return nullptr;
+    }
+  }
+  auto& val = PyBdd::_get_ref(self);
+  try {
+    return PyBdd::ToPyObject(val.and_exist(operand, var_set));
+  }
+  catch ( std::invalid_argument err ) {
+    std::ostringstream buf;
+    buf << "invalid argument" << ": " << err.what();
+    PyErr_SetString(PyExc_ValueError, buf.str().c_str());
+    return nullptr;
+  }
+}
+
 // return True if valid
 PyObject*
 is_valid(
@@ -909,6 +1030,41 @@ to_truth(
   }
 }
 
+// count the number of minterms
+PyObject*
+minterm_count(
+  PyObject* self,
+  PyObject* args,
+  PyObject* kwds
+)
+{
+  static const char* kwlist[] = {
+    "nvars",
+    nullptr
+  };
+  int nvars;
+  if ( !PyArg_ParseTupleAndKeywords(args, kwds, "i",
+                                    const_cast<char**>(kwlist),
+                                    &nvars) ) {
+    return nullptr;
+  }
+  auto& val = PyBdd::_get_ref(self);
+  if ( nvars < 0 ) {
+    PyErr_SetString(PyExc_ValueError, "nvars should be non-negative");
+    return nullptr;
+  }
+  try {
+    auto str_val = val.minterm_count_str(nvars);
+    return PyLong_FromString(str_val.c_str(), nullptr, 10);
+  }
+  catch ( std::invalid_argument err ) {
+    std::ostringstream buf;
+    buf << "invalid argument" << ": " << err.what();
+    PyErr_SetString(PyExc_ValueError, buf.str().c_str());
+    return nullptr;
+  }
+}
+
 // メソッド定義
 PyMethodDef methods[] = {
   {"invalid",
@@ -935,6 +1091,18 @@ PyMethodDef methods[] = {
    reinterpret_cast<PyCFunction>(remap_vars),
    METH_VARARGS | METH_KEYWORDS,
    PyDoc_STR("remap variable ordering")},
+  {"exist",
+   reinterpret_cast<PyCFunction>(exist),
+   METH_VARARGS | METH_KEYWORDS,
+   PyDoc_STR("existential quantification")},
+  {"forall",
+   reinterpret_cast<PyCFunction>(forall),
+   METH_VARARGS | METH_KEYWORDS,
+   PyDoc_STR("universal quantification")},
+  {"and_exist",
+   reinterpret_cast<PyCFunction>(and_exist),
+   METH_VARARGS | METH_KEYWORDS,
+   PyDoc_STR("AND and existential quantification")},
   {"is_valid",
    is_valid,
    METH_NOARGS,
@@ -1007,6 +1175,10 @@ PyMethodDef methods[] = {
    reinterpret_cast<PyCFunction>(to_truth),
    METH_VARARGS | METH_KEYWORDS,
    PyDoc_STR("convert to truth table")},
+  {"minterm_count",
+   reinterpret_cast<PyCFunction>(minterm_count),
+   METH_VARARGS | METH_KEYWORDS,
+   PyDoc_STR("count the number of minterms")},
   // end-marker
   {nullptr, nullptr, 0, nullptr}
 };
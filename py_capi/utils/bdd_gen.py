@@ -35,6 +35,17 @@ class BddVarArg(ObjConvArg):
                          cvardefault=None,
                          pyclassname='PyBddVar')
 
+class BddVarSetArg(ObjConvArg):
+
+    def __init__(self, *,
+                 name=None,
+                 cvarname):
+        super().__init__(name=name,
+                         cvarname=cvarname,
+                         cvartype='BddVarSet',
+                         cvardefault=None,
+                         pyclassname='PyBddVarSet')
+
 
 class BddGen(PyObjGen):
 
@@ -158,6 +169,41 @@ class BddGen(PyObjGen):
                                                  pytypename='&PyDict_Type')],
                         doc_str='remap variable ordering')
 
+        def meth_exist(writer):
+            with writer.gen_try_block():
+                writer.gen_return_pyobject('PyBdd',
+                                           'val.exist(var_set)')
+            writer.gen_catch_invalid_argument()
+        self.add_method('exist',
+                        func_body=meth_exist,
+                        arg_list=[BddVarSetArg(name='var_set',
+                                               cvarname='var_set')],
+                        doc_str='existential quantification')
+
+        def meth_forall(writer):
+            with writer.gen_try_block():
+                writer.gen_return_pyobject('PyBdd',
+                                           'val.forall(var_set)')
+            writer.gen_catch_invalid_argument()
+        self.add_method('forall',
+                        func_body=meth_forall,
+                        arg_list=[BddVarSetArg(name='var_set',
+                                               cvarname='var_set')],
+                        doc_str='universal quantification')
+
+        def meth_and_exist(writer):
+            with writer.gen_try_block():
+                writer.gen_return_pyobject('PyBdd',
+                                           'val.and_exist(operand, var_set)')
+            writer.gen_catch_invalid_argument()
+        self.add_method('and_exist',
+                        func_body=meth_and_exist,
+                        arg_list=[BddArg(name='operand',
+                                         cvarname='operand'),
+                                  BddVarSetArg(name='var_set',
+                                               cvarname='var_set')],
+                        doc_str='AND and existential quantification')
+
         def meth_is_valid(writer):
             writer.gen_return_py_bool('val.is_valid()')
         self.add_method('is_valid',
@@ -337,6 +383,19 @@ class BddGen(PyObjGen):
                                             cvarname='list_obj')],
                         doc_str='convert to truth table')
 
+        def meth_minterm_count(writer):
+            with writer.gen_if_block('nvars < 0'):
+                writer.gen_value_error('"nvars should be non-negative"')
+            with writer.gen_try_block():
+                writer.gen_auto_assign('str_val', 'val.minterm_count_str(nvars)')
+                writer.write_line('return PyLong_FromString(str_val.c_str(), nullptr, 10);')
+            writer.gen_catch_invalid_argument()
+        self.add_method('minterm_count',
+                        func_body=meth_minterm_count,
+                        arg_list=[IntArg(name='nvars',
+                                         cvarname='nvars')],
+                        doc_str='count the number of minterms')
+
         def meth_gen_dot(writer):
             pass
 
@@ -0,0 +1,240 @@
+
+/// @file npn_enum.cc
+/// @brief NPN同値類の列挙と正規化の性能評価を行うプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/TvFunc.h"
+#include "npn/NpnMgr.h"
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <map>
+#include <random>
+#include <thread>
+#include <unordered_set>
+
+
+BEGIN_NAMESPACE_YM_LOGIC
+
+BEGIN_NONAMESPACE
+
+// スレッドごとの集計結果
+struct Stats
+{
+  // 処理した関数の数
+  SizeType mFuncNum{0};
+
+  // 正規形の集合
+  std::unordered_set<TvFunc> mClassSet;
+
+  // 段階ごとの時間(ナノ秒)
+  std::uint64_t mNormalizeTime{0};
+  std::uint64_t mRefineTime{0};
+  std::uint64_t mTvmaxTime{0};
+
+  // tvmax_count の分布
+  // tvmax_count の値をキーにして関数の数を保持する．
+  std::map<std::uint64_t, SizeType> mTvmaxDist;
+
+  // 集計結果をマージする．
+  void
+  merge(
+    Stats& src
+  )
+  {
+    mFuncNum += src.mFuncNum;
+    mClassSet.merge(src.mClassSet);
+    mNormalizeTime += src.mNormalizeTime;
+    mRefineTime += src.mRefineTime;
+    mTvmaxTime += src.mTvmaxTime;
+    for ( auto& p: src.mTvmaxDist ) {
+      mTvmaxDist[p.first] += p.second;
+    }
+  }
+};
+
+// 1つのブロックで処理する関数の数
+const SizeType BLOCK_SIZE = 256;
+
+void
+usage(
+  const char* argv0
+)
+{
+  std::cerr << "USAGE: " << argv0
+	    << " [-t <# of threads>] [-r <# of samples>] [-s <seed>]"
+	    << " <# of inputs>" << std::endl
+	    << "  enumerates all functions if <# of inputs> <= 4 and"
+	    << " -r is not specified." << std::endl;
+}
+
+END_NONAMESPACE
+
+int
+npn_enum(
+  int argc,
+  char** argv
+)
+{
+  SizeType thread_num = std::thread::hardware_concurrency();
+  SizeType sample_num = 0;
+  SizeType seed = 0;
+  int pos = 1;
+  for ( ; pos < argc && argv[pos][0] == '-'; ++ pos ) {
+    std::string opt{argv[pos]};
+    if ( pos + 1 == argc ) {
+      usage(argv[0]);
+      return -1;
+    }
+    int val = atoi(argv[pos + 1]);
+    if ( opt == "-t" ) {
+      thread_num = val;
+    }
+    else if ( opt == "-r" ) {
+      sample_num = val;
+    }
+    else if ( opt == "-s" ) {
+      seed = val;
+    }
+    else {
+      usage(argv[0]);
+      return -1;
+    }
+    ++ pos;
+  }
+  if ( pos + 1 != argc ) {
+    usage(argv[0]);
+    return -1;
+  }
+  SizeType ni = atoi(argv[pos]);
+  if ( ni > TvFunc::kMaxNi ) {
+    std::cerr << "# of inputs is too large" << std::endl;
+    return -1;
+  }
+  if ( thread_num == 0 ) {
+    thread_num = 1;
+  }
+
+  // 対象の関数を用意する．
+  // 全探索の場合は番号から関数を作る．
+  bool exhaustive = sample_num == 0;
+  SizeType nf;
+  std::vector<TvFunc> func_list;
+  if ( exhaustive ) {
+    if ( ni > 4 ) {
+      std::cerr << "-r is required if # of inputs > 4" << std::endl;
+      return -1;
+    }
+    nf = 1UL << (1UL << ni);
+  }
+  else {
+    nf = sample_num;
+    std::mt19937 rg(seed);
+    std::uniform_int_distribution<TvFunc::WordType> rd;
+    SizeType nw = ni <= 6 ? 1 : (1UL << (ni - 6));
+    func_list.reserve(nf);
+    for ( SizeType i = 0; i < nf; ++ i ) {
+      std::vector<TvFunc::WordType> data(nw);
+      for ( auto& w: data ) {
+	w = rd(rg);
+      }
+      func_list.push_back(TvFunc::from_raw_data(ni, std::move(data)));
+    }
+  }
+
+  // BLOCK_SIZE 個ずつ取り出して正規化する．
+  std::atomic<SizeType> next{0};
+  std::vector<Stats> stats_list(thread_num);
+  auto worker = [&](SizeType tid) {
+    auto& stats = stats_list[tid];
+    NpnMgr mgr;
+    mgr.set_profile(true);
+    for ( ; ; ) {
+      auto start = next.fetch_add(BLOCK_SIZE);
+      if ( start >= nf ) {
+	break;
+      }
+      auto end = std::min(start + BLOCK_SIZE, nf);
+      for ( SizeType i = start; i < end; ++ i ) {
+	TvFunc func;
+	if ( exhaustive ) {
+	  std::vector<TvFunc::WordType> data{i};
+	  func = TvFunc::from_raw_data(ni, std::move(data));
+	}
+	else {
+	  func = func_list[i];
+	}
+	auto cfunc = mgr.cannonical(func);
+	++ stats.mFuncNum;
+	stats.mClassSet.emplace(std::move(cfunc));
+	stats.mNormalizeTime += mgr.normalize_time();
+	stats.mRefineTime += mgr.refine_time();
+	stats.mTvmaxTime += mgr.tvmax_time();
+	++ stats.mTvmaxDist[mgr.tvmax_count()];
+      }
+    }
+  };
+
+  auto start_time = std::chrono::steady_clock::now();
+  std::vector<std::thread> thread_list;
+  for ( SizeType tid = 1; tid < thread_num; ++ tid ) {
+    thread_list.emplace_back(worker, tid);
+  }
+  worker(0);
+  for ( auto& th: thread_list ) {
+    th.join();
+  }
+  auto end_time = std::chrono::steady_clock::now();
+  double wall_time = std::chrono::duration<double>(end_time - start_time).count();
+
+  Stats total;
+  for ( auto& stats: stats_list ) {
+    total.merge(stats);
+  }
+
+  auto ms = [](std::uint64_t ns) { return ns / 1.0e6; };
+  std::cout << "# of inputs:        " << ni << std::endl
+	    << "# of functions:     " << total.mFuncNum
+	    << (exhaustive ? " (all)" : " (random)") << std::endl
+	    << "# of classes:       " << total.mClassSet.size() << std::endl
+	    << "# of threads:       " << thread_num << std::endl
+	    << "Wall time:          " << wall_time << " s" << std::endl
+	    << "Throughput:         " << total.mFuncNum / wall_time
+	    << " functions/s" << std::endl
+	    << "Phase time (sum of all threads)" << std::endl
+	    << "  walsh normalize:  " << ms(total.mNormalizeTime) << " ms" << std::endl
+	    << "  polarity refine:  " << ms(total.mRefineTime) << " ms" << std::endl
+	    << "  tvmax recursion:  " << ms(total.mTvmaxTime) << " ms" << std::endl
+	    << "tvmax_count distribution" << std::endl;
+  // 2のべき乗ごとの区間にまとめて表示する．
+  std::uint64_t lo = 0;
+  std::uint64_t hi = 0;
+  auto p = total.mTvmaxDist.begin();
+  while ( p != total.mTvmaxDist.end() ) {
+    SizeType n = 0;
+    for ( ; p != total.mTvmaxDist.end() && p->first <= hi; ++ p ) {
+      n += p->second;
+    }
+    if ( n > 0 ) {
+      std::cout << "  " << std::setw(6) << lo << " - " << std::setw(6) << hi
+		<< ": " << n << std::endl;
+    }
+    lo = hi + 1;
+    hi = hi * 2 + 1;
+  }
+  return 0;
+}
+
+END_NAMESPACE_YM_LOGIC
+
+int
+main(
+  int argc,
+  char** argv
+)
+{
+  return nsYm::nsLogic::npn_enum(argc, argv);
+}
@@ -0,0 +1,103 @@
+
+/// @file npn_table_bench.cc
+/// @brief NpnTable と NpnMgr の速度を比較するプログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/TvFunc.h"
+#include "npn/NpnMgr.h"
+#include "npn/NpnTable.h"
+#include "ym/Timer.h"
+#include <random>
+
+
+BEGIN_NAMESPACE_YM_LOGIC
+
+int
+npn_table_bench(
+  int argc,
+  char** argv
+)
+{
+  if ( argc != 2 && argc != 3 ) {
+    std::cerr << "USAGE: npn_table_bench <# of inputs> [<# of functions>]"
+	      << std::endl;
+    return -1;
+  }
+
+  SizeType ni = atoi(argv[1]);
+  SizeType nf = 100000;
+  if ( argc == 3 ) {
+    nf = atoi(argv[2]);
+  }
+  if ( ni > NpnTable::MAX_NI ) {
+    std::cerr << "# of inputs should be less than or equal to "
+	      << NpnTable::MAX_NI << std::endl;
+    return -1;
+  }
+
+  // ランダムな関数を作る．
+  std::mt19937 rg;
+  std::uniform_int_distribution<TvFunc::WordType> rd(0, (1ULL << (1 << ni)) - 1);
+  std::vector<TvFunc> func_list;
+  func_list.reserve(nf);
+  for ( SizeType i = 0; i < nf; ++ i ) {
+    std::vector<TvFunc::WordType> data{rd(rg)};
+    func_list.push_back(TvFunc::from_raw_data(ni, std::move(data)));
+  }
+
+  Timer timer;
+
+  // 表の構築
+  timer.start();
+  NpnTable::cannonical(func_list.front());
+  timer.stop();
+  auto time0 = timer.get_time();
+
+  // 表引き
+  timer.reset();
+  timer.start();
+  SizeType sum1 = 0;
+  for ( auto& func: func_list ) {
+    auto cfunc = NpnTable::cannonical(func);
+    sum1 += cfunc.raw_data(0);
+  }
+  timer.stop();
+  auto time1 = timer.get_time();
+
+  // NpnMgr
+  timer.reset();
+  timer.start();
+  SizeType sum2 = 0;
+  for ( auto& func: func_list ) {
+    NpnMgr mgr;
+    auto cfunc = mgr.cannonical(func);
+    sum2 += cfunc.raw_data(0);
+  }
+  timer.stop();
+  auto time2 = timer.get_time();
+
+  std::cout << "# of inputs:     " << ni << std::endl
+	    << "# of functions:  " << nf << " functions" << std::endl
+	    << "Table setup:     " << time0 << std::endl
+	    << "NpnTable:        " << time1 << std::endl
+	    << "NpnMgr:          " << time2 << std::endl;
+  if ( sum1 != sum2 ) {
+    std::cout << "Error: results mismatch" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+END_NAMESPACE_YM_LOGIC
+
+int
+main(
+  int argc,
+  char** argv
+)
+{
+  return nsYm::nsLogic::npn_table_bench(argc, argv);
+}
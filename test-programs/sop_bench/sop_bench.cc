@@ -0,0 +1,100 @@
+/// @file sop_bench.cc
+/// @brief SopCover の積と代数的除算の性能評価プログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/SopCover.h"
+#include "ym/SopCube.h"
+#include "ym/Timer.h"
+#include "SopKernel.h"
+#include <random>
+
+
+BEGIN_NAMESPACE_YM_SOP
+
+int
+sop_bench(
+  int argc,
+  char** argv
+)
+{
+  if ( argc != 2 && argc != 3 ) {
+    std::cerr << "USAGE: sop_bench <# of variables> [<# of cubes>]" << std::endl;
+    return -1;
+  }
+
+  SizeType nv = atoi(argv[1]);
+  SizeType nc = 1000;
+  if ( argc == 3 ) {
+    nc = atoi(argv[2]);
+  }
+  if ( nv == 0 ) {
+    std::cerr << "# of variables should be greater than 0" << std::endl;
+    return -1;
+  }
+
+  // ランダムなカバーを作る．
+  std::mt19937 rg;
+  std::uniform_int_distribution<SizeType> rv(0, nv - 1);
+  std::uniform_int_distribution<SizeType> rn(1, std::min<SizeType>(nv, 6));
+  std::vector<std::vector<Literal>> cube_list(nc);
+  for ( auto& lits: cube_list ) {
+    std::vector<bool> used(nv, false);
+    auto n = rn(rg);
+    while ( lits.size() < n ) {
+      auto var = rv(rg);
+      if ( !used[var] ) {
+	used[var] = true;
+	lits.push_back(Literal{var, (rg() % 2) == 1});
+      }
+    }
+  }
+  SopCover cover{nv, cube_list};
+
+  std::cout << "# of variables:  " << nv << std::endl
+	    << "# of cubes:      " << cover.cube_num() << std::endl;
+  for ( auto impl: {SopKernel::Impl::Scalar,
+		    SopKernel::Impl::Avx2,
+		    SopKernel::Impl::Avx512} ) {
+    if ( !SopKernel::is_supported(impl) ) {
+      std::cout << SopKernel::impl_name(impl) << ": not supported" << std::endl;
+      continue;
+    }
+    SopKernel::set_impl(impl);
+
+    // 結果を使わないと最適化で消されてしまうので足し合わせておく．
+    SizeType dummy = 0;
+    Timer timer;
+    timer.start();
+    for ( SizeType var = 0; var < nv; ++ var ) {
+      for ( auto inv: {false, true} ) {
+	auto lit = Literal{var, inv};
+	dummy += cover.algdiv(lit).cube_num();
+	dummy += (cover & lit).cube_num();
+      }
+    }
+    for ( SizeType i = 0; i < cover.cube_num(); i += 16 ) {
+      auto cube = cover.get_cube(i);
+      dummy += cover.algdiv(cube).cube_num();
+      dummy += cover.literal_num();
+    }
+    timer.stop();
+    std::cout << SopKernel::impl_name(impl) << ": "
+	      << timer.get_time() << " (" << dummy << ")" << std::endl;
+  }
+
+  return 0;
+}
+
+END_NAMESPACE_YM_SOP
+
+int
+main(
+  int argc,
+  char** argv
+)
+{
+  return nsYm::nsSop::sop_bench(argc, argv);
+}
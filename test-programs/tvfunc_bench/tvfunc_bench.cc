@@ -0,0 +1,95 @@
+
+/// @file tvfunc_bench.cc
+/// @brief TvFunc の数え上げ系関数の性能評価プログラム
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2025 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/TvFunc.h"
+#include "ym/Timer.h"
+#include "BitCount.h"
+#include <random>
+
+
+BEGIN_NAMESPACE_YM
+
+int
+tvfunc_bench(
+  int argc,
+  char** argv
+)
+{
+  if ( argc != 2 && argc != 3 ) {
+    std::cerr << "USAGE: tvfunc_bench <# of inputs> [<# of functions>]" << std::endl;
+    return -1;
+  }
+
+  SizeType ni = atoi(argv[1]);
+  SizeType nf = 100;
+  if ( argc == 3 ) {
+    nf = atoi(argv[2]);
+  }
+  if ( ni > TvFunc::kMaxNi ) {
+    std::cerr << "# of inputs should be less than or equal to "
+	      << TvFunc::kMaxNi << std::endl;
+    return -1;
+  }
+
+  // ランダムな関数を作る．
+  std::mt19937 rg;
+  std::uniform_int_distribution<int> rd(0, 1);
+  std::vector<TvFunc> func_list;
+  func_list.reserve(nf);
+  for ( SizeType c = 0; c < nf; ++ c ) {
+    std::vector<int> values(1 << ni);
+    for ( auto& v: values ) {
+      v = rd(rg);
+    }
+    func_list.push_back(TvFunc{ni, values});
+  }
+
+  std::cout << "# of inputs:     " << ni << std::endl
+	    << "# of functions:  " << nf << std::endl;
+  for ( auto impl: {BitCount::Impl::Scalar,
+		    BitCount::Impl::Popcnt,
+		    BitCount::Impl::Avx2,
+		    BitCount::Impl::Avx512} ) {
+    if ( !BitCount::is_supported(impl) ) {
+      std::cout << BitCount::impl_name(impl) << ": not supported" << std::endl;
+      continue;
+    }
+    BitCount::set_impl(impl);
+
+    // 結果を使わないと最適化で消されてしまうので足し合わせておく．
+    SizeType dummy = 0;
+    Timer timer;
+    timer.start();
+    for ( auto& func: func_list ) {
+      dummy += func.count_one();
+      dummy += func.walsh_0();
+      for ( SizeType i = 0; i < ni; ++ i ) {
+	dummy += func.walsh_1(i);
+	for ( SizeType j = i + 1; j < ni; ++ j ) {
+	  dummy += func.walsh_2(i, j);
+	}
+      }
+    }
+    timer.stop();
+    std::cout << BitCount::impl_name(impl) << ": "
+	      << timer.get_time() << " (" << dummy << ")" << std::endl;
+  }
+
+  return 0;
+}
+
+END_NAMESPACE_YM
+
+int
+main(
+  int argc,
+  char** argv
+)
+{
+  return nsYm::tvfunc_bench(argc, argv);
+}